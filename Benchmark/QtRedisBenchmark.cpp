@@ -0,0 +1,566 @@
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QPair>
+#include <QDebug>
+
+#include <functional>
+#include <atomic>
+
+// The heap counter replaces the allocation functions of glibc (QTREDISCLIENT_BENCHMARK_HEAP_COUNTER option),
+// it is disabled with the sanitizers, which replace them too.
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer) || __has_feature(thread_sanitizer)
+#define QTREDIS_BENCHMARK_SANITIZER
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define QTREDIS_BENCHMARK_SANITIZER
+#endif
+#if defined(QTREDIS_BENCHMARK_HEAP_COUNTER) && defined(__GLIBC__) && !defined(QTREDIS_BENCHMARK_SANITIZER)
+#define QTREDIS_BENCHMARK_HEAP
+#include <malloc.h>
+#endif
+
+#include "QtRedisClient.h"
+#include "Core/NetworkLayer/QtRedisParser.h"
+#include "Core/NetworkLayer/QtRedisStreamParser.h"
+#include "Core/NetworkLayer/QtRedisTransporter.h"
+
+//!
+//! \file QtRedisBenchmark.cpp
+//! \brief Микробенчмарки разбора/формирования данных Redis-а
+//!
+//! Usage: QtRedisClientBenchmark [case...] (without arguments runs all cases).
+//! Note: Each case prints the best time of several runs.
+//! Note: Only the publish-throughput case needs the Redis server (QTREDISCLIENT_BENCHMARK_HOST, QTREDISCLIENT_BENCHMARK_PORT,
+//! 127.0.0.1:6379 by default), without the server it is skipped.
+//!
+
+static const int BenchmarkRuns = 5;
+
+#if defined(QTREDIS_BENCHMARK_HEAP)
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static std::atomic<qint64> heapBytes(0);
+static std::atomic<qint64> heapPeakBytes(0);
+static std::atomic<qint64> heapAllocs(0);
+
+//!
+//! \brief Учесть изменение размера кучи
+//! \param bytes Изменение (байт)
+//!
+static void heapAdd(const qint64 bytes)
+{
+    if (bytes > 0)
+        heapAllocs++;
+    const qint64 value = heapBytes.fetch_add(bytes) + bytes;
+    qint64 peak = heapPeakBytes.load();
+    while (value > peak && !heapPeakBytes.compare_exchange_weak(peak, value)) {}
+}
+
+// The allocation functions of glibc are replaced to count the heap of the whole process
+// (Qt containers use malloc, so the replacement of operator new would not see their data).
+extern "C" void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+    if (ptr)
+        heapAdd(static_cast<qint64>(malloc_usable_size(ptr)));
+    return ptr;
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    void *ptr = __libc_calloc(count, size);
+    if (ptr)
+        heapAdd(static_cast<qint64>(malloc_usable_size(ptr)));
+    return ptr;
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    const qint64 oldSize = ptr ? static_cast<qint64>(malloc_usable_size(ptr)) : 0;
+    void *newPtr = __libc_realloc(ptr, size);
+    if (newPtr)
+        heapAdd(static_cast<qint64>(malloc_usable_size(newPtr)) - oldSize);
+    else if (size == 0)
+        heapAdd(-oldSize);
+    return newPtr;
+}
+
+extern "C" void free(void *ptr)
+{
+    if (ptr)
+        heapAdd(-static_cast<qint64>(malloc_usable_size(ptr)));
+    __libc_free(ptr);
+}
+#endif
+
+//!
+//! \brief Поддерживается ли подсчет кучи
+//! \return
+//!
+static bool isHeapCounted()
+{
+#if defined(QTREDIS_BENCHMARK_HEAP)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//!
+//! \brief Текущий размер кучи (байт)
+//! \return
+//!
+static qint64 heapSize()
+{
+#if defined(QTREDIS_BENCHMARK_HEAP)
+    return heapBytes.load();
+#else
+    return 0;
+#endif
+}
+
+//!
+//! \brief Количество выделений памяти (malloc, calloc, realloc с увеличением)
+//! \return
+//!
+static qint64 heapAllocCount()
+{
+#if defined(QTREDIS_BENCHMARK_HEAP)
+    return heapAllocs.load();
+#else
+    return 0;
+#endif
+}
+
+//!
+//! \brief Начать подсчет пикового размера кучи с текущего размера
+//!
+static void resetHeapPeak()
+{
+#if defined(QTREDIS_BENCHMARK_HEAP)
+    heapPeakBytes.store(heapBytes.load());
+#endif
+}
+
+//!
+//! \brief Пиковый размер кучи (байт)
+//! \return
+//!
+static qint64 heapPeak()
+{
+#if defined(QTREDIS_BENCHMARK_HEAP)
+    return heapPeakBytes.load();
+#else
+    return 0;
+#endif
+}
+
+//!
+//! \brief Выполнить функцию несколько раз и вернуть лучшее время
+//! \param func Функция
+//! \return Время (нсек)
+//!
+static qint64 bestTimeNsec(const std::function<void()> &func)
+{
+    qint64 bestNsec = -1;
+    for (int i = 0; i < BenchmarkRuns; i++) {
+        QElapsedTimer timer;
+        timer.start();
+        func();
+        const qint64 nsec = timer.nsecsElapsed();
+        if (bestNsec < 0 || nsec < bestNsec)
+            bestNsec = nsec;
+    }
+    return bestNsec;
+}
+
+//!
+//! \brief Сформировать ответ-массив из строк (*N\r\n$5\r\nvalue\r\n...)
+//! \param count Количество элементов
+//! \return
+//!
+static QByteArray createArrayRawData(const int count)
+{
+    QByteArray data;
+    data.reserve(count * 11 + 16);
+    data.append('*').append(QByteArray::number(count)).append("\r\n");
+    for (int i = 0; i < count; i++)
+        data.append("$5\r\nvalue\r\n");
+    return data;
+}
+
+//!
+//! \brief Разбор плоского массива (время должно расти линейно от количества элементов)
+//!
+static void benchmarkParseArray()
+{
+    qInfo().noquote() << "parse-array: QtRedisParser::parseRawData, flat array of bulk strings";
+    for (const int count : {1000, 10000, 100000}) {
+        const QByteArray data = createArrayRawData(count);
+        bool isOk = false;
+        const qint64 nsec = bestTimeNsec([&data, &isOk]() {
+            QString error;
+            const QtRedisReply reply = QtRedisParser::parseRawData(data, error, &isOk);
+            Q_UNUSED(reply)
+        });
+        qInfo().noquote() << QString("  %1 elements: %2 ms, %3 ns/element%4")
+                             .arg(count, 7)
+                             .arg(nsec / 1000000.0, 0, 'f', 3)
+                             .arg(nsec / count)
+                             .arg(isOk ? "" : " (parse failed!)");
+    }
+}
+
+//!
+//! \brief Сформировать вложенный ответ-массив (как у EXEC с командами LRANGE/MGET)
+//! \param depth Глубина вложенности (1 - массив строк)
+//! \param count Количество элементов на каждом уровне
+//! \param value Значение строк
+//! \return
+//!
+static QByteArray createNestedRawData(const int depth, const int count, const QByteArray &value)
+{
+    QByteArray data;
+    data.append('*').append(QByteArray::number(count)).append("\r\n");
+    if (depth <= 1) {
+        const QByteArray item = QByteArray("$") + QByteArray::number(value.size()) + "\r\n" + value + "\r\n";
+        for (int i = 0; i < count; i++)
+            data.append(item);
+        return data;
+    }
+    const QByteArray item = createNestedRawData(depth - 1, count, value);
+    for (int i = 0; i < count; i++)
+        data.append(item);
+    return data;
+}
+
+//!
+//! \brief Память при разборе вложенного ответа (пик во время разбора и удерживаемая ответом)
+//!
+static void benchmarkNestedReply()
+{
+    qInfo().noquote() << "nested-reply: QtRedisParser::parseRawData, nested arrays of 16-byte bulk strings";
+    if (!isHeapCounted()) {
+        qInfo().noquote() << "  the heap counter is disabled (see QTREDISCLIENT_BENCHMARK_HEAP_COUNTER),"
+                             " use heaptrack or valgrind --tool=massif";
+        return;
+    }
+    for (const int depth : {2, 3, 4}) {
+        const int count = depth == 2 ? 100 : (depth == 3 ? 20 : 10);
+        const QByteArray data = createNestedRawData(depth, count, QByteArray(16, 'v'));
+
+        const qint64 baseBytes = heapSize();
+        resetHeapPeak();
+        qint64 retainedBytes = 0;
+        bool isOk = false;
+        {
+            QString error;
+            const QtRedisReply reply = QtRedisParser::parseRawData(data, error, &isOk);
+            retainedBytes = heapSize() - baseBytes;
+        }
+        const qint64 peakBytes = heapPeak() - baseBytes;
+
+        qInfo().noquote() << QString("  depth %1 (%2 bytes on the wire): peak %3 bytes, retained %4 bytes%5")
+                             .arg(depth)
+                             .arg(data.size())
+                             .arg(peakBytes)
+                             .arg(retainedBytes)
+                             .arg(isOk ? "" : " (parse failed!)");
+    }
+}
+
+//!
+//! \brief Формирование "сырых" данных команд (QtRedisParser::createRawData)
+//!
+static void benchmarkSerialize()
+{
+    const int count = 100000;
+    qInfo().noquote() << "serialize: QtRedisParser::createRawData";
+    const QtRedisCommand setCommand("SET", QList<QByteArray>({QByteArray(16, 'k'), QByteArray(100, 'v'), "EX", "60"}));
+    QList<QByteArray> msetArgv;
+    for (int i = 0; i < 100; i++)
+        msetArgv << QByteArray(16, 'k') << QByteArray(100, 'v');
+    const QtRedisCommand msetCommand("MSET", msetArgv);
+
+    const QList<QPair<QString, QtRedisCommand>> commands = {
+        qMakePair(QString("SET key(16) value(100) EX 60"), setCommand),
+        qMakePair(QString("MSET 100 x key(16) value(100)"), msetCommand)
+    };
+    for (const QPair<QString, QtRedisCommand> &command : commands) {
+        qint64 size = 0;
+        const qint64 allocs = heapAllocCount();
+        const qint64 nsec = bestTimeNsec([&command, &size, count]() {
+            for (int i = 0; i < count; i++)
+                size += QtRedisParser::createRawData(command.second).size();
+        });
+        const qint64 allocsPerCommand = (heapAllocCount() - allocs) / (static_cast<qint64>(count) * BenchmarkRuns);
+        qInfo().noquote() << QString("  %1: %2 ns/command%3%4")
+                             .arg(command.first)
+                             .arg(nsec / count)
+                             .arg(isHeapCounted() ? QString(", %1 allocations/command").arg(allocsPerCommand) : QString())
+                             .arg(size > 0 ? "" : " (no data!)");
+    }
+    if (!isHeapCounted())
+        qInfo().noquote() << "  the allocations are not counted (see QTREDISCLIENT_BENCHMARK_HEAP_COUNTER)";
+}
+
+//!
+//! \brief Создание команд: прежние способы (форматированная строка + fromString, список строк + fromStringList)
+//! и типизированный построитель (operator<<)
+//!
+//! Note: The old way is the one the built-in command used before the builder:
+//! GET, EXPIRE and LRANGE formatted the QString and split it by fromString(), SET and ZADD built the QStringList.
+//!
+static void benchmarkBuildCommand()
+{
+    const int count = 100000;
+    qInfo().noquote() << "build-command: QString::arg + QtRedisCommand::fromString (fromStringList) vs QtRedisCommand::operator<<";
+    const QString key(16, QChar('k'));
+    const QString value(100, QChar('v'));
+    QStringList scores;
+    QStringList members;
+    for (int i = 0; i < 100; i++) {
+        scores << QString::number(i * 1.5);
+        members << QString("member:%1").arg(i);
+    }
+
+    int size = 0;
+    const auto printResult = [count](const QString &name, const int repeat, const qint64 oldNsec, const qint64 builderNsec) {
+        const int commandCount = count / repeat;
+        qInfo().noquote() << QString("  %1 old %2 ns/command, builder %3 ns/command")
+                             .arg(name, -28)
+                             .arg(oldNsec / commandCount)
+                             .arg(builderNsec / commandCount);
+    };
+
+    printResult("GET key:", 1,
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++)
+                        size += QtRedisCommand::fromString(QString("GET %1").arg(key)).size();
+                }),
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++) {
+                        QtRedisCommand command("GET");
+                        command << key;
+                        size += command.size();
+                    }
+                }));
+    printResult("EXPIRE key 60:", 1,
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++)
+                        size += QtRedisCommand::fromString(QString("EXPIRE %1 %2").arg(key).arg(60)).size();
+                }),
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++) {
+                        QtRedisCommand command("EXPIRE");
+                        command << key << 60;
+                        size += command.size();
+                    }
+                }));
+    printResult("LRANGE key 0 -1:", 1,
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++)
+                        size += QtRedisCommand::fromString(QString("LRANGE %1 %2 %3").arg(key).arg(0).arg(-1)).size();
+                }),
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++) {
+                        QtRedisCommand command("LRANGE");
+                        command << key << 0 << -1;
+                        size += command.size();
+                    }
+                }));
+    printResult("SET key value EX 60:", 1,
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++) {
+                        QStringList argv;
+                        argv << "SET" << key << value << "EX" << QString::number(60);
+                        size += QtRedisCommand::fromStringList(argv).size();
+                    }
+                }),
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count; i++) {
+                        QtRedisCommand command("SET");
+                        command << key << value << "EX" << 60;
+                        size += command.size();
+                    }
+                }));
+    printResult("ZADD key 100 x score member:", 100,
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count / 100; i++) {
+                        QStringList argv;
+                        argv << "ZADD" << key;
+                        for (int j = 0; j < scores.size(); j++)
+                            argv << scores.at(j) << members.at(j);
+                        size += QtRedisCommand::fromStringList(argv).size();
+                    }
+                }),
+                bestTimeNsec([&]() {
+                    for (int i = 0; i < count / 100; i++) {
+                        QtRedisCommand command("ZADD");
+                        command.reserve(scores.size() * 2 + 1);
+                        command << key;
+                        for (int j = 0; j < scores.size(); j++)
+                            command << scores.at(j) << members.at(j);
+                        size += command.size();
+                    }
+                }));
+    if (size <= 0)
+        qInfo().noquote() << "  (no commands!)";
+}
+
+//!
+//! \brief Разбор сообщений каналов и их передача получателям (сигналы и обработчики)
+//!
+//! Note: Measures the work per message of the signal path (QString channel + QtRedisReply payload)
+//! and of the batch handler (QtRedisTransporter::ChannelMessage), without the cost of the queued signals.
+//!
+static void benchmarkChannelMessages()
+{
+    const int count = 100000;
+    qInfo().noquote() << QString("channel-messages: %1 RESP2 messages with 64-byte payloads").arg(count);
+    QByteArray data;
+    const QByteArray message("*3\r\n$7\r\nmessage\r\n$6\r\nprices\r\n$64\r\n" + QByteArray(64, 'p') + "\r\n");
+    data.reserve(message.size() * count);
+    for (int i = 0; i < count; i++)
+        data.append(message);
+
+    QtRedisReply replyList;
+    const qint64 parseNsec = bestTimeNsec([&data, &replyList]() {
+        QtRedisStreamParser parser;
+        parser.setChannelMessagesAsPush(true);
+        QString error;
+        parser.appendRawData(data, error);
+        replyList = parser.takePushReplies();
+    });
+    qint64 checksum = 0;
+    const qint64 signalNsec = bestTimeNsec([&replyList, &checksum]() {
+        for (const QtRedisReply &reply : replyList.arrayValue_ref()) {
+            const QVector<QtRedisReply> &values = reply.arrayValue_ref();
+            const QString channel = values.at(1).strValue();
+            const QtRedisReply payload = values.at(2);
+            checksum += channel.size() + payload.rawValueView().size();
+        }
+    });
+    const qint64 handlerNsec = bestTimeNsec([&replyList, &checksum]() {
+        QVector<QtRedisTransporter::ChannelMessage> messages;
+        messages.reserve(replyList.arrayValueSize());
+        for (const QtRedisReply &reply : replyList.arrayValue_ref()) {
+            const QVector<QtRedisReply> &values = reply.arrayValue_ref();
+            QtRedisTransporter::ChannelMessage buffMessage;
+            buffMessage.channel = values.at(1).rawValue();
+            buffMessage.payload = values.constLast().rawValue();
+            messages.append(buffMessage);
+        }
+        checksum += messages.size();
+    });
+    qInfo().noquote() << QString("  parse (stream parser): %1 ns/message").arg(parseNsec / count);
+    qInfo().noquote() << QString("  signal arguments:      %1 ns/message").arg(signalNsec / count);
+    qInfo().noquote() << QString("  batch handler:         %1 ns/message%2").arg(handlerNsec / count).arg(checksum > 0 ? "" : " (no messages!)");
+}
+
+//!
+//! \brief Пропускная способность доставки сообщений каналов (PUBLISH -> получатель) через сервер Redis
+//!
+//! The receivers are the signal incomingChannelMessage, the channel handler and the batch handler.
+//! The publisher sends PUBLISH commands by pipelines from the same thread, the time is measured
+//! from the first PUBLISH to the last delivered message.
+//!
+static void benchmarkPublishThroughput()
+{
+    const int count = 100000;
+    const int pipelineSize = 1000;
+    qInfo().noquote() << QString("publish-throughput: %1 messages with 64-byte payloads, PUBLISH -> receiver").arg(count);
+    QString host = QString::fromLocal8Bit(qgetenv("QTREDISCLIENT_BENCHMARK_HOST"));
+    if (host.isEmpty())
+        host = QString("127.0.0.1");
+    int port = qEnvironmentVariableIntValue("QTREDISCLIENT_BENCHMARK_PORT");
+    if (port == 0)
+        port = 6379;
+
+    QtRedisClient publisher;
+    if (!publisher.redisConnect(host, port, 1000)) {
+        qInfo().noquote() << QString("  skipped (no Redis server at %1:%2)").arg(host).arg(port);
+        return;
+    }
+    const QString channel = QString("QtRedisBenchmark:%1").arg(QCoreApplication::applicationPid());
+    const QByteArray payload(64, 'p');
+
+    enum class Receiver { Signal, Handler, BatchHandler };
+    const QList<QPair<QString, Receiver>> receivers = {
+        qMakePair(QString("signal incomingChannelMessage:"), Receiver::Signal),
+        qMakePair(QString("channel handler:"), Receiver::Handler),
+        qMakePair(QString("batch handler:"), Receiver::BatchHandler)
+    };
+    for (const QPair<QString, Receiver> &receiver : receivers) {
+        std::atomic<int> received(0);
+        QtRedisClient subscriber;
+        switch (receiver.second) {
+            case Receiver::Signal:
+                QObject::connect(&subscriber, &QtRedisClient::incomingChannelMessage,
+                                 [&received](const QString &, const QtRedisReply &) { received++; });
+                break;
+            case Receiver::Handler:
+                subscriber.redisSetChannelHandler(channel, [&received](const QByteArray &, const QByteArray &) { received++; });
+                break;
+            case Receiver::BatchHandler:
+                subscriber.redisSetChannelBatchHandler([&received](const QVector<QtRedisTransporter::ChannelMessage> &messages) {
+                    received += messages.size();
+                });
+                break;
+        }
+        if (!subscriber.redisConnect(host, port, 1000)
+            || !subscriber.redisSubscribe(channel)) {
+            qInfo().noquote() << QString("  %1 subscribe failed: %2").arg(receiver.first, subscriber.lastError());
+            continue;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < count; i += pipelineSize) {
+            QtRedisPipeline pipeline = publisher.createPipeline();
+            for (int j = 0; j < pipelineSize; j++)
+                pipeline.redisExecCommand(QtRedisCommand("PUBLISH") << channel << payload);
+            pipeline.exec();
+            QCoreApplication::processEvents(); // the subscriber reads while the publisher sends
+        }
+        while (received.load() < count
+               && timer.elapsed() < 30000)
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        const qint64 nsec = timer.nsecsElapsed();
+        subscriber.redisUnsubscribe(channel);
+
+        qInfo().noquote() << QString("  %1 %2 messages/s, %3 ns/message%4")
+                             .arg(receiver.first, -31)
+                             .arg(static_cast<qint64>(received.load() * 1000000000.0 / nsec))
+                             .arg(nsec / qMax(received.load(), 1))
+                             .arg(received.load() == count ? QString() : QString(" (%1 of %2 delivered!)").arg(received.load()).arg(count));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const QList<QPair<QString, std::function<void()>>> cases = {
+        qMakePair(QString("parse-array"), std::function<void()>(benchmarkParseArray)),
+        qMakePair(QString("nested-reply"), std::function<void()>(benchmarkNestedReply)),
+        qMakePair(QString("channel-messages"), std::function<void()>(benchmarkChannelMessages)),
+        qMakePair(QString("publish-throughput"), std::function<void()>(benchmarkPublishThroughput)),
+        qMakePair(QString("serialize"), std::function<void()>(benchmarkSerialize)),
+        qMakePair(QString("build-command"), std::function<void()>(benchmarkBuildCommand))
+    };
+
+    const QStringList names = app.arguments().mid(1);
+    for (const QPair<QString, std::function<void()>> &benchmarkCase : cases) {
+        if (names.isEmpty() || names.contains(benchmarkCase.first))
+            benchmarkCase.second();
+    }
+    return 0;
+}
@@ -144,6 +144,17 @@ public:
     //!
     virtual bool waitForReadyRead(const int msecs = 30000) = 0;
 
+    //!
+    //! \brief Задать размер буфера чтения сокета
+    //! \param size Размер (байт, 0 - без ограничения)
+    //!
+    //! When the buffer is full, the socket stops reading the data from the system,
+    //! so the server is slowed down by TCP flow control.
+    //!
+    virtual void setReadBufferSize(const qint64 size) {
+        Q_UNUSED(size)
+    }
+
 protected:
     QString _uid;
     QString _host;                  //!< хост
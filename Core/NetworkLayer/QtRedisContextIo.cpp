@@ -0,0 +1,320 @@
+#include "QtRedisContextIo.h"
+
+#include <QMetaObject>
+#include <QElapsedTimer>
+
+//!
+//! \brief Конструктор класса
+//! \param context Контекст (переносится в поток ввода-вывода, удаляется этим объектом)
+//! \param ioThread Поток ввода-вывода (должен быть запущен)
+//!
+QtRedisContextIo::QtRedisContextIo(QtRedisContext *context, QThread *ioThread)
+    : QtRedisContext(context->host(), context->port())
+    , _context(context)
+{
+    _context->setParent(nullptr);
+    _context->moveToThread(ioThread);
+    // the slots are called in the I/O thread
+    connect(_context, &QtRedisContext::connected,
+            this, &QtRedisContextIo::onContextConnected,
+            Qt::DirectConnection);
+    connect(_context, &QtRedisContext::disconnected,
+            this, &QtRedisContextIo::onContextDisconnected,
+            Qt::DirectConnection);
+    connect(_context, &QtRedisContext::readyRead,
+            this, &QtRedisContextIo::onContextReadyRead,
+            Qt::DirectConnection);
+}
+
+//!
+//! \brief Деструктор класса
+//!
+//! Note: The wrapped context is deleted in the I/O thread, the queued writes are discarded.
+//!
+QtRedisContextIo::~QtRedisContextIo()
+{
+    if (_context) {
+        QtRedisContext *context = _context;
+        this->execInIoThread([context]() {
+            delete context;
+        });
+        _context = nullptr;
+    }
+}
+
+//!
+//! \brief Задать SSL Config
+//! \param sslConfig SSL Config
+//!
+void QtRedisContextIo::setSslConfig(const QSslConfiguration &sslConfig)
+{
+    this->execInIoThread([this, &sslConfig]() {
+        _context->setSslConfig(sslConfig);
+    });
+}
+
+//!
+//! \brief Получить установленный ранее SSL Config
+//! \return
+//!
+QSslConfiguration QtRedisContextIo::sslConfig() const
+{
+    return _context->sslConfig();
+}
+
+//!
+//! \brief Подключиться к серверу
+//! \param msecs Время ожидания мсек
+//! \param error Сообщение об ошибке
+//! \return
+//!
+bool QtRedisContextIo::connectToServer(const int msecs, QString &error)
+{
+    bool isOk = false;
+    this->execInIoThread([this, msecs, &error, &isOk]() {
+        if (!_context->isConnected())
+            this->clearBuffers();
+        isOk = _context->connectToServer(msecs, error);
+        _isConnected.store(isOk && _context->isConnected());
+    });
+    return isOk;
+}
+
+//!
+//! \brief Переподключиться к серверу
+//! \param msecs Время ожидания мсек
+//! \param error Сообщение об ошибке
+//! \return
+//!
+bool QtRedisContextIo::reconnectToServer(const int msecs, QString &error)
+{
+    bool isOk = false;
+    this->execInIoThread([this, msecs, &error, &isOk]() {
+        this->clearBuffers();
+        isOk = _context->reconnectToServer(msecs, error);
+        _isConnected.store(isOk && _context->isConnected());
+    });
+    return isOk;
+}
+
+//!
+//! \brief Отключиться от сервера
+//!
+void QtRedisContextIo::disconnectFromServer()
+{
+    this->execInIoThread([this]() {
+        _context->disconnectFromServer();
+        _isConnected.store(false);
+        this->clearBuffers();
+    });
+}
+
+//!
+//! \brief Подключен ли к серверу
+//! \return
+//!
+//! Note: The state is tracked by the signals of the socket, the I/O thread is not queried.
+//!
+bool QtRedisContextIo::isConnected()
+{
+    return _isConnected.load();
+}
+
+//!
+//! \brief Доступны ли данные для чтения
+//! \return
+//!
+bool QtRedisContextIo::canReadRawData() const
+{
+    QMutexLocker lock(&_readMutex);
+    return !_readBuffer.isEmpty();
+}
+
+//!
+//! \brief Количество байт, доступных для чтения
+//! \return
+//!
+qint64 QtRedisContextIo::bytesAvailable() const
+{
+    QMutexLocker lock(&_readMutex);
+    return _readBuffer.size();
+}
+
+//!
+//! \brief Записать данные
+//! \param data Данные
+//! \return
+//!
+//! The data is written by the I/O thread later, the method does not block.
+//!
+qint64 QtRedisContextIo::writeRawData(const QByteArray &data)
+{
+    if (data.isEmpty() || !_isConnected.load())
+        return 0;
+
+    _writeQueue.push(data);
+    if (!_isWriteScheduled.exchange(true)) {
+        QMetaObject::invokeMethod(_context, [this]() {
+            this->flushWriteQueue_io();
+        }, Qt::QueuedConnection);
+    }
+    return data.size();
+}
+
+//!
+//! \brief Прочитать данные
+//! \return
+//!
+QByteArray QtRedisContextIo::readRawData()
+{
+    QMutexLocker lock(&_readMutex);
+    QByteArray data;
+    data.swap(_readBuffer);
+    lock.unlock();
+    if (_isReadPaused.exchange(false)) { // the buffer is free, the socket is read again
+        QMetaObject::invokeMethod(_context, [this]() {
+            this->onContextReadyRead();
+        }, Qt::QueuedConnection);
+    }
+    return data;
+}
+
+//!
+//! \brief Ожидать поступления данных
+//! \param msecs Время ожидания мсек
+//! \return
+//!
+bool QtRedisContextIo::waitForReadyRead(const int msecs)
+{
+    QMutexLocker lock(&_readMutex);
+    QElapsedTimer timer;
+    timer.start();
+    while (_readBuffer.isEmpty()) {
+        if (!_isConnected.load())
+            return false;
+        const qint64 remaining = msecs - timer.elapsed();
+        if (remaining <= 0)
+            return false;
+        _readCondition.wait(&_readMutex, static_cast<unsigned long>(remaining));
+    }
+    return true;
+}
+
+//!
+//! \brief Задать размер буфера чтения сокета
+//! \param size Размер (байт, 0 - без ограничения)
+//!
+//! The socket of the wrapped context and the buffer of the received data are limited,
+//! the I/O thread stops reading the socket while the buffer is full.
+//!
+void QtRedisContextIo::setReadBufferSize(const qint64 size)
+{
+    _readBufferSize.store(size);
+    this->execInIoThread([this, size]() {
+        _context->setReadBufferSize(size);
+    });
+}
+
+// --- protected ---
+
+//!
+//! \brief Выполнить функцию в потоке ввода-вывода и дождаться ее завершения
+//! \param function Функция
+//!
+void QtRedisContextIo::execInIoThread(const std::function<void()> &function)
+{
+    QThread *ioThread = _context->thread();
+    if (ioThread == QThread::currentThread()
+        || !ioThread->isRunning()) {
+        function();
+        return;
+    }
+    QMetaObject::invokeMethod(_context, function, Qt::BlockingQueuedConnection);
+}
+
+//!
+//! \brief Очистить данные для записи и полученные данные
+//!
+//! Note: Called in the I/O thread (the consumer of the write queue).
+//!
+void QtRedisContextIo::clearBuffers()
+{
+    QByteArray data;
+    while (_writeQueue.pop(data)) {}
+    QMutexLocker lock(&_readMutex);
+    _readBuffer.clear();
+}
+
+//!
+//! \brief Записать данные очереди в сокет
+//!
+//! The data pushed by all callers since the last call is written by one call.
+//!
+//! Note: Called in the I/O thread.
+//!
+void QtRedisContextIo::flushWriteQueue_io()
+{
+    _isWriteScheduled.store(false); // the data pushed after this point schedules the next call
+    QByteArray data;
+    QByteArray chunk;
+    while (_writeQueue.pop(chunk)) {
+        if (data.isEmpty())
+            data.swap(chunk);
+        else
+            data.append(chunk);
+    }
+    if (!data.isEmpty())
+        _context->writeRawData(data);
+}
+
+// --- protected slots ---
+
+//!
+//! \brief Слот обработки подключения (поток ввода-вывода)
+//!
+void QtRedisContextIo::onContextConnected()
+{
+    _isConnected.store(true);
+    emit this->connected();
+}
+
+//!
+//! \brief Слот обработки отключения (поток ввода-вывода)
+//!
+//! The callers waiting for the data are woken.
+//!
+void QtRedisContextIo::onContextDisconnected()
+{
+    _isConnected.store(false);
+    {
+        QMutexLocker lock(&_readMutex);
+        _readCondition.wakeAll();
+    }
+    emit this->disconnected();
+}
+
+//!
+//! \brief Слот чтения данных сокета (поток ввода-вывода)
+//!
+//! Note: While the buffer of the received data is full (see setReadBufferSize()), the socket is not read.
+//!
+void QtRedisContextIo::onContextReadyRead()
+{
+    const qint64 readBufferSize = _readBufferSize.load();
+    if (readBufferSize > 0) {
+        QMutexLocker lock(&_readMutex);
+        if (_readBuffer.size() >= readBufferSize) {
+            _isReadPaused.store(true); // resumed by readRawData()
+            return;
+        }
+    }
+    const QByteArray data = _context->readRawData();
+    if (data.isEmpty())
+        return;
+    {
+        QMutexLocker lock(&_readMutex);
+        _readBuffer.append(data);
+        _readCondition.wakeAll();
+    }
+    emit this->readyRead();
+}
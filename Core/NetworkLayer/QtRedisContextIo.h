@@ -0,0 +1,77 @@
+#ifndef QTREDISCONTEXTIO_H
+#define QTREDISCONTEXTIO_H
+
+#include <atomic>
+#include <functional>
+
+#include <QObject>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+#include <QByteArray>
+
+#include "QtRedisContext.h"
+#include "QtRedisLockFreeQueue.h"
+
+//!
+//! \file QtRedisContextIo.h
+//! \class QtRedisContextIo
+//! \brief Класс, описывающий контекст Redis-a, сокет которого обслуживается потоком ввода-вывода
+//!
+//! The wrapped context (and its socket) is moved to the I/O thread and is used only there, event-driven:
+//!     - writeRawData() pushes the data into the lock-free queue, the I/O thread is woken only if it is idle,
+//!       the data queued by concurrent callers is written by one call;
+//!     - the data received by the socket is read by the I/O thread into the buffer,
+//!       readRawData() takes the buffer and waitForReadyRead() waits for it without touching the socket.
+//!
+//! So the socket keeps the thread affinity of Qt, the callers do not contend for the socket,
+//! and the event loop of the I/O thread is never blocked by waitForReadyRead().
+//!
+class QtRedisContextIo : public QtRedisContext
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(QtRedisContextIo)
+
+public:
+    explicit QtRedisContextIo(QtRedisContext *context, QThread *ioThread);
+    ~QtRedisContextIo();
+
+    void setSslConfig(const QSslConfiguration &sslConfig) final;
+    QSslConfiguration sslConfig() const final;
+
+    bool connectToServer(const int msecs, QString &error) final;
+    bool reconnectToServer(const int msecs, QString &error) final;
+    void disconnectFromServer() final;
+    bool isConnected() final;
+
+    bool canReadRawData() const final;
+    qint64 bytesAvailable() const final;
+    qint64 writeRawData(const QByteArray &data) final;
+    QByteArray readRawData() final;
+
+    bool waitForReadyRead(const int msecs = 30000) final;
+
+    void setReadBufferSize(const qint64 size) final;
+
+protected:
+    QtRedisContext                   *_context {nullptr};      //!< контекст, обслуживаемый потоком ввода-вывода
+    QtRedisLockFreeQueue<QByteArray> _writeQueue;              //!< очередь данных для записи
+    std::atomic<bool>                _isWriteScheduled {false};//!< запланирована ли запись потоком ввода-вывода
+    std::atomic<bool>                _isConnected {false};     //!< подключен ли к серверу
+    QByteArray                       _readBuffer;              //!< полученные данные
+    mutable QMutex                   _readMutex;               //!< мьютекс полученных данных
+    QWaitCondition                   _readCondition;           //!< условие получения данных (отключения)
+    std::atomic<qint64>              _readBufferSize {0};      //!< размер буфера чтения (0 - без ограничения)
+    std::atomic<bool>                _isReadPaused {false};    //!< приостановлено ли чтение сокета (буфер заполнен)
+
+    void execInIoThread(const std::function<void()> &function);
+    void clearBuffers();
+    void flushWriteQueue_io();
+
+protected slots:
+    void onContextConnected();
+    void onContextDisconnected();
+    void onContextReadyRead();
+};
+
+#endif // QTREDISCONTEXTIO_H
@@ -216,3 +216,16 @@ bool QtRedisContextSsl::waitForReadyRead(const int msecs)
 
     return _socket->waitForReadyRead(msecs);
 }
+
+//!
+//! \brief Задать размер буфера чтения сокета
+//! \param size Размер (байт, 0 - без ограничения)
+//!
+void QtRedisContextSsl::setReadBufferSize(const qint64 size)
+{
+    QMutexLocker lock(&_mutex);
+    if (!_socket)
+        return;
+
+    _socket->setReadBufferSize(size);
+}
@@ -37,6 +37,8 @@ public:
 
     bool waitForReadyRead(const int msecs = 30000) final;
 
+    void setReadBufferSize(const qint64 size) final;
+
 protected:
     QSslSocket     *_socket {nullptr};  //!< SSL-сокет
     QSslConfiguration _sslConfig;       //!< SSL конфигурация
@@ -189,3 +189,16 @@ bool QtRedisContextTcp::waitForReadyRead(const int msecs)
 
     return _socket->waitForReadyRead(msecs);
 }
+
+//!
+//! \brief Задать размер буфера чтения сокета
+//! \param size Размер (байт, 0 - без ограничения)
+//!
+void QtRedisContextTcp::setReadBufferSize(const qint64 size)
+{
+    QMutexLocker lock(&_mutex);
+    if (!_socket)
+        return;
+
+    _socket->setReadBufferSize(size);
+}
@@ -33,6 +33,8 @@ public:
 
     bool waitForReadyRead(const int msecs = 30000) final;
 
+    void setReadBufferSize(const qint64 size) final;
+
 protected:
     QTcpSocket     *_socket {nullptr};  //!< tcp-сокет
     mutable QMutex  _mutex;             //!< мьютекс
@@ -187,3 +187,16 @@ bool QtRedisContextUnix::waitForReadyRead(const int msecs)
 
     return _socket->waitForReadyRead(msecs);
 }
+
+//!
+//! \brief Задать размер буфера чтения сокета
+//! \param size Размер (байт, 0 - без ограничения)
+//!
+void QtRedisContextUnix::setReadBufferSize(const qint64 size)
+{
+    QMutexLocker lock(&_mutex);
+    if (!_socket)
+        return;
+
+    _socket->setReadBufferSize(size);
+}
@@ -33,6 +33,8 @@ public:
 
     bool waitForReadyRead(const int msecs = 30000) final;
 
+    void setReadBufferSize(const qint64 size) final;
+
 protected:
     QLocalSocket   *_socket {nullptr};  //!< unix-сокет
     mutable QMutex  _mutex;             //!< мьютекс
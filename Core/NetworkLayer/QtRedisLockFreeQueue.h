@@ -0,0 +1,84 @@
+#ifndef QTREDISLOCKFREEQUEUE_H
+#define QTREDISLOCKFREEQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+//!
+//! \file QtRedisLockFreeQueue.h
+//! \class QtRedisLockFreeQueue
+//! \brief Неблокирующая очередь с несколькими производителями и одним потребителем (MPSC)
+//!
+//! push() may be called from any thread (one atomic exchange, no locks), pop() - only from the consumer thread.
+//! The elements are taken in the order of push() (FIFO).
+//!
+template<typename T>
+class QtRedisLockFreeQueue
+{
+public:
+    QtRedisLockFreeQueue()
+        : _head(new Node())
+        , _tail(_head.load(std::memory_order_relaxed))
+    {}
+
+    ~QtRedisLockFreeQueue() {
+        T value;
+        while (this->pop(value)) {}
+        delete _tail;
+    }
+
+    QtRedisLockFreeQueue(const QtRedisLockFreeQueue &) = delete;
+    QtRedisLockFreeQueue &operator=(const QtRedisLockFreeQueue &) = delete;
+
+    //!
+    //! \brief Добавить элемент в очередь (любой поток)
+    //! \param value Элемент
+    //!
+    void push(T value) {
+        Node *node = new Node(std::move(value));
+        Node *prev = _head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    //!
+    //! \brief Извлечь элемент из очереди (только поток-потребитель)
+    //! \param value Элемент
+    //! \return false, если очередь пуста
+    //!
+    //! Note: An element pushed concurrently may become visible on the next call.
+    //!
+    bool pop(T &value) {
+        Node *next = _tail->next.load(std::memory_order_acquire);
+        if (!next)
+            return false;
+        value = std::move(next->value);
+        delete _tail;
+        _tail = next;
+        return true;
+    }
+
+    //!
+    //! \brief Пуста ли очередь (только поток-потребитель)
+    //! \return
+    //!
+    bool isEmpty() const {
+        return !_tail->next.load(std::memory_order_acquire);
+    }
+
+private:
+    //!
+    //! \brief Узел очереди
+    //!
+    struct Node {
+        Node() = default;
+        explicit Node(T &&nodeValue) : value(std::move(nodeValue)) {}
+
+        std::atomic<Node*> next {nullptr};  //!< следующий узел
+        T                  value;           //!< элемент
+    };
+
+    std::atomic<Node*> _head;   //!< последний добавленный узел (производители)
+    Node               *_tail;  //!< узел-заглушка перед первым элементом (потребитель)
+};
+
+#endif // QTREDISLOCKFREEQUEUE_H
@@ -1,5 +1,8 @@
 #include "QtRedisParser.h"
 
+#include <climits>
+#include <cstring>
+
 //!
 //! Doc from: https://redis.io/docs/latest/develop/reference/protocol-spec/
 //!
@@ -747,23 +750,62 @@
 
 
 
+const int QtRedisParser::maxBulkLength;
+const int QtRedisParser::maxAggregateLength;
+
 //!
 //! \brief Создать byte-данные для Redis-а
 //! \param command Команда и ее аргументы
 //! \return
 //!
 QByteArray QtRedisParser::createRawData(const QtRedisCommand &command)
+{
+    QByteArray data;
+    QtRedisParser::appendRawData(data, command);
+    return data;
+}
+
+//!
+//! \brief Добавить byte-данные команды для Redis-а в конец буфера
+//! \param data Буфер
+//! \param command Команда и ее аргументы
+//!
+//! The exact size of the data is computed first, the buffer is resized once and the data
+//! is written in place. Arguments are binary safe (may contain '\0' and may be empty).
+//!
+void QtRedisParser::appendRawData(QByteArray &data, const QtRedisCommand &command)
+{
+    if (!command.isValid())
+        return;
+
+    const int index = data.size();
+    data.resize(index + QtRedisParser::rawDataSize(command));
+    char *buffData = data.data() + index;
+    *buffData++ = '*';
+    buffData = QtRedisParser::writeDecimal(buffData, command.size());
+    *buffData++ = '\r';
+    *buffData++ = '\n';
+    buffData = QtRedisParser::writeRawDataArgument(buffData, command.command());
+    for (const QByteArray &arg : command.commandArgv())
+        buffData = QtRedisParser::writeRawDataArgument(buffData, arg);
+}
+
+//!
+//! \brief Размер byte-данных команды для Redis-а
+//! \param command Команда и ее аргументы
+//! \return
+//!
+int QtRedisParser::rawDataSize(const QtRedisCommand &command)
 {
     if (!command.isValid())
-        return QByteArray();
+        return 0;
 
-    QByteArray ba;
-    ba += QString("*%1\r\n").arg(command.size()).toUtf8();
-    ba += QtRedisParser::createRawDataArgument(command.command());
+    int size = QtRedisParser::decimalLength(command.size()) + 3; // *<size>\r\n
+    size += QtRedisParser::rawDataArgumentSize(command.command());
     for (const QByteArray &arg : command.commandArgv())
-        ba += QtRedisParser::createRawDataArgument(arg);
+        size += QtRedisParser::rawDataArgumentSize(arg);
 
-    return ba;
+    return size;
 }
 
 //!
@@ -773,18 +815,23 @@ QByteArray QtRedisParser::createRawData(const QtRedisCommand &command)
 //!
 QtRedisReply QtRedisParser::parseRawData(const QByteArray &data, QString &error, bool *ok)
 {
-    QByteArray buffData = data;
+    if (ok)
+        *ok = false;
+
+    int index = 0;
     QtRedisReply replyArray;
     while (true) {
-        const QtRedisReply reply = QtRedisParser::parseRawDataTypes(buffData, error, ok);
-        if (ok && *ok == false)
+        bool isOk = false;
+        const QtRedisReply reply = QtRedisParser::parseRawDataTypes(data, index, error, &isOk);
+        if (!isOk)
             return QtRedisReply();
         replyArray.appendArrayValue(reply);
-        if (buffData.isEmpty())
+        if (index >= data.size())
             break;
     }
     replyArray.setType(QtRedisReply::ReplyType::Array);
-    replyArray.setRawValue(data);
+    if (ok)
+        *ok = true;
     return replyArray;
 }
 
@@ -801,20 +848,101 @@ bool QtRedisParser::isFullRawData(const QByteArray &data, QString &error)
 }
 
 //!
-//! \brief Создать строку-команду для Redis-а
+//! \brief Создать строку-аргумент для Redis-а
 //! \param arg Аргумент
 //! \return
 //!
+//! Note: The argument is binary safe (may contain '\0' and may be empty).
+//!
 QByteArray QtRedisParser::createRawDataArgument(const QByteArray &arg)
 {
-    if (arg.isEmpty()) {
-        qWarning() << qPrintable(QString("[QtRedisParser][createRawDataArgument] arg is Empty!"));
-        return QByteArray();
-    }
-    return QString("$%1\r\n%2\r\n")
-            .arg(arg.length())
-            .arg(arg.constData())
-            .toUtf8();
+    QByteArray data(QtRedisParser::rawDataArgumentSize(arg), Qt::Uninitialized);
+    QtRedisParser::writeRawDataArgument(data.data(), arg);
+    return data;
+}
+
+//!
+//! \brief Размер строки-аргумента для Redis-а
+//! \param arg Аргумент
+//! \return
+//!
+int QtRedisParser::rawDataArgumentSize(const QByteArray &arg)
+{
+    return QtRedisParser::decimalLength(arg.size()) + arg.size() + 5; // $<size>\r\n<arg>\r\n
+}
+
+//!
+//! \brief Записать строку-аргумент для Redis-а
+//! \param dest Указатель на буфер (размер не меньше rawDataArgumentSize())
+//! \param arg Аргумент
+//! \return Указатель на конец записанных данных
+//!
+char *QtRedisParser::writeRawDataArgument(char *dest, const QByteArray &arg)
+{
+    *dest++ = '$';
+    dest = QtRedisParser::writeDecimal(dest, arg.size());
+    *dest++ = '\r';
+    *dest++ = '\n';
+    if (!arg.isEmpty()) {
+        memcpy(dest, arg.constData(), static_cast<size_t>(arg.size()));
+        dest += arg.size();
+    }
+    *dest++ = '\r';
+    *dest++ = '\n';
+    return dest;
+}
+
+//!
+//! \brief Количество десятичных цифр числа
+//! \param value Число (не отрицательное)
+//! \return
+//!
+int QtRedisParser::decimalLength(int value)
+{
+    int length = 1;
+    while (value >= 100) {
+        value /= 100;
+        length += 2;
+    }
+    if (value >= 10)
+        length++;
+
+    return length;
+}
+
+//!
+//! \brief Записать число в десятичном виде
+//! \param dest Указатель на буфер (размер не меньше decimalLength())
+//! \param value Число (не отрицательное)
+//! \return Указатель на конец записанных данных
+//!
+//! Two digits are written per division (by the table of the pairs of digits).
+//!
+char *QtRedisParser::writeDecimal(char *dest, int value)
+{
+    static const char digits[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    char *end = dest + QtRedisParser::decimalLength(value);
+    char *buffDest = end;
+    while (value >= 100) {
+        const int index = (value % 100) * 2;
+        value /= 100;
+        *--buffDest = digits[index + 1];
+        *--buffDest = digits[index];
+    }
+    if (value >= 10) {
+        const int index = value * 2;
+        *--buffDest = digits[index + 1];
+        *--buffDest = digits[index];
+    } else {
+        *--buffDest = static_cast<char>('0' + value);
+    }
+    return end;
 }
 
 //!
@@ -823,7 +951,7 @@ QByteArray QtRedisParser::createRawDataArgument(const QByteArray &arg)
 //! \param index Индекс конца разобранных данных (включает символы '\r\n')
 //! \return
 //!
-QtRedisReply QtRedisParser::parseRawDataTypes(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataTypes(const QByteArray &data, int &index, QString &error, bool *ok)
 {
     // clear err & ok
     error.clear();
@@ -835,29 +963,66 @@ QtRedisReply QtRedisParser::parseRawDataTypes(QByteArray &data, QString &error,
         error = QString("Parse raw data failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
     // state string
-    if (data.at(0) == '+')
-        return QtRedisParser::parseRawDataToState(data, error, ok);
+    if (data.at(index) == '+')
+        return QtRedisParser::parseRawDataToState(data, index, error, ok);
 
     // error string
-    else if (data.at(0) == '-')
-        return QtRedisParser::parseRawDataToError(data, error, ok);
+    else if (data.at(index) == '-')
+        return QtRedisParser::parseRawDataToError(data, index, error, ok);
 
     // integer
-    else if (data.at(0) == ':')
-        return QtRedisParser::parseRawDataToInt(data, error, ok);
+    else if (data.at(index) == ':')
+        return QtRedisParser::parseRawDataToInt(data, index, error, ok);
 
     // string
-    else if (data.at(0) == '$')
-        return QtRedisParser::parseRawDataToString(data, error, ok);
+    else if (data.at(index) == '$')
+        return QtRedisParser::parseRawDataToString(data, index, error, ok);
 
     // array
-    else if (data.at(0) == '*')
-        return QtRedisParser::parseRawDataToArray(data, error, ok);
+    else if (data.at(index) == '*')
+        return QtRedisParser::parseRawDataToArray(data, index, error, ok);
+
+    // RESP3 null, double, boolean, big number
+    else if (data.at(index) == '_'
+             || data.at(index) == ','
+             || data.at(index) == '#'
+             || data.at(index) == '(')
+        return QtRedisParser::parseRawDataToSimple(data, index, error, ok);
+
+    // RESP3 blob error, verbatim string
+    else if (data.at(index) == '!'
+             || data.at(index) == '=')
+        return QtRedisParser::parseRawDataToString(data, index, error, ok);
+
+    // RESP3 map, set, push
+    else if (data.at(index) == '%'
+             || data.at(index) == '~'
+             || data.at(index) == '>')
+        return QtRedisParser::parseRawDataToArray(data, index, error, ok);
+
+    // RESP3 attribute (attached to the next element)
+    else if (data.at(index) == '|') {
+        bool buffOk = false;
+        const QtRedisReply attribute = QtRedisParser::parseRawDataToArray(data, index, error, &buffOk);
+        if (!buffOk)
+            return QtRedisReply();
+        QtRedisReply reply = QtRedisParser::parseRawDataTypes(data, index, error, &buffOk);
+        if (!buffOk)
+            return QtRedisReply();
+        reply._attributeValue = attribute.arrayValue_ref();
+        if (ok)
+            *ok = true;
+        return reply;
+    }
 
     else
-        error = QString("Parse raw data failed! Invalid type (symbol at 0 = \"%1\")!").arg(data.at(0));
+        error = QString("Parse raw data failed! Invalid type (symbol at %1 = \"%2\")!").arg(index).arg(data.at(index));
 
     return QtRedisReply();
 }
@@ -880,7 +1045,7 @@ QtRedisReply QtRedisParser::parseRawDataTypes(QByteArray &data, QString &error,
 //! When Redis replies with a Simple String, a client library should return to the caller a string composed of the first character after the '+' up to the end of the string,
 //! excluding the final CRLF bytes.
 //!
-QtRedisReply QtRedisParser::parseRawDataToState(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataToState(const QByteArray &data, int &index, QString &error, bool *ok)
 {
     // clear err & ok
     error.clear();
@@ -892,24 +1057,27 @@ QtRedisReply QtRedisParser::parseRawDataToState(QByteArray &data, QString &error
         error = QString("Parse raw data-to-state failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
-    // state string
-    if (data.at(0) != '+') {
-        error = QString("Parse raw data-to-state failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(0));
+    if (data.at(index) != '+') {
+        error = QString("Parse raw data-to-state failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
         return QtRedisReply();
     }
-    const int buffIndex = data.indexOf("\r\n");
+    const int buffIndex = data.indexOf("\r\n", index);
     if (buffIndex == -1) {
         error = QString("Parse raw data-to-state failed (incorrect data - line break character not found)!");
         return QtRedisReply();
     }
 
     QtRedisReply reply(QtRedisReply::ReplyType::Status);
-    reply.setRawValue(data.mid(1, buffIndex - 1));
+    reply.setRawValue(data.mid(index + 1, buffIndex - index - 1));
     if (ok)
         *ok = true;
 
-    data.remove(0, buffIndex + 2); // remove parsed data (index + 2 chars (\r\n))
+    index = buffIndex + 2; // move to the next element (index + 2 chars (\r\n))
     return reply;
 }
 
@@ -919,7 +1087,7 @@ QtRedisReply QtRedisParser::parseRawDataToState(QByteArray &data, QString &error
 //! \param index Индекс конца разобранных данных (включает символы '\r\n')
 //! \return
 //!
-QtRedisReply QtRedisParser::parseRawDataToError(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataToError(const QByteArray &data, int &index, QString &error, bool *ok)
 {
     // clear err & ok
     error.clear();
@@ -931,25 +1099,28 @@ QtRedisReply QtRedisParser::parseRawDataToError(QByteArray &data, QString &error
         error = QString("Parse raw data-to-error failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
-    // error string
-    if (data.at(0) != '-') {
-        error = QString("Parse raw data-to-error failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(0));
+    if (data.at(index) != '-') {
+        error = QString("Parse raw data-to-error failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
         return QtRedisReply();
     }
-    const int buffIndex = data.indexOf("\r\n");
+    const int buffIndex = data.indexOf("\r\n", index);
     if (buffIndex == -1) {
         error = QString("Parse raw data-to-error failed (incorrect data - line break character not found)!");
         return QtRedisReply();
     }
 
     QtRedisReply reply(QtRedisReply::ReplyType::Error);
-    reply.setRawValue(data.mid(1, buffIndex - 1));
+    reply.setRawValue(data.mid(index + 1, buffIndex - index - 1));
     error = reply.strValue(); // save error message from reply
     if (ok)
-        *ok = true; // set parsing success
+        *ok = true;
 
-    data.remove(0, buffIndex + 2); // remove parsed data (index + 2 chars (\r\n))
+    index = buffIndex + 2; // move to the next element (index + 2 chars (\r\n))
     return reply;
 }
 
@@ -959,9 +1130,9 @@ QtRedisReply QtRedisParser::parseRawDataToError(QByteArray &data, QString &error
 //! \param index Индекс конца разобранных данных (включает символы '\r\n')
 //! \return
 //!
-QtRedisReply QtRedisParser::parseRawDataToInt(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataToInt(const QByteArray &data, int &index, QString &error, bool *ok)
 {
-    // clear ok
+    // clear err & ok
     error.clear();
     if (ok)
         *ok = false;
@@ -971,24 +1142,27 @@ QtRedisReply QtRedisParser::parseRawDataToInt(QByteArray &data, QString &error,
         error = QString("Parse raw data-to-int failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
-    // integer
-    if (data.at(0) != ':') {
-        error = QString("Parse raw data-to-int failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(0));
+    if (data.at(index) != ':') {
+        error = QString("Parse raw data-to-int failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
         return QtRedisReply();
     }
-    const int buffIndex = data.indexOf("\r\n");
+    const int buffIndex = data.indexOf("\r\n", index);
     if (buffIndex == -1) {
         error = QString("Parse raw data-to-int failed (incorrect data - line break character not found)!");
         return QtRedisReply();
     }
 
     QtRedisReply reply(QtRedisReply::ReplyType::Integer);
-    reply.setRawValue(data.mid(1, buffIndex - 1));
+    reply.setRawValue(data.mid(index + 1, buffIndex - index - 1));
     if (ok)
         *ok = true;
 
-    data.remove(0, buffIndex + 2); // remove parsed data (index + 2 chars (\r\n))
+    index = buffIndex + 2; // move to the next element (index + 2 chars (\r\n))
     return reply;
 }
 
@@ -998,7 +1172,7 @@ QtRedisReply QtRedisParser::parseRawDataToInt(QByteArray &data, QString &error,
 //! \param index Индекс конца разобранных данных (включает символы '\r\n')
 //! \return
 //!
-QtRedisReply QtRedisParser::parseRawDataToString(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataToString(const QByteArray &data, int &index, QString &error, bool *ok)
 {
     // clear ok
     error.clear();
@@ -1010,52 +1184,69 @@ QtRedisReply QtRedisParser::parseRawDataToString(QByteArray &data, QString &erro
         error = QString("Parse raw data-to-string failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
     // string
     // $3\r\nfoo\r\n
     // $-1\r\n - Nil
-    if (data.at(0) != '$') {
-        error = QString("Parse raw data-to-string failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(0));
+    // !3\r\nERR\r\n - RESP3 blob error
+    // =7\r\ntxt:foo\r\n - RESP3 verbatim string
+    if (data.at(index) != '$'
+        && data.at(index) != '!'
+        && data.at(index) != '=') {
+        error = QString("Parse raw data-to-string failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
         return QtRedisReply();
     }
-    const int buffIndexLen = data.indexOf("\r\n");
+    const QtRedisReply::ReplyType replyType = QtRedisParser::replyTypeFromSymbol(data.at(index));
+    const int buffIndexLen = data.indexOf("\r\n", index);
     if (buffIndexLen < 0) {
         error = QString("Parse raw data-to-string failed (incorrect data - line break character for string-length not found)!");
         return QtRedisReply();
     }
 
     // get strlen...
-    const QByteArray strLenData = data.mid(1, buffIndexLen - 1);
-    const qlonglong strLen = strLenData.toLongLong();
+    bool isLenOk = false;
+    const qlonglong strLen = QtRedisParser::parseRawDataLength(data, index + 1, buffIndexLen, &isLenOk);
+    if (!isLenOk) {
+        error = QString("Parse raw data-to-string failed (incorrect data - invalid string-length)!");
+        return QtRedisReply();
+    }
+    if (strLen > QtRedisParser::maxBulkLength) {
+        error = QString("Parse raw data-to-string failed (string-length exceeds the limit)!");
+        return QtRedisReply();
+    }
     // check is Nil object (Nil string)
     if (strLen < 0) {
         if (ok)
             *ok = true;
-        data.remove(0, buffIndexLen + 2); // remove type + len
+        index = buffIndexLen + 2; // move to the next element (type + len)
         return QtRedisReply();
     }
 
     // get data...
-    data.remove(0, buffIndexLen + 2); // remove type + strlen
-    const int buffIndexData = data.indexOf("\r\n", strLen);
-    if (buffIndexData == -1) {
+    const int buffIndexData = buffIndexLen + 2;
+    if (static_cast<qlonglong>(data.size()) < buffIndexData + strLen + 2
+        || data.at(buffIndexData + static_cast<int>(strLen)) != '\r'
+        || data.at(buffIndexData + static_cast<int>(strLen) + 1) != '\n') {
         error = QString("Parse raw data-to-string failed (incorrect data - line break character for string data not found)!");
         return QtRedisReply();
     }
-    const QByteArray buffData = data.mid(0, buffIndexData);
 
-    // check data len
-    if (buffData.length() != strLen) {
-        error = QString("Parse raw data-to-string failed (incorrect length of parsed string data)!");
-        return QtRedisReply();
+    QtRedisReply reply(replyType);
+    if (replyType == QtRedisReply::ReplyType::String) {
+        reply.setRawValue(data, buffIndexData, static_cast<int>(strLen));
+    } else {
+        reply.setRawValue(data.mid(buffIndexData, static_cast<int>(strLen)));
+        if (replyType == QtRedisReply::ReplyType::Error)
+            error = reply.strValue(); // save error message from reply
     }
-
-    QtRedisReply reply(QtRedisReply::ReplyType::String);
-    reply.setRawValue(buffData);
     if (ok)
         *ok = true;
 
-    data.remove(0, buffIndexData + 2); // remove parsed data (index + 2 chars (\r\n))
+    index = buffIndexData + static_cast<int>(strLen) + 2; // move to the next element (data + 2 chars (\r\n))
     return reply;
 }
 
@@ -1065,7 +1256,7 @@ QtRedisReply QtRedisParser::parseRawDataToString(QByteArray &data, QString &erro
 //! \param index Индекс конца разобранных данных (включает символы '\r\n')
 //! \return
 //!
-QtRedisReply QtRedisParser::parseRawDataToArray(QByteArray &data, QString &error, bool *ok)
+QtRedisReply QtRedisParser::parseRawDataToArray(const QByteArray &data, int &index, QString &error, bool *ok)
 {
     // clear ok
     error.clear();
@@ -1077,34 +1268,59 @@ QtRedisReply QtRedisParser::parseRawDataToArray(QByteArray &data, QString &error
         error = QString("Parse raw data-to-array failed (data is empty)!");
         return QtRedisReply();
     }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
 
     // array
-    if (data.at(0) != '*') {
-        error = QString("Parse raw data-to-array failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(0));
+    // *2\r\n... - array
+    // %1\r\n... - RESP3 map (number of key-value pairs)
+    // ~2\r\n... - RESP3 set
+    // >2\r\n... - RESP3 push
+    // |1\r\n... - RESP3 attribute (number of key-value pairs)
+    if (data.at(index) != '*'
+        && data.at(index) != '%'
+        && data.at(index) != '~'
+        && data.at(index) != '>'
+        && data.at(index) != '|') {
+        error = QString("Parse raw data-to-array failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
         return QtRedisReply();
     }
+    const QtRedisReply::ReplyType replyType = QtRedisParser::replyTypeFromSymbol(data.at(index));
 
-    const int buffIndexLen = data.indexOf("\r\n");
+    const int buffIndexLen = data.indexOf("\r\n", index);
     if (buffIndexLen < 0) {
         error = QString("Parse raw data-to-array failed (incorrect data - line break character for array-length not found)!");
         return QtRedisReply();
     }
 
-    // get strlen...
-    const QByteArray arrayLenData = data.mid(1, buffIndexLen - 1);
-    const qlonglong arrayLen = arrayLenData.toLongLong();
+    // get array len...
+    bool isLenOk = false;
+    qlonglong arrayLen = QtRedisParser::parseRawDataLength(data, index + 1, buffIndexLen, &isLenOk);
+    if (!isLenOk) {
+        error = QString("Parse raw data-to-array failed (incorrect data - invalid array-length)!");
+        return QtRedisReply();
+    }
+    if (arrayLen > QtRedisParser::maxAggregateLength) {
+        error = QString("Parse raw data-to-array failed (array-length exceeds the limit)!");
+        return QtRedisReply();
+    }
     // check is Nil object (Nil array)
     if (arrayLen < 0) {
         if (ok)
             *ok = true;
-        data.remove(0, buffIndexLen + 2); // remove type + len
+        index = buffIndexLen + 2; // move to the next element (type + len)
         return QtRedisReply();
     }
 
+    if (replyType == QtRedisReply::ReplyType::Map
+        || replyType == QtRedisReply::ReplyType::Attribute)
+        arrayLen *= 2; // keys and values
+
     // get data...
-    data.remove(0, buffIndexLen + 2); // remove type + len
-    QtRedisReply reply = QtRedisReply(QtRedisReply::ReplyType::Array);
-    reply.setRawValue(data);
+    index = buffIndexLen + 2; // move to the first array element (type + len)
+    QtRedisReply reply = QtRedisReply(replyType);
     if (arrayLen == 0) {
         if (ok)
             *ok = true;
@@ -1113,33 +1329,169 @@ QtRedisReply QtRedisParser::parseRawDataToArray(QByteArray &data, QString &error
     }
 
     // parse array args
-    while (true) {
+    while (reply.arrayValueSize() < arrayLen
+           && index < data.size()) {
         bool buffOk = false;
-        QtRedisReply buffReply = QtRedisParser::parseRawDataTypes(data, error, &buffOk);
+        QtRedisReply buffReply = QtRedisParser::parseRawDataTypes(data, index, error, &buffOk);
         if (!buffOk)
             return QtRedisReply();
 
         reply.appendArrayValue(buffReply);
-        if (data.isEmpty())
-            break;
-        if (reply.arrayValueSize() == arrayLen)
-            break;
     }
-    if (arrayLen != reply.arrayValue().size()) {
+    if (arrayLen != reply.arrayValueSize()) {
         error = QString("Parse raw data-to-array failed (incorrect length of parsed array data)!");
         return QtRedisReply();
     }
     if (ok)
         *ok = true;
 
-    if (!data.isEmpty()) {
-        const int oldRawSize = reply.rawValue_ref().size();
-        const int newRawSize = data.size();
-        reply.setRawValue(reply.rawValue_ref().left(oldRawSize - newRawSize));
+    return reply;
+}
+
+//!
+//! \brief Преобразовать ответ от Redis-а в простой объект RESP3 (Nil, Double, Boolean, BigNumber)
+//! \param data "Сырые" данные
+//! \param index Индекс конца разобранных данных (включает символы '\r\n')
+//! \return
+//!
+//! _\r\n - Null
+//! ,1.23\r\n - Double
+//! #t\r\n - Boolean
+//! (3492890328409238509324850943850943825024385\r\n - Big number
+//!
+QtRedisReply QtRedisParser::parseRawDataToSimple(const QByteArray &data, int &index, QString &error, bool *ok)
+{
+    // clear err & ok
+    error.clear();
+    if (ok)
+        *ok = false;
+
+    // check data
+    if (data.isEmpty()) {
+        error = QString("Parse raw data-to-simple failed (data is empty)!");
+        return QtRedisReply();
+    }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return QtRedisReply();
+    }
+
+    if (data.at(index) != '_'
+        && data.at(index) != ','
+        && data.at(index) != '#'
+        && data.at(index) != '(') {
+        error = QString("Parse raw data-to-simple failed! Invalid type (symbol at %1 = \"%2\")").arg(index).arg(data.at(index));
+        return QtRedisReply();
     }
+    const int buffIndex = data.indexOf("\r\n", index);
+    if (buffIndex == -1) {
+        error = QString("Parse raw data-to-simple failed (incorrect data - line break character not found)!");
+        return QtRedisReply();
+    }
+
+    QtRedisReply reply(QtRedisParser::replyTypeFromSymbol(data.at(index)));
+    if (!reply.isNil())
+        reply.setRawValue(data.mid(index + 1, buffIndex - index - 1));
+    if (ok)
+        *ok = true;
+
+    index = buffIndex + 2; // move to the next element (index + 2 chars (\r\n))
     return reply;
 }
 
+//!
+//! \brief Получить тип объекта по символу типа RESP
+//! \param symbol Символ типа
+//! \param ok Состояние об ошибке
+//! \return
+//!
+//! Note: If the symbol is unknown, returns ReplyType::Nil and ok = false.
+//!
+QtRedisReply::ReplyType QtRedisParser::replyTypeFromSymbol(const char symbol, bool *ok)
+{
+    if (ok)
+        *ok = true;
+    switch (symbol) {
+        case '+':
+            return QtRedisReply::ReplyType::Status;
+        case '-':
+        case '!':
+            return QtRedisReply::ReplyType::Error;
+        case ':':
+            return QtRedisReply::ReplyType::Integer;
+        case '$':
+            return QtRedisReply::ReplyType::String;
+        case '*':
+            return QtRedisReply::ReplyType::Array;
+        case '_':
+            return QtRedisReply::ReplyType::Nil;
+        case ',':
+            return QtRedisReply::ReplyType::Double;
+        case '#':
+            return QtRedisReply::ReplyType::Boolean;
+        case '(':
+            return QtRedisReply::ReplyType::BigNumber;
+        case '=':
+            return QtRedisReply::ReplyType::Verbatim;
+        case '%':
+            return QtRedisReply::ReplyType::Map;
+        case '~':
+            return QtRedisReply::ReplyType::Set;
+        case '>':
+            return QtRedisReply::ReplyType::Push;
+        case '|':
+            return QtRedisReply::ReplyType::Attribute;
+        default:
+            break;
+    }
+    if (ok)
+        *ok = false;
+    return QtRedisReply::ReplyType::Nil;
+}
+
+//!
+//! \brief Получить длину строки или массива из заголовка элемента
+//! \param data "Сырые" данные
+//! \param index Индекс начала значения длины
+//! \param endIndex Индекс символов '\r\n' конца заголовка
+//! \return
+//!
+//! Note: The value is parsed in place, without creating a temporary copy of the data.
+//! Note: If the value is incorrect or overflows qlonglong, returns -1 and sets ok to false.
+//! Warn: The value is not limited, check it by maxBulkLength (maxAggregateLength) before the use!
+//!
+qlonglong QtRedisParser::parseRawDataLength(const QByteArray &data, const int index, const int endIndex, bool *ok)
+{
+    if (ok)
+        *ok = false;
+    if (index >= endIndex)
+        return -1;
+
+    const char *buffData = data.constData();
+    int buffIndex = index;
+    bool isNegative = false;
+    if (buffData[buffIndex] == '-') {
+        isNegative = true;
+        buffIndex++;
+    }
+    if (buffIndex >= endIndex)
+        return -1;
+
+    qlonglong value = 0;
+    for (; buffIndex < endIndex; buffIndex++) {
+        const char ch = buffData[buffIndex];
+        if (ch < '0' || ch > '9')
+            return -1;
+        const int digit = ch - '0';
+        if (value > (LLONG_MAX - digit) / 10)
+            return -1; // overflow
+        value = value * 10 + digit;
+    }
+    if (ok)
+        *ok = true;
+    return isNegative ? -value : value;
+}
+
 bool QtRedisParser::isFullRawDataTypes(const QByteArray &data, int &index, QString &error)
 {
     // clear err & ok
@@ -1174,6 +1526,29 @@ bool QtRedisParser::isFullRawDataTypes(const QByteArray &data, int &index, QStri
     else if (data.at(index) == '*')
         return QtRedisParser::isFullRawDataToArray(data, index, error);
 
+    // RESP3 null, double, boolean, big number
+    else if (data.at(index) == '_'
+             || data.at(index) == ','
+             || data.at(index) == '#'
+             || data.at(index) == '(')
+        return QtRedisParser::isFullRawDataToSimple(data, index, error);
+
+    // RESP3 blob error, verbatim string
+    else if (data.at(index) == '!'
+             || data.at(index) == '=')
+        return QtRedisParser::isFullRawDataToString(data, index, error);
+
+    // RESP3 map, set, push
+    else if (data.at(index) == '%'
+             || data.at(index) == '~'
+             || data.at(index) == '>')
+        return QtRedisParser::isFullRawDataToArray(data, index, error);
+
+    // RESP3 attribute (attached to the next element)
+    else if (data.at(index) == '|')
+        return (QtRedisParser::isFullRawDataToArray(data, index, error)
+                && QtRedisParser::isFullRawDataTypes(data, index, error));
+
     else
         error = QString("Parse raw data failed! Invalid type (symbol at 0 = \"%1\")!").arg(data.at(index));
 
@@ -1287,7 +1662,11 @@ bool QtRedisParser::isFullRawDataToString(const QByteArray &data, int &index, QS
     // string
     // $3\r\nfoo\r\n
     // $-1\r\n - Nil
-    if (data.at(index) != '$') {
+    // !3\r\nERR\r\n - RESP3 blob error
+    // =7\r\ntxt:foo\r\n - RESP3 verbatim string
+    if (data.at(index) != '$'
+        && data.at(index) != '!'
+        && data.at(index) != '=') {
         error = QString("Parse raw data-to-string failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(index));
         return false;
     }
@@ -1298,8 +1677,12 @@ bool QtRedisParser::isFullRawDataToString(const QByteArray &data, int &index, QS
     }
 
     // get strlen...
-    const QByteArray strLenData = data.mid(index + 1, buffIndexLen - 1 - index);
-    const qlonglong strLen = strLenData.toLongLong();
+    bool isLenOk = false;
+    const qlonglong strLen = QtRedisParser::parseRawDataLength(data, index + 1, buffIndexLen, &isLenOk);
+    if (!isLenOk || strLen > QtRedisParser::maxBulkLength) {
+        error = QString("Parse raw data-to-string failed (incorrect data - invalid string-length)!");
+        return false;
+    }
     // check is Nil object (Nil string)
     if (strLen < 0) {
         // change index pos
@@ -1308,7 +1691,7 @@ bool QtRedisParser::isFullRawDataToString(const QByteArray &data, int &index, QS
     }
 
     // get data...
-    const int buffIndexData = data.indexOf("\r\n", buffIndexLen + 2 + strLen);
+    const int buffIndexData = data.indexOf("\r\n", buffIndexLen + 2 + static_cast<int>(strLen));
     if (buffIndexData == -1) {
         error = QString("Parse raw data-to-string failed (incorrect data - line break character for string data not found)!");
         return false;
@@ -1333,10 +1716,15 @@ bool QtRedisParser::isFullRawDataToArray(const QByteArray &data, int &index, QSt
     }
 
     // array
-    if (data.at(index) != '*') {
+    if (data.at(index) != '*'
+        && data.at(index) != '%'
+        && data.at(index) != '~'
+        && data.at(index) != '>'
+        && data.at(index) != '|') {
         error = QString("Parse raw data-to-array failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(index));
         return false;
     }
+    const bool isPairs = (data.at(index) == '%' || data.at(index) == '|');
 
     const int buffIndexLen = data.indexOf("\r\n", index);
     if (buffIndexLen < 0) {
@@ -1344,9 +1732,15 @@ bool QtRedisParser::isFullRawDataToArray(const QByteArray &data, int &index, QSt
         return false;
     }
 
-    // get strlen...
-    const QByteArray arrayLenData = data.mid(index + 1, buffIndexLen - 1 - index);
-    const qlonglong arrayLen = arrayLenData.toLongLong();
+    // get array len...
+    bool isLenOk = false;
+    qlonglong arrayLen = QtRedisParser::parseRawDataLength(data, index + 1, buffIndexLen, &isLenOk);
+    if (!isLenOk || arrayLen > QtRedisParser::maxAggregateLength) {
+        error = QString("Parse raw data-to-array failed (incorrect data - invalid array-length)!");
+        return false;
+    }
+    if (isPairs)
+        arrayLen *= 2; // keys and values
     // check is Nil object (Nil array)
     if (arrayLen < 0) {
         // change index pos
@@ -1381,3 +1775,36 @@ bool QtRedisParser::isFullRawDataToArray(const QByteArray &data, int &index, QSt
     }
     return true;
 }
+
+bool QtRedisParser::isFullRawDataToSimple(const QByteArray &data, int &index, QString &error)
+{
+    // clear err & ok
+    error.clear();
+    // check data
+    if (data.isEmpty()) {
+        error = QString("Parse raw data-to-simple failed (data is empty)!");
+        return false;
+    }
+    if (index >= data.size()) {
+        error = QString("Parse raw data failed (index exceeds data size)!");
+        return false;
+    }
+
+    // RESP3 null, double, boolean, big number
+    if (data.at(index) != '_'
+        && data.at(index) != ','
+        && data.at(index) != '#'
+        && data.at(index) != '(') {
+        error = QString("Parse raw data-to-simple failed! Invalid type (symbol at 0 = \"%1\")").arg(data.at(index));
+        return false;
+    }
+    const int buffIndex = data.indexOf("\r\n", index);
+    if (buffIndex == -1) {
+        error = QString("Parse raw data-to-simple failed (incorrect data - line break character not found)!");
+        return false;
+    }
+
+    // change index pos
+    index = buffIndex + 2;
+    return true;
+}
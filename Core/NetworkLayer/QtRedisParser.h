@@ -14,24 +14,37 @@
 class QtRedisParser
 {
 public:
+    static const int maxBulkLength = 512 * 1024 * 1024;       //!< максимальная длина строки (proto-max-bulk-len по умолчанию)
+    static const int maxAggregateLength = 512 * 1024 * 1024;  //!< максимальное количество элементов массива (пар словаря)
+
     QtRedisParser() = default;
     ~QtRedisParser() = default;
 
     static QByteArray createRawData(const QtRedisCommand &command);
+    static void appendRawData(QByteArray &data, const QtRedisCommand &command);
+    static int rawDataSize(const QtRedisCommand &command);
 
     static QtRedisReply parseRawData(const QByteArray &data, QString &error, bool *ok = 0);
 
     static bool isFullRawData(const QByteArray &data, QString &error);
 
+    static qlonglong parseRawDataLength(const QByteArray &data, const int index, const int endIndex, bool *ok = 0);
+    static QtRedisReply::ReplyType replyTypeFromSymbol(const char symbol, bool *ok = 0);
+
 protected:
     static QByteArray createRawDataArgument(const QByteArray &arg);
-
-    static QtRedisReply parseRawDataTypes(QByteArray &data, QString &error, bool *ok = 0);
-    static QtRedisReply parseRawDataToState(QByteArray &data, QString &error, bool *ok = 0);
-    static QtRedisReply parseRawDataToError(QByteArray &data, QString &error, bool *ok = 0);
-    static QtRedisReply parseRawDataToInt(QByteArray &data, QString &error, bool *ok = 0);
-    static QtRedisReply parseRawDataToString(QByteArray &data, QString &error, bool *ok = 0);
-    static QtRedisReply parseRawDataToArray(QByteArray &data, QString &error, bool *ok = 0);
+    static int rawDataArgumentSize(const QByteArray &arg);
+    static char *writeRawDataArgument(char *dest, const QByteArray &arg);
+    static int decimalLength(int value);
+    static char *writeDecimal(char *dest, int value);
+
+    static QtRedisReply parseRawDataTypes(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToState(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToError(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToInt(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToString(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToArray(const QByteArray &data, int &index, QString &error, bool *ok = 0);
+    static QtRedisReply parseRawDataToSimple(const QByteArray &data, int &index, QString &error, bool *ok = 0);
 
     static bool isFullRawDataTypes(const QByteArray &data, int &index, QString &error);
     static bool isFullRawDataToState(const QByteArray &data, int &index, QString &error);
@@ -39,6 +52,7 @@ protected:
     static bool isFullRawDataToInt(const QByteArray &data, int &index, QString &error);
     static bool isFullRawDataToString(const QByteArray &data, int &index, QString &error);
     static bool isFullRawDataToArray(const QByteArray &data, int &index, QString &error);
+    static bool isFullRawDataToSimple(const QByteArray &data, int &index, QString &error);
 };
 
 #endif // QTREDISPARSER_H
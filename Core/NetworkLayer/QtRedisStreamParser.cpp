@@ -0,0 +1,524 @@
+#include "QtRedisStreamParser.h"
+#include "QtRedisParser.h"
+
+//!
+//! \brief Режим разбора ответов
+//! \return
+//!
+QtRedisStreamParser::Mode QtRedisStreamParser::mode() const
+{
+    return _mode;
+}
+
+//!
+//! \brief Задать режим разбора ответов
+//! \param mode Режим разбора ответов
+//!
+//! The parser state is not cleared: unparsed data, parsed replies and push replies are kept.
+//!
+//! Note: If a reply is partially parsed, the new mode is applied from the next reply.
+//!
+void QtRedisStreamParser::setMode(const Mode mode)
+{
+    _nextMode = mode;
+    if (_frames.isEmpty())
+        this->applyNextMode();
+}
+
+//!
+//! \brief Передаются ли сообщения каналов (RESP2) в очередь внеочередных сообщений
+//! \return
+//!
+bool QtRedisStreamParser::isChannelMessagesAsPush() const
+{
+    return _isChannelMessagesAsPush;
+}
+
+//!
+//! \brief Передавать сообщения каналов (RESP2) в очередь внеочередных сообщений
+//! \param enable Флаг
+//!
+//! In RESP2 the channel messages of the subscribed connection are ordinary arrays, so they are mixed
+//! with the confirmations of the channel commands. With this flag they are queued as RESP3 push replies
+//! and are not taken as the reply of the command (see takePushReplies()).
+//!
+//! Note: Must be set only for the subscribed RESP2 connection (an array reply may look like a message). Not changed by clear().
+//!
+void QtRedisStreamParser::setChannelMessagesAsPush(const bool enable)
+{
+    _isChannelMessagesAsPush = enable;
+}
+
+//!
+//! \brief Добавить "сырые" данные и разобрать все полностью полученные ответы
+//! \param data "Сырые" данные
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! Note: Incomplete data is kept in the internal buffer and will be parsed when the next portion of data arrives.
+//! Warn: In case of a protocol error the parser state is cleared!
+//!
+bool QtRedisStreamParser::appendRawData(const QByteArray &data, QString &error)
+{
+    error.clear();
+    if (data.isEmpty())
+        return true;
+
+    _buffer += data;
+    while (_index < _buffer.size()) {
+        bool isNeedMoreData = false;
+        if (!this->parseNextItem(isNeedMoreData, error)) {
+            this->clear();
+            return false;
+        }
+        if (_frames.isEmpty())
+            this->applyNextMode();
+        if (isNeedMoreData)
+            break;
+    }
+    this->squeezeBuffer();
+    return true;
+}
+
+//!
+//! \brief Есть ли полностью разобранные ответы
+//! \return
+//!
+bool QtRedisStreamParser::hasReplies() const
+{
+    return (this->repliesCount() > 0);
+}
+
+//!
+//! \brief Количество полностью разобранных ответов
+//! \return
+//!
+int QtRedisStreamParser::repliesCount() const
+{
+    if (_mode == Mode::Tree)
+        return _replyTrees.size();
+
+    return _replies.size();
+}
+
+//!
+//! \brief Есть ли не до конца полученные данные
+//! \return
+//!
+bool QtRedisStreamParser::hasPartialData() const
+{
+    return (!_frames.isEmpty() || _index < _buffer.size());
+}
+
+//!
+//! \brief Забрать первый разобранный ответ
+//! \return
+//!
+//! Note: If there are no parsed replies, returns the Nil object.
+//!
+QtRedisReply QtRedisStreamParser::takeReply()
+{
+    if (_replies.isEmpty())
+        return QtRedisReply();
+
+    return _replies.takeFirst();
+}
+
+//!
+//! \brief Забрать разобранные ответы в виде массива
+//! \param count Количество ответов (если < 0 - все разобранные ответы)
+//! \return
+//!
+QtRedisReply QtRedisStreamParser::takeReplies(const int count)
+{
+    int buffCount = _replies.size();
+    if (count >= 0 && count < buffCount)
+        buffCount = count;
+
+    QtRedisReply replyArray(QtRedisReply::ReplyType::Array);
+    for (int i = 0; i < buffCount; i++)
+        replyArray.appendArrayValue(_replies.takeFirst());
+
+    return replyArray;
+}
+
+//!
+//! \brief Забрать первый разобранный ответ в компактном виде
+//! \return
+//!
+//! Note: Used in Mode::Tree. If there are no parsed replies, returns the invalid object.
+//!
+QtRedisReplyTree QtRedisStreamParser::takeReplyTree()
+{
+    if (_replyTrees.isEmpty())
+        return QtRedisReplyTree();
+
+    return _replyTrees.takeFirst();
+}
+
+//!
+//! \brief Есть ли разобранные внеочередные сообщения (RESP3 push)
+//! \return
+//!
+bool QtRedisStreamParser::hasPushReplies() const
+{
+    return !_pushReplies.isEmpty();
+}
+
+//!
+//! \brief Забрать разобранные внеочередные сообщения (RESP3 push) в виде массива
+//! \return
+//!
+//! Note: Push replies are not counted in repliesCount() and are not returned by takeReplies().
+//!
+QtRedisReply QtRedisStreamParser::takePushReplies()
+{
+    QtRedisReply replyArray(QtRedisReply::ReplyType::Array);
+    while (!_pushReplies.isEmpty())
+        replyArray.appendArrayValue(_pushReplies.takeFirst());
+
+    return replyArray;
+}
+
+//!
+//! \brief Очистить очередь разобранных ответов
+//!
+//! Note: Incomplete data and push replies are not cleared.
+//!
+void QtRedisStreamParser::clearReplies()
+{
+    _replies.clear();
+    _replyTrees.clear();
+}
+
+//!
+//! \brief Очистить состояние объекта
+//!
+void QtRedisStreamParser::clear()
+{
+    _buffer.clear();
+    _index = 0;
+    _frames.clear();
+    _replies.clear();
+    _attribute.clear();
+    _tree = QtRedisReplyTree();
+    _treeIndex = 0;
+    _replyTrees.clear();
+    _pushReplies.clear();
+    _mode = _nextMode;
+}
+
+//!
+//! \brief Является ли ответ сообщением канала
+//! \param reply Ответ
+//! \return
+//!
+//! Note: message, smessage ([type, channel, data]) and pmessage ([type, pattern, channel, data]).
+//!
+bool QtRedisStreamParser::isChannelMessage(const QtRedisReply &reply)
+{
+    if (!reply.isArray() && !reply.isPush())
+        return false;
+    if (reply.arrayValueSize() == 3)
+        return (reply.arrayValueFirst_ref().rawValueView() == "message"
+                || reply.arrayValueFirst_ref().rawValueView() == "smessage");
+    if (reply.arrayValueSize() == 4)
+        return (reply.arrayValueFirst_ref().rawValueView() == "pmessage");
+
+    return false;
+}
+
+//!
+//! \brief Разобрать следующий элемент из буфера
+//! \param isNeedMoreData Флаг необходимости получения дополнительных данных
+//! \param error Сообщение об ошибке
+//! \return
+//!
+bool QtRedisStreamParser::parseNextItem(bool &isNeedMoreData, QString &error)
+{
+    isNeedMoreData = false;
+    const int lineIndex = _buffer.indexOf("\r\n", _index);
+    if (lineIndex == -1) {
+        isNeedMoreData = true;
+        return true;
+    }
+    if (_mode == Mode::Tree && _frames.isEmpty())
+        _treeIndex = _index; // start of the new reply
+    const char type = _buffer.at(_index);
+    switch (type) {
+        // state string
+        // error string
+        // integer
+        // RESP3 null, double, boolean, big number
+        case '+':
+        case '-':
+        case ':':
+        case '_':
+        case ',':
+        case '#':
+        case '(': {
+            const int dataIndex = _index + 1;
+            _index = lineIndex + 2;
+            this->appendItem(QtRedisParser::replyTypeFromSymbol(type), dataIndex, lineIndex - dataIndex);
+            return true;
+        }
+        // string
+        // $3\r\nfoo\r\n
+        // $-1\r\n - Nil
+        // !3\r\nERR\r\n - RESP3 blob error
+        // =7\r\ntxt:foo\r\n - RESP3 verbatim string
+        case '$':
+        case '!':
+        case '=': {
+            qlonglong strLen = 0;
+            if (!this->parseLength(lineIndex, strLen)) {
+                error = QString("Parse raw data-to-string failed (incorrect string-length)!");
+                return false;
+            }
+            if (strLen > QtRedisParser::maxBulkLength) {
+                error = QString("Parse raw data-to-string failed (string-length exceeds the limit)!");
+                return false;
+            }
+            // check is Nil object (Nil string)
+            if (strLen < 0) {
+                _index = lineIndex + 2;
+                this->appendItem(QtRedisReply::ReplyType::Nil, 0, 0);
+                return true;
+            }
+            const int dataIndex = lineIndex + 2;
+            if (static_cast<qlonglong>(_buffer.size()) < dataIndex + strLen + 2) {
+                isNeedMoreData = true;
+                return true;
+            }
+            const int endIndex = dataIndex + static_cast<int>(strLen);
+            if (_buffer.at(endIndex) != '\r' || _buffer.at(endIndex + 1) != '\n') {
+                error = QString("Parse raw data-to-string failed (incorrect data - line break character for string data not found)!");
+                return false;
+            }
+            _index = endIndex + 2;
+            this->appendItem(QtRedisParser::replyTypeFromSymbol(type), dataIndex, static_cast<int>(strLen));
+            return true;
+        }
+        // array
+        // *2\r\n...
+        // *-1\r\n - Nil
+        // %1\r\n... - RESP3 map (number of key-value pairs)
+        // ~2\r\n... - RESP3 set
+        // >2\r\n... - RESP3 push
+        // |1\r\n... - RESP3 attribute (number of key-value pairs)
+        case '*':
+        case '%':
+        case '~':
+        case '>':
+        case '|': {
+            qlonglong arrayLen = 0;
+            if (!this->parseLength(lineIndex, arrayLen)) {
+                error = QString("Parse raw data-to-array failed (incorrect array-length)!");
+                return false;
+            }
+            if (arrayLen > QtRedisParser::maxAggregateLength) {
+                error = QString("Parse raw data-to-array failed (array-length exceeds the limit)!");
+                return false;
+            }
+            _index = lineIndex + 2;
+            // check is Nil object (Nil array)
+            if (arrayLen < 0) {
+                this->appendItem(QtRedisReply::ReplyType::Nil, 0, 0);
+                return true;
+            }
+            const QtRedisReply::ReplyType replyType = QtRedisParser::replyTypeFromSymbol(type);
+            if (replyType == QtRedisReply::ReplyType::Map
+                || replyType == QtRedisReply::ReplyType::Attribute)
+                arrayLen *= 2; // keys and values
+
+            this->appendArray(replyType, arrayLen);
+            return true;
+        }
+        default:
+            break;
+    }
+    error = QString("Parse raw data failed! Invalid type (symbol = \"%1\")!").arg(type);
+    return false;
+}
+
+//!
+//! \brief Получить длину строки или массива из заголовка элемента
+//! \param lineIndex Индекс символов '\r\n' конца заголовка
+//! \param length Длина
+//! \return
+//!
+bool QtRedisStreamParser::parseLength(const int lineIndex, qlonglong &length) const
+{
+    bool isOk = false;
+    length = QtRedisParser::parseRawDataLength(_buffer, _index + 1, lineIndex, &isOk);
+    return isOk;
+}
+
+//!
+//! \brief Добавить разобранный простой элемент (не массив)
+//! \param type Тип элемента
+//! \param index Индекс значения в буфере
+//! \param size Размер значения
+//!
+//! Note: String values reference the buffer (without copying).
+//!
+void QtRedisStreamParser::appendItem(const QtRedisReply::ReplyType &type, const int index, const int size)
+{
+    if (_mode == Mode::Tree) {
+        this->appendTreeNode(_tree.appendNode(type, index - _treeIndex, size));
+        return;
+    }
+    QtRedisReply reply(type);
+    if (type == QtRedisReply::ReplyType::String)
+        reply.setRawValue(_buffer, index, size);
+    else if (type != QtRedisReply::ReplyType::Nil)
+        reply.setRawValue(_buffer.mid(index, size));
+
+    this->appendReply(reply);
+}
+
+//!
+//! \brief Добавить разобранный заголовок массива
+//! \param type Тип массива (Array, Map, Set, Push, Attribute)
+//! \param size Количество элементов
+//!
+//! Note: A non-empty array is pushed to the stack of frames and is completed when all its elements are parsed.
+//!
+void QtRedisStreamParser::appendArray(const QtRedisReply::ReplyType &type, const qlonglong size)
+{
+    Frame frame;
+    frame.size = size;
+    if (_mode == Mode::Tree) {
+        frame.node = _tree.appendArrayNode(type, static_cast<int>(size));
+        if (size == 0)
+            this->appendTreeNode(frame.node);
+        else
+            _frames.append(frame);
+        return;
+    }
+    frame.reply = QtRedisReply(type);
+    if (size == 0)
+        this->appendReply(frame.reply);
+    else
+        _frames.append(frame);
+}
+
+//!
+//! \brief Добавить разобранный элемент
+//! \param reply Объект ответа
+//!
+//! If the stack of frames is not empty, the element is appended to the top frame.
+//! Completed frames are popped from the stack and appended to the parent frame,
+//! or to the queue of parsed replies.
+//!
+//! Note: The RESP3 attribute is not appended, it is attached to the next element of the same level.
+//!
+void QtRedisStreamParser::appendReply(const QtRedisReply &reply)
+{
+    QtRedisReply buffReply = reply;
+    while (true) {
+        // RESP3 attribute is attached to the next element of the same level
+        QVector<QtRedisReply> &attribute = _frames.isEmpty() ? _attribute : _frames.last().attribute;
+        if (buffReply.isAttribute()) {
+            attribute = buffReply.arrayValue_ref();
+            return;
+        }
+        if (!attribute.isEmpty()) {
+            buffReply._attributeValue = attribute;
+            attribute.clear();
+        }
+        if (_frames.isEmpty())
+            break;
+
+        Frame &frame = _frames.last();
+        frame.reply.appendArrayValue(buffReply);
+        frame.count++;
+        if (frame.count < frame.size)
+            return;
+
+        buffReply = frame.reply;
+        _frames.removeLast();
+    }
+    if (buffReply.isPush()
+        || (_isChannelMessagesAsPush && QtRedisStreamParser::isChannelMessage(buffReply)))
+        _pushReplies.append(buffReply);
+    else
+        _replies.append(buffReply);
+}
+
+//!
+//! \brief Добавить разобранный узел (Mode::Tree)
+//! \param node Индекс узла
+//!
+//! If the stack of frames is not empty, the node is set as the next element of the top frame.
+//! When the whole reply is parsed, it is moved to the queue of parsed replies.
+//!
+//! Note: RESP3 attributes are skipped (their nodes are not linked to the reply).
+//!
+void QtRedisStreamParser::appendTreeNode(const int node)
+{
+    int buffNode = node;
+    while (true) {
+        // RESP3 attributes are skipped in Mode::Tree
+        if (_tree._nodes.at(buffNode).type == QtRedisReply::ReplyType::Attribute) {
+            if (_frames.isEmpty())
+                _tree = QtRedisReplyTree();
+            return;
+        }
+        if (_frames.isEmpty())
+            break;
+
+        Frame &frame = _frames.last();
+        frame.items.append(buffNode); // grows with the parsed elements, not by the declared size
+        frame.count++;
+        if (frame.count < frame.size)
+            return;
+
+        _tree.setArrayItems(frame.node, frame.items);
+        buffNode = frame.node;
+        _frames.removeLast();
+    }
+    _tree._data = _buffer;
+    _tree._dataIndex = _treeIndex;
+    if (_tree.type() == QtRedisReply::ReplyType::Push)
+        _pushReplies.append(_tree.toReply());
+    else
+        _replyTrees.append(_tree);
+    _tree = QtRedisReplyTree();
+}
+
+//!
+//! \brief Применить отложенный режим разбора ответов
+//!
+//! Note: Called between replies only (the stack of frames is empty).
+//!
+void QtRedisStreamParser::applyNextMode()
+{
+    if (_mode == _nextMode)
+        return;
+
+    if (_nextMode == Mode::Tree)
+        _attribute.clear(); // RESP3 attributes are skipped in Mode::Tree
+    _mode = _nextMode;
+}
+
+//!
+//! \brief Удалить из буфера разобранные данные
+//!
+//! Note: Parsed elements of the incomplete frames are already stored in the frames, so they are removed too.
+//! Note: In Mode::Tree the data of the incomplete reply is kept in the buffer (nodes reference it by offsets).
+//! Note: The buffer may be shared with the parsed replies, so the rest of the data is copied instead of being moved in place.
+//!
+void QtRedisStreamParser::squeezeBuffer()
+{
+    const int index = (_mode == Mode::Tree && !_frames.isEmpty()) ? _treeIndex : _index;
+    if (index <= 0)
+        return;
+    if (index >= _buffer.size())
+        _buffer.clear();
+    else
+        _buffer = _buffer.mid(index);
+
+    _index -= index;
+    _treeIndex = qMax(0, _treeIndex - index);
+}
@@ -0,0 +1,95 @@
+#ifndef QTREDISSTREAMPARSER_H
+#define QTREDISSTREAMPARSER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QList>
+#include <QVector>
+
+#include "../QtRedisReply.h"
+#include "../QtRedisReplyTree.h"
+
+//!
+//! \file QtRedisStreamParser.h
+//! \class QtRedisStreamParser
+//! \brief Класс потокового (инкрементального) разбора ответов Redis-a
+//!
+//! Each portion of incoming data is parsed only once. Partially received
+//! aggregate replies are kept in a stack of frames, the parsing continues
+//! from the saved position when the next portion of data arrives.
+//!
+class QtRedisStreamParser
+{
+public:
+    //!
+    //! \brief Режимы разбора ответов
+    //!
+    enum class Mode {
+        Reply = 0,  //!< разбор в объекты QtRedisReply
+        Tree        //!< разбор в объекты QtRedisReplyTree
+    };
+
+    QtRedisStreamParser() = default;
+    ~QtRedisStreamParser() = default;
+
+    Mode mode() const;
+    void setMode(const Mode mode);
+
+    bool isChannelMessagesAsPush() const;
+    void setChannelMessagesAsPush(const bool enable);
+
+    bool appendRawData(const QByteArray &data, QString &error);
+
+    bool hasReplies() const;
+    int repliesCount() const;
+    bool hasPartialData() const;
+
+    QtRedisReply takeReply();
+    QtRedisReply takeReplies(const int count = -1);
+    QtRedisReplyTree takeReplyTree();
+
+    bool hasPushReplies() const;
+    QtRedisReply takePushReplies();
+
+    void clearReplies();
+    void clear();
+
+    static bool isChannelMessage(const QtRedisReply &reply);
+
+protected:
+    //!
+    //! \brief Незавершенный агрегатный ответ (массив)
+    //!
+    struct Frame {
+        QtRedisReply          reply;     //!< объект ответа (Mode::Reply)
+        QVector<QtRedisReply> attribute; //!< атрибуты RESP3 для следующего элемента (Mode::Reply)
+        int                   node {-1}; //!< индекс узла массива (Mode::Tree)
+        QVector<int>          items;     //!< индексы узлов разобранных элементов (Mode::Tree)
+        qlonglong             count {0}; //!< количество разобранных элементов
+        qlonglong             size {0};  //!< ожидаемое количество элементов
+    };
+
+    Mode                    _mode {Mode::Reply};    //!< режим разбора ответов
+    Mode                    _nextMode {Mode::Reply}; //!< режим разбора следующего ответа (см. setMode())
+    bool                    _isChannelMessagesAsPush {false}; //!< передавать ли сообщения каналов (RESP2) в очередь push
+    QByteArray              _buffer;                //!< буфер неразобранных данных
+    int                     _index {0};             //!< текущая позиция разбора в буфере
+    QVector<Frame>          _frames;                //!< стек незавершенных агрегатных ответов
+    QList<QtRedisReply>     _replies;               //!< очередь полностью разобранных ответов (Mode::Reply)
+    QVector<QtRedisReply>   _attribute;             //!< атрибуты RESP3 для следующего ответа (Mode::Reply)
+    QtRedisReplyTree        _tree;                  //!< разбираемый ответ (Mode::Tree)
+    int                     _treeIndex {0};         //!< позиция начала разбираемого ответа в буфере (Mode::Tree)
+    QList<QtRedisReplyTree> _replyTrees;            //!< очередь полностью разобранных ответов (Mode::Tree)
+    QList<QtRedisReply>     _pushReplies;           //!< очередь полностью разобранных внеочередных сообщений (RESP3 push)
+
+    bool parseNextItem(bool &isNeedMoreData, QString &error);
+    bool parseLength(const int lineIndex, qlonglong &length) const;
+    void appendItem(const QtRedisReply::ReplyType &type, const int index, const int size);
+    void appendArray(const QtRedisReply::ReplyType &type, const qlonglong size);
+    void appendReply(const QtRedisReply &reply);
+    void appendTreeNode(const int node);
+    void applyNextMode();
+    void squeezeBuffer();
+};
+
+#endif // QTREDISSTREAMPARSER_H
@@ -3,8 +3,10 @@
 #include "QtRedisContextTcp.h"
 #include "QtRedisContextSsl.h"
 #include "QtRedisContextUnix.h"
+#include "QtRedisContextIo.h"
 
 #include <QMetaType>
+#include <QRandomGenerator>
 #include <QDebug>
 
 //!
@@ -13,8 +15,12 @@
 QtRedisTransporter::QtRedisTransporter(const ChannelMode contextChannelMode)
     : QObject()
     , _channelMode(contextChannelMode)
+    , _reconnectTimer(new QTimer(this))
 {
     qRegisterMetaType<QtRedisReply>("QtRedisReply");
+    _parserSub.setChannelMessagesAsPush(true); // the connection is used only for the channel commands
+    _reconnectTimer->setSingleShot(true);
+    connect(_reconnectTimer, &QTimer::timeout, this, &QtRedisTransporter::onReconnectTimeout);
 }
 
 //!
@@ -23,6 +29,12 @@ QtRedisTransporter::QtRedisTransporter(const ChannelMode contextChannelMode)
 QtRedisTransporter::~QtRedisTransporter()
 {
     this->clearTransporter();
+    if (_ioThread) {
+        _ioThread->quit();
+        _ioThread->wait();
+        delete _ioThread;
+        _ioThread = nullptr;
+    }
 }
 
 //!
@@ -97,6 +109,30 @@ int QtRedisTransporter::currentDbIndex() const
     return _context->currentDbIndex();
 }
 
+//!
+//! \brief Версия протокола RESP
+//! \return
+//!
+//! Note: New connections always use RESP2, the version is changed by the HELLO command.
+//!
+int QtRedisTransporter::protocolVersion() const
+{
+    QMutexLocker lock(&_mutex);
+    return _protocolVersion;
+}
+
+//!
+//! \brief Задать версию протокола RESP
+//! \param protocolVersion Версия протокола (2 или 3)
+//!
+//! Note: Only stores the negotiated version, the HELLO command must be sent by the caller.
+//!
+void QtRedisTransporter::setProtocolVersion(const int protocolVersion)
+{
+    QMutexLocker lock(&_mutex);
+    _protocolVersion = protocolVersion;
+}
+
 //!
 //! \brief Задать SSL Конфигурацию
 //! \param sslConfig SSL Конфигурация
@@ -107,6 +143,7 @@ void QtRedisTransporter::setSslConfig(const QSslConfiguration &sslConfig)
     if (!_context)
         return;
 
+    this->waitPipelineFlush_unsafe();
     _context->setSslConfig(sslConfig);
 
 }
@@ -124,6 +161,31 @@ QSslConfiguration QtRedisTransporter::sslConfig() const
     return _context->sslConfig();
 }
 
+//!
+//! \brief Включить (выключить) режим потока ввода-вывода
+//! \param enable Флаг
+//!
+//! In this mode the sockets of the contexts live in one I/O thread with its own event loop,
+//! the callers exchange the data with it through the queues (see QtRedisContextIo).
+//!
+//! Note: Applied to the contexts created after the call (see initTransporter()).
+//!
+void QtRedisTransporter::setIoThreadMode(const bool enable)
+{
+    QMutexLocker lock(&_mutex);
+    _isIoThreadMode = enable;
+}
+
+//!
+//! \brief Включен ли режим потока ввода-вывода
+//! \return
+//!
+bool QtRedisTransporter::isIoThreadMode() const
+{
+    QMutexLocker lock(&_mutex);
+    return _isIoThreadMode;
+}
+
 //!
 //! \brief Выполнить инициализацию
 //! \param type Тип
@@ -149,10 +211,9 @@ bool QtRedisTransporter::initTransporter(const Type &type,
     connect(_context, &QtRedisContext::disconnected,
             this, &QtRedisTransporter::onDisconnected,
             Qt::QueuedConnection);
-    if (_channelMode == ChannelMode::CurrentConnection)
-        connect(_context, &QtRedisContext::readyRead,
-                this, &QtRedisTransporter::onReadyReadSub,
-                Qt::QueuedConnection);
+    connect(_context, &QtRedisContext::readyRead,
+            this, &QtRedisTransporter::onReadyRead,
+            Qt::QueuedConnection);
     return true;
 }
 
@@ -162,9 +223,12 @@ bool QtRedisTransporter::initTransporter(const Type &type,
 void QtRedisTransporter::clearTransporter()
 {
     QMutexLocker lock(&_mutex);
+    this->waitPipelineFlush_unsafe();
+    this->abortAsyncRequests_unsafe("Connection to the server is reset!");
     _type = Type::NoType;
     _channelMode = ChannelMode::CurrentConnection;
     _timeoutMSec = 0;
+    _protocolVersion = 2;
     if (_context) {
         delete _context;
         _context = nullptr;
@@ -173,6 +237,15 @@ void QtRedisTransporter::clearTransporter()
         delete _contextSub;
         _contextSub = nullptr;
     }
+    _parser.clear();
+    _parser.setChannelMessagesAsPush(false);
+    _parserSub.clear();
+    _channelMessages.clear();
+    _channelQueue.clear();
+    _isChannelReadPaused = false;
+    _session = SessionState();
+    _isReconnectArmed = false;
+    _reconnectAttempt = 0;
 }
 
 //!
@@ -194,8 +267,16 @@ bool QtRedisTransporter::connectToServer(QString &error, const int timeoutMSec)
         && _timeoutMSec != timeoutMSec)
         _timeoutMSec = timeoutMSec;
 
+    this->waitPipelineFlush_unsafe();
     _context->setCurrentDbIndex(0); // clear db index
-    return _context->connectToServer(_timeoutMSec, error);
+    _protocolVersion = 2;
+    this->abortAsyncRequests_unsafe("Connection to the server is reset!");
+    _parser.clear();
+    _parser.setChannelMessagesAsPush(false);
+    const bool isOk = _context->connectToServer(_timeoutMSec, error);
+    if (isOk)
+        _isReconnectArmed = true;
+    return isOk;
 }
 
 //!
@@ -207,6 +288,59 @@ bool QtRedisTransporter::connectToServer(QString &error, const int timeoutMSec)
 bool QtRedisTransporter::reconnectToServer(QString &error, const int timeoutMSec)
 {
     QMutexLocker lock(&_mutex);
+    return this->reconnectToServer_unsafe(error, timeoutMSec);
+}
+
+//!
+//! \brief Восстановить состояние сессии после переподключения
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! The state of the connection changed by the successful commands (AUTH, HELLO, CLIENT SETNAME, SELECT,
+//! SCRIPT LOAD, SUBSCRIBE, PSUBSCRIBE, SSUBSCRIBE) is sent again to the new connection
+//! in one pipeline (one round trip), all replies are checked.
+//!
+//! Note: In the ChannelMode::SeparateConnection mode the subscriptions are restored by the second pipeline
+//! on the connection for pub/sub (with AUTH).
+//! Note: The scripts are loaded without SCRIPT EXISTS, the cache of the restarted server is empty.
+//!
+bool QtRedisTransporter::restoreSession(QString &error)
+{
+    QMutexLocker lock(&_mutex);
+    return this->restoreSession_unsafe(error);
+}
+
+//!
+//! \brief Задать параметры подключения
+//! \param options Параметры подключения
+//!
+//! The options replace the state of the session (AUTH, HELLO, CLIENT SETNAME, SELECT),
+//! so restoreSession() called after connectToServer() sends them in one pipeline (the connection handshake).
+//!
+void QtRedisTransporter::setConnectionOptions(const ConnectionOptions &options)
+{
+    QMutexLocker lock(&_mutex);
+    _session.auth.clear();
+    if (!options.password.isEmpty()) {
+        if (!options.userName.isEmpty())
+            _session.auth.append(options.userName.toUtf8());
+        _session.auth.append(options.password.toUtf8());
+    }
+    _session.hello.clear();
+    if (options.protocolVersion != 2)
+        _session.hello.append(QByteArray::number(options.protocolVersion));
+    _session.clientName = options.clientName.toUtf8();
+    _session.dbIndex = options.dbIndex;
+}
+
+//!
+//! \brief Переподключиться к серверу (все соединения)
+//! \param error Сообщение об ошибке
+//! \param timeoutMSec Время ожидания мсек
+//! \return
+//!
+bool QtRedisTransporter::reconnectToServer_unsafe(QString &error, const int timeoutMSec)
+{
     error.clear();
     if (!_context) {
         error = QString("QtRedisTransporter is not initialyzed!");
@@ -216,15 +350,41 @@ bool QtRedisTransporter::reconnectToServer(QString &error, const int timeoutMSec
         && _timeoutMSec != timeoutMSec)
         _timeoutMSec = timeoutMSec;
 
-    _context->setCurrentDbIndex(0); // clear db index
-    bool isOk = _context->reconnectToServer(_timeoutMSec, error);
+    bool isOk = this->reconnectContext_unsafe(_context, error);
     if (_contextSub) {
-        _contextSub->setCurrentDbIndex(0); // clear db index
-        isOk = _contextSub->reconnectToServer(_timeoutMSec, error);
+        QString errorSub;
+        isOk = this->reconnectContext_unsafe(_contextSub, errorSub) && isOk;
+        if (error.isEmpty())
+            error = errorSub;
     }
+    if (isOk)
+        _isReconnectArmed = true;
     return isOk;
 }
 
+//!
+//! \brief Переподключить соединение к серверу
+//! \param context Контекст (основное соединение или соединение для pub/sub)
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! The asynchronous requests are aborted only by the reconnection of the main connection.
+//!
+bool QtRedisTransporter::reconnectContext_unsafe(QtRedisContext *context, QString &error)
+{
+    if (context == _context) {
+        this->waitPipelineFlush_unsafe();
+        _protocolVersion = 2;
+        this->abortAsyncRequests_unsafe("Connection to the server is reset!");
+        _parser.clear();
+        _parser.setChannelMessagesAsPush(false);
+    } else {
+        _parserSub.clear();
+    }
+    context->setCurrentDbIndex(0); // clear db index
+    return context->reconnectToServer(_timeoutMSec, error);
+}
+
 //!
 //! \brief Подключить к серверу в режиме ожидания входящих сообщений
 //! \param error Сообщение об ошибке
@@ -239,6 +399,7 @@ bool QtRedisTransporter::subscribeToServer(QString &error, const int timeoutMSec
         error = QString("QtRedisTransporter is not initialyzed!");
         return false;
     }
+    this->waitPipelineFlush_unsafe();
     QtRedisContext *context = nullptr;
     switch (_channelMode) {
         case ChannelMode::CurrentConnection: {
@@ -257,6 +418,7 @@ bool QtRedisTransporter::subscribeToServer(QString &error, const int timeoutMSec
                 connect(_contextSub, &QtRedisContext::readyRead,
                         this, &QtRedisTransporter::onReadyReadSub,
                         Qt::QueuedConnection);
+                this->applyChannelReadBufferSize_unsafe();
             }
             if (_type == Type::Ssl)
                 _contextSub->setSslConfig(_context->sslConfig());
@@ -277,6 +439,7 @@ bool QtRedisTransporter::subscribeToServer(QString &error, const int timeoutMSec
         _timeoutMSec = timeoutMSec;
 
     context->setCurrentDbIndex(0); // clear db index
+    this->contextParser_unsafe(context)->clear();
     return context->connectToServer(_timeoutMSec, error);
 }
 
@@ -290,6 +453,10 @@ void QtRedisTransporter::unsubscribeFromServer()
         return;
     _contextSub->disconnectFromServer();
     _contextSub->setCurrentDbIndex(0); // clear db index
+    _parserSub.clear();
+    _session.channels.clear();
+    _session.patterns.clear();
+    _session.shardChannels.clear();
 }
 
 //!
@@ -300,11 +467,18 @@ void QtRedisTransporter::disconnectFromServer()
     QMutexLocker lock(&_mutex);
     if (!_context)
         return;
+    _isReconnectArmed = false;
+    this->waitPipelineFlush_unsafe();
     _context->disconnectFromServer();
     _context->setCurrentDbIndex(0); // clear db index
+    _protocolVersion = 2;
+    this->abortAsyncRequests_unsafe("Disconnected from the server!");
+    _parser.clear();
+    _parser.setChannelMessagesAsPush(false);
     if (_contextSub) {
         _contextSub->disconnectFromServer();
         _contextSub->setCurrentDbIndex(0); // clear db index
+        _parserSub.clear();
     }
 }
 
@@ -375,6 +549,37 @@ QtRedisReply QtRedisTransporter::sendCommands(const QList<QtRedisCommand> &comma
     return this->sendContextCommands(_context, commands, error, ok);
 }
 
+//!
+//! \brief Отправить закодированные команды и получить ответ от сервера
+//! \param commands Список команд и их аргументы
+//! \param data Команды, закодированные QtRedisParser::appendRawData() (в порядке списка)
+//! \param error Сообщение об ошибке
+//! \param ok Состояние об ошибке
+//! \return
+//!
+//! The data is written as is, the commands are used only to match the replies,
+//! so the caller can encode the commands once while they are queued (see QtRedisPipeline).
+//!
+//! Warn: The data must be the encoding of the commands!
+//!
+QtRedisReply QtRedisTransporter::sendCommandsEncoded(const QList<QtRedisCommand> &commands, const QByteArray &data, QString &error, bool *ok)
+{
+    QMutexLocker lock(&_mutex);
+    // clear err & ok
+    error.clear();
+    if (ok)
+        *ok = false;
+    if (!_context) {
+        error = QString("Send commands failed (context is not initialyzed)!");
+        return QtRedisReply();
+    }
+    if (commands.isEmpty() || data.isEmpty()) {
+        error = QString("Commands is Empty!");
+        return QtRedisReply();
+    }
+    return this->sendContextCommandsData(_context, commands, data, error, ok);
+}
+
 //!
 //! \brief Отправить команду по работе с каналами и получить ответ от сервера (с разбором первого сообщения)
 //! \param command Команда и ее аргументы
@@ -398,255 +603,1618 @@ QtRedisReply QtRedisTransporter::sendChannelCommand(const QtRedisCommand &comman
 }
 
 //!
-//! \brief Создать объект контекста по работе с Redis-ом
-//! \param type
-//! \param host
-//! \param port
-//! \param supportSignals
+//! \brief Отправить команду и получить ответ от сервера в компактном виде
+//! \param command Команда и ее аргументы
+//! \param error Сообщение об ошибке
+//! \param ok Состояние об ошибке
 //! \return
 //!
-QtRedisContext *QtRedisTransporter::makeContext_unsafe(const Type &type,
-                                                       const QString &host,
-                                                       const int port)
-{
-    _type = type;
-    switch (_type) {
-        case Type::Tcp:
-            return new QtRedisContextTcp(host, port);
-        case Type::Ssl:
-            return new QtRedisContextSsl(host, port);
-        case Type::Unix:
-            return new QtRedisContextUnix(host);
-        default:
-            break;
-    }
-    _type = Type::Tcp;
-    return new QtRedisContextTcp(host, port);
-}
-
-//!
-//! \brief Получить объект контекста по типу подписки
-//! \return
+//! Note: The reply is parsed into the flat node array without creating QtRedisReply objects.
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
 //!
-QtRedisContext *QtRedisTransporter::channelContext_unsafe() const
-{
-    switch (_channelMode) {
-        case ChannelMode::CurrentConnection:
-            return _context;
-        case ChannelMode::SeparateConnection:
-            return _contextSub;
-        default:
-            break;
-    }
-    return nullptr;
-}
-
-QtRedisReply QtRedisTransporter::sendContextCommand(QtRedisContext *context, const QtRedisCommand &command, QString &error, bool *ok)
+QtRedisReplyTree QtRedisTransporter::sendCommandTree(const QtRedisCommand &command, QString &error, bool *ok)
 {
+    QMutexLocker lock(&_mutex);
     // clear err & ok
     error.clear();
     if (ok)
         *ok = false;
-
-    if (!context) {
-        error = QString("QtRedisTransporter is not initialyzed!");
-        return QtRedisReply();
+    if (!_context) {
+        error = QString("Send command failed (context is not initialyzed)!");
+        return QtRedisReplyTree();
     }
     if (!command.isValid()) {
         error = QString("Command is Invalid!");
-        return QtRedisReply();
+        return QtRedisReplyTree();
     }
-    const bool isSelectDb = this->isCommandSelect(command);
-    context->writeRawData(QtRedisParser::createRawData(command));
-    if (!context->waitForReadyRead()) {
-        error = QString("Context waitForReadyRead failed!");
-        return QtRedisReply();
+    if (this->commandReplyCount(command) != 1) {
+        error = QString("Command with multiple replies is not supported!");
+        return QtRedisReplyTree();
     }
-
-    QtRedisReply reply;
-    QByteArray replyData;
+    if (!this->waitAsyncReplies_unsafe(error))
+        return QtRedisReplyTree();
+    QtRedisStreamParser *parser = this->contextParser_unsafe(_context);
+    parser->setMode(QtRedisStreamParser::Mode::Tree);
+    parser->clearReplies();
+    _context->writeRawData(QtRedisParser::createRawData(command));
+    QtRedisReply pushReplyList(QtRedisReply::ReplyType::Array);
     while (true) {
-        replyData += context->readRawData();
-        const bool isFull = QtRedisParser::isFullRawData(replyData, error);
-        if (!replyData.isEmpty() && isFull) {
-            bool isOk = false;
-            reply = QtRedisParser::parseRawData(replyData, error, &isOk);
-            if (isOk)
-                break;
-        }
-        if (!context->waitForReadyRead()) {
+        this->takePushReplies_unsafe(parser, false, pushReplyList);
+        if (parser->hasReplies())
+            break;
+        if (!_context->canReadRawData()
+            && !_context->waitForReadyRead()) {
+            parser->setMode(QtRedisStreamParser::Mode::Reply);
+            parser->clear(); // the rest of the reply is lost
             error = QString("Context waitForReadyRead failed!");
-            return QtRedisReply();
+            return QtRedisReplyTree();
+        }
+        if (!parser->appendRawData(_context->readRawData(), error)) {
+            parser->setMode(QtRedisStreamParser::Mode::Reply);
+            return QtRedisReplyTree();
         }
     }
+    const QtRedisReplyTree reply = parser->takeReplyTree();
+    parser->setMode(QtRedisStreamParser::Mode::Reply);
+    if (reply.type() == QtRedisReply::ReplyType::Error)
+        error = reply.strValue();
     if (ok)
         *ok = true;
 
-    if (isSelectDb && !reply.isArrayValueEmpty())
-        this->checkCommandResult(context, command, reply.arrayValueFirst_ref());
-    if (reply.arrayValueSize() == 1)
-        return reply.arrayValueFirst();
+    if (this->isCommandSession(command))
+        this->checkCommandResult(_context, command, reply.toReply());
 
     return reply;
 }
 
-QtRedisReply QtRedisTransporter::sendContextCommands(QtRedisContext *context, const QList<QtRedisCommand> &commands, QString &error, bool *ok)
+//!
+//! \brief Отправить команду и получить ответ от сервера в режиме автоматической конвейеризации
+//! \param command Команда и ее аргументы
+//! \param error Сообщение об ошибке
+//! \param ok Состояние об ошибке
+//! \return
+//!
+//! Commands of the concurrent callers are not serialized by the round trip: commands submitted
+//! while one of the callers (the leader) exchanges data with the server are coalesced into one write,
+//! the replies are matched back to the callers in FIFO order.
+//!
+//! Note: Commands with multiple replies (SUBSCRIBE, etc.) are sent by sendCommand().
+//!
+QtRedisReply QtRedisTransporter::sendCommandPipelined(const QtRedisCommand &command, QString &error, bool *ok)
 {
+    QMutexLocker lock(&_mutex);
     // clear err & ok
     error.clear();
     if (ok)
         *ok = false;
-
-    if (!context) {
-        error = QString("QtRedisTransporter is not initialyzed!");
+    if (!_context) {
+        error = QString("Send command failed (context is not initialyzed)!");
         return QtRedisReply();
     }
-    if (commands.isEmpty()) {
-        error = QString("Commands is Empty!");
+    if (!command.isValid()) {
+        error = QString("Command is Invalid!");
         return QtRedisReply();
     }
-    // create data
-    int index = 0;
-    int selectDbCommandIndex = -1;
-    QByteArray data;
-    for (const QtRedisCommand &cmd : commands) {
-        if (!cmd.isValid()) {
-            error = QString("Invalid command in commands list!");
-            return QtRedisReply();
-        }
-        if (this->isCommandSelect(cmd))
-            selectDbCommandIndex = index;
-
-        data += QtRedisParser::createRawData(cmd);
-        index++;
-    }
-    // send
-    context->writeRawData(data);
-    if (!context->waitForReadyRead())
-        return QtRedisReply();
+    if (this->commandReplyCount(command) != 1)
+        return this->sendContextCommand(_context, command, error, ok);
 
-    QtRedisReply reply;
-    QByteArray replyData;
-    while (true) {
-        replyData += context->readRawData();
-        const bool isFull = QtRedisParser::isFullRawData(replyData, error);
-        if (!replyData.isEmpty() && isFull) {
-            bool isOk = false;
-            reply = QtRedisParser::parseRawData(replyData, error, &isOk);
-            if (isOk && commands.size() == reply.arrayValueSize())
-                break;
-        }
-        if (!context->waitForReadyRead())
-            return QtRedisReply();
-    }
-    if (commands.size() != reply.arrayValueSize()) {
-        error = QString("Invalid reply size (command-list-size != reply-list-size)!");
-        return QtRedisReply();
+    PipelineRequest pipelineRequest;
+    AsyncRequest request;
+    request.command = command;
+    request.waiter = &pipelineRequest;
+    this->appendPipelineRequest_unsafe(request);
+    while (!pipelineRequest.isDone) {
+        if (_isPipelineFlushing)
+            _pipelineCondition.wait(&_mutex);
+        else
+            this->processPipeline_unsafe(pipelineRequest);
     }
-    if (selectDbCommandIndex != -1)
-        this->checkCommandResult(context, commands.at(selectDbCommandIndex), reply.arrayValueAt(selectDbCommandIndex));
-
+    error = pipelineRequest.error;
     if (ok)
-        *ok = true;
-
-    if (reply.arrayValueSize() == 1)
-        return reply.arrayValueFirst();
-    return reply;
-}
-
-bool QtRedisTransporter::isCommandSelect(const QtRedisCommand &command) const
-{
-    if (!command.isValid())
-        return false;
-
-    // check select db
-    return (command.size() == 2 && command.command() == QString("SELECT"));
+        *ok = pipelineRequest.isOk;
 
+    return pipelineRequest.reply;
 }
 
 //!
-//! \brief Проверка команды и ее результата
-//! \param command Команда
-//! \param reply Результат
+//! \brief Отправить команду без ожидания ответа от сервера
+//! \param command Команда и ее аргументы
+//! \param callback Функция обработки ответа
+//! \param error Сообщение об ошибке
+//! \return
 //!
-//! Данный метод нужен для проверки системных команд (смена текущей БД и пр.)
-//! и отслеживания их результата.
+//! The command is written to the socket and added to the FIFO of pending requests,
+//! the reply is read by the readyRead signal of the connection. Any number of commands
+//! can be in flight at the same time, the replies are passed to the callbacks in the order of sending.
 //!
-void QtRedisTransporter::checkCommandResult(QtRedisContext *context, const QtRedisCommand &command, const QtRedisReply &reply)
+//! Note: The callback is called in the thread of the transporter object (requires the event loop)
+//! without locking the mutex, so other commands can be sent from the callback.
+//! Note: The synchronous commands wait for the replies of all pending asynchronous requests first.
+//! Note: If the leader of the auto-pipelining exchanges data with the server, the command is sent with the next write.
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
+//!
+bool QtRedisTransporter::sendCommandAsync(const QtRedisCommand &command, const ReplyCallback &callback, QString &error)
 {
-    if (!command.isValid())
-        return;
-
-    // check select db
-    if (command.size() == 2
-        && command.command() == QString("SELECT")
-        && reply.type() == QtRedisReply::ReplyType::Status
-        && reply.strValue() == QString("OK")) {
-        context->setCurrentDbIndex(command.commandArgv().constFirst().toInt());
+    QMutexLocker lock(&_mutex);
+    error.clear();
+    if (!_context) {
+        error = QString("Send command failed (context is not initialyzed)!");
+        return false;
+    }
+    if (!command.isValid()) {
+        error = QString("Command is Invalid!");
+        return false;
+    }
+    if (this->commandReplyCount(command) != 1) {
+        error = QString("Command with multiple replies is not supported!");
+        return false;
     }
+    AsyncRequest request;
+    request.command = command;
+    request.callback = callback;
+    this->appendPipelineRequest_unsafe(request);
+    if (!_isPipelineFlushing)
+        this->flushPipeline_unsafe();
+    return true;
 }
 
 //!
-//! \brief Слот обработки подключения к Redis
+//! \brief Количество асинхронных запросов, ожидающих ответа
+//! \return
 //!
-void QtRedisTransporter::onConnected()
+int QtRedisTransporter::asyncRequestsCount() const
 {
-    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
-    if (!context)
-        return;
-    emit this->contextConnected(context->uid(), context->host(), context->port(), context->currentDbIndex());
+    QMutexLocker lock(&_mutex);
+    return _asyncRequests.size();
 }
 
 //!
-//! \brief Слот обработки отключения от Redis
+//! \brief Отправить команду, ответ на которую будет получен позже
+//! \param command Команда и ее аргументы
+//! \param error Сообщение об ошибке
+//! \return
 //!
-void QtRedisTransporter::onDisconnected()
-{
-    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
-    if (!context)
-        return;
-    emit this->contextDisconnected(context->uid(), context->host(), context->port(), context->currentDbIndex());
-}
-
+//! The command is written to the socket at once (or with the next write of the auto-pipelining leader),
+//! the reply is taken by waitDeferredReply(). The caller can do other work while the reply is on the way,
+//! the event loop is not required.
 //!
-//! \brief Слот чтения входящих сообщений от сервера Redis
+//! Note: Returns nullptr on error. If the request is dropped without waiting, its reply is discarded.
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
 //!
-void QtRedisTransporter::onReadyReadSub()
+QtRedisTransporter::DeferredRequest QtRedisTransporter::sendCommandDeferred(const QtRedisCommand &command, QString &error)
 {
-    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
-    if (!context)
+    QMutexLocker lock(&_mutex);
+    error.clear();
+    if (!_context) {
+        error = QString("Send command failed (context is not initialyzed)!");
+        return nullptr;
+    }
+    if (!command.isValid()) {
+        error = QString("Command is Invalid!");
+        return nullptr;
+    }
+    if (this->commandReplyCount(command) != 1) {
+        error = QString("Command with multiple replies is not supported!");
+        return nullptr;
+    }
+    AsyncRequest request;
+    request.command = command;
+    request.deferred = std::make_shared<PipelineRequest>();
+    this->appendPipelineRequest_unsafe(request);
+    if (!_isPipelineFlushing)
+        this->flushPipeline_unsafe();
+    return request.deferred;
+}
+
+//!
+//! \brief Получить ответ на команду, отправленную методом sendCommandDeferred()
+//! \param request Отложенный запрос
+//! \param error Сообщение об ошибке
+//! \param ok Состояние об ошибке
+//! \return
+//!
+//! Blocks until the reply is received. The replies of the requests sent earlier are read first (FIFO).
+//!
+QtRedisReply QtRedisTransporter::waitDeferredReply(const DeferredRequest &request, QString &error, bool *ok)
+{
+    QMutexLocker lock(&_mutex);
+    // clear err & ok
+    error.clear();
+    if (ok)
+        *ok = false;
+    if (!request) {
+        error = QString("Deferred request is NULL!");
+        return QtRedisReply();
+    }
+    while (!request->isDone) {
+        if (_isPipelineFlushing)
+            _pipelineCondition.wait(&_mutex);
+        else
+            this->processPipeline_unsafe(*request);
+    }
+    error = request->error;
+    if (ok)
+        *ok = request->isOk;
+
+    return request->reply;
+}
+
+//!
+//! \brief Отправить команды потоковой отправки и получить готовые ответы
+//! \param request Потоковая отправка
+//! \param commands Список команд (может быть пустым)
+//! \param maxInFlight Максимальное количество команд, ожидающих ответа, после возврата
+//! \param replies Полученные ответы (в порядке отправки)
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! The commands are written at once, then the replies are read and parsed until no more than maxInFlight
+//! commands of the request are waiting for the reply. So the commands and the replies in memory are bounded
+//! by the window, not by the total number of the commands. Pass the empty list and maxInFlight = 0 to wait for all replies.
+//!
+//! Note: The replies read by other callers (synchronous commands wait for the pending requests first)
+//! are kept by the request until the next call.
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
+//!
+bool QtRedisTransporter::sendCommandsStreamed(const StreamingRequest &request,
+                                              const QList<QtRedisCommand> &commands,
+                                              const int maxInFlight,
+                                              QList<QtRedisReply> &replies,
+                                              QString &error)
+{
+    QMutexLocker lock(&_mutex);
+    error.clear();
+    replies.clear();
+    if (!request) {
+        error = QString("Streaming request is NULL!");
+        return false;
+    }
+    if (!_context) {
+        error = QString("Send commands failed (context is not initialyzed)!");
+        return false;
+    }
+    for (const QtRedisCommand &command : commands) {
+        if (!command.isValid()) {
+            error = QString("Invalid command in commands list!");
+            return false;
+        }
+        if (this->commandReplyCount(command) != 1) {
+            error = QString("Command with multiple replies is not supported!");
+            return false;
+        }
+    }
+    for (const QtRedisCommand &command : commands) {
+        AsyncRequest buffRequest;
+        buffRequest.command = command;
+        buffRequest.streaming = request;
+        this->appendPipelineRequest_unsafe(buffRequest);
+        request->inFlight++;
+    }
+    if (!_isPipelineFlushing)
+        this->flushPipeline_unsafe();
+    while (request->inFlight > qMax(maxInFlight, 0)) {
+        if (_isPipelineFlushing) { // the data is read by the leader of the auto-pipelining
+            _pipelineCondition.wait(&_mutex);
+            continue;
+        }
+        this->takeAsyncReplies_unsafe();
+        if (request->inFlight <= qMax(maxInFlight, 0))
+            break;
+        if (!_context->canReadRawData()
+            && !_context->waitForReadyRead()) {
+            _parser.clear(); // the rest of the reply is lost
+            this->abortAsyncRequests_unsafe("Context waitForReadyRead failed!");
+            break;
+        }
+        QString parseError;
+        if (!_parser.appendRawData(_context->readRawData(), parseError)) {
+            this->abortAsyncRequests_unsafe(parseError);
+            break;
+        }
+    }
+    replies.swap(request->replies);
+    error = request->error;
+    return error.isEmpty();
+}
+
+//!
+//! \brief Задать функцию обработки сообщений канала
+//! \param channel Канал (шаблон для PSUBSCRIBE)
+//! \param handler Функция обработки (пустая функция удаляет обработчик)
+//!
+//! The messages of the channel are passed to the handler directly by the thread that reads the connection
+//! (the thread of the transporter), without the signals and the conversion to QString.
+//!
+//! Note: The handler is called without locking the mutex, but it must not block the reading thread.
+//!
+void QtRedisTransporter::setChannelHandler(const QByteArray &channel, const MessageHandler &handler)
+{
+    QMutexLocker lock(&_mutex);
+    if (handler)
+        _channelHandlers.insert(channel, handler);
+    else
+        _channelHandlers.remove(channel);
+}
+
+//!
+//! \brief Задать функцию обработки пакета сообщений каналов
+//! \param handler Функция обработки (пустая функция выключает пакетную обработку)
+//!
+//! The messages of the channels without the handler (see setChannelHandler()) received by one read
+//! are passed to the handler by one call instead of the signals.
+//!
+void QtRedisTransporter::setChannelBatchHandler(const MessageBatchHandler &handler)
+{
+    QMutexLocker lock(&_mutex);
+    _channelBatchHandler = handler;
+}
+
+//!
+//! \brief Задать ограниченную очередь сообщений каналов
+//! \param limit Размер очереди (0 - без очереди, сообщения передаются сигналами)
+//! \param policy Политика переполнения очереди
+//!
+//! The messages are queued instead of the signals, the receiver is notified by channelMessagesQueued()
+//! only when the queue becomes non-empty and takes all messages by takeChannelMessages().
+//! So the slow receiver does not accumulate the queued signals, and the messages are handled by the policy:
+//!     - BlockReader - the subscription connection is not read while the queue is full, its socket buffer is limited,
+//!       so the server is slowed down by TCP flow control (the server may close the connection by client-output-buffer-limit);
+//!     - DropOldest, DropNewest - the oldest (new) message is dropped;
+//!     - CoalesceByChannel - the new message replaces the queued message of the same channel, otherwise the oldest is dropped.
+//!
+//! Note: The queue may exceed the limit by the messages of one read (BlockReader).
+//! Note: In ChannelMode::CurrentConnection the connection is shared with the commands and is not paused,
+//! BlockReader drops the new messages.
+//! Note: The messages passed to the handlers (see setChannelHandler(), setChannelBatchHandler()) are not queued.
+//!
+void QtRedisTransporter::setChannelQueue(const int limit, const ChannelQueuePolicy policy)
+{
+    QMutexLocker lock(&_mutex);
+    _channelQueueLimit = qMax(limit, 0);
+    _channelQueuePolicy = policy;
+    this->applyChannelReadBufferSize_unsafe();
+    if (_isChannelReadPaused && !this->isChannelQueueFull_unsafe()) {
+        _isChannelReadPaused = false;
+        QMetaObject::invokeMethod(this, [this]() {
+            this->readContextSub(nullptr);
+        }, Qt::QueuedConnection);
+    }
+}
+
+//!
+//! \brief Количество сообщений в очереди сообщений каналов
+//! \return
+//!
+int QtRedisTransporter::channelQueueSize() const
+{
+    QMutexLocker lock(&_mutex);
+    return _channelQueue.size();
+}
+
+//!
+//! \brief Количество сообщений каналов, отброшенных по политике переполнения очереди
+//! \return
+//!
+qint64 QtRedisTransporter::channelMessagesDropped() const
+{
+    QMutexLocker lock(&_mutex);
+    return _channelDropped;
+}
+
+//!
+//! \brief Забрать все сообщения из очереди сообщений каналов
+//! \return
+//!
+//! If the subscription connection is paused (BlockReader), the reading is resumed.
+//!
+QVector<QtRedisReply> QtRedisTransporter::takeChannelMessages()
+{
+    QMutexLocker lock(&_mutex);
+    const QVector<QtRedisReply> replyList = _channelQueue.toVector();
+    _channelQueue.clear();
+    if (_isChannelReadPaused) {
+        _isChannelReadPaused = false;
+        QMetaObject::invokeMethod(this, [this]() {
+            this->readContextSub(nullptr);
+        }, Qt::QueuedConnection);
+    }
+    return replyList;
+}
+
+//!
+//! \brief Загрузить скрипты, отсутствующие в кэше скриптов сервера
+//! \param scripts Список скриптов
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! The scripts are checked by one SCRIPT EXISTS command, the missing ones are loaded
+//! by SCRIPT LOAD commands sent in one pipeline (the bodies of the cached scripts are not sent).
+//!
+bool QtRedisTransporter::loadScripts(const QList<QtRedisScript> &scripts, QString &error)
+{
+    QMutexLocker lock(&_mutex);
+    error.clear();
+    if (!_context) {
+        error = QString("Send command failed (context is not initialyzed)!");
+        return false;
+    }
+    if (scripts.isEmpty())
+        return true;
+    for (const QtRedisScript &script : scripts) {
+        if (!_session.scripts.contains(script))
+            _session.scripts.append(script);
+    }
+    QtRedisCommand existsCommand("SCRIPT");
+    existsCommand.reserve(scripts.size() + 1);
+    existsCommand << "EXISTS";
+    for (const QtRedisScript &script : scripts)
+        existsCommand << script.sha1();
+    bool isOk = false;
+    const QtRedisReply existsReply = this->sendContextCommand(_context, existsCommand, error, &isOk);
+    if (!isOk || !error.isEmpty())
+        return false;
+    if (existsReply.arrayValueSize() != scripts.size()) {
+        error = QString("Invalid reply of the SCRIPT EXISTS command!");
+        return false;
+    }
+    QList<QtRedisCommand> loadCommands;
+    for (int i = 0; i < scripts.size(); i++) {
+        if (existsReply.arrayValueAt_ref(i).intValue() == 0)
+            loadCommands.append(scripts.at(i).loadCommand());
+    }
+    if (loadCommands.isEmpty())
+        return true;
+    this->sendContextCommands(_context, loadCommands, error, &isOk);
+    return isOk && error.isEmpty();
+}
+
+//!
+//! \brief Включить (выключить) автоматическое переподключение
+//! \param enable Включить режим
+//! \param minDelayMSec Задержка первой попытки мсек
+//! \param maxDelayMSec Максимальная задержка мсек
+//!
+//! When the connection is lost, the transporter reconnects it with the exponential backoff (see scheduleReconnect_unsafe())
+//! and restores the state of its session (see restoreSession()), then the signal contextRestored is emitted.
+//! The pending requests of the main connection are aborted with the error, the commands sent before the restoration fail.
+//!
+//! Note: Disabled by default.
+//! Note: The attempts are made by the timer, the thread of the transporter object requires the event loop.
+//! Warn: The attempt blocks the event loop of that thread until the connection is restored or fails (see onReconnectTimeout()).
+//!
+void QtRedisTransporter::setAutoReconnect(const bool enable, const int minDelayMSec, const int maxDelayMSec)
+{
+    QMutexLocker lock(&_mutex);
+    _isAutoReconnect = enable;
+    _reconnectMinDelayMSec = qMax(minDelayMSec, 1);
+    _reconnectMaxDelayMSec = qMax(maxDelayMSec, _reconnectMinDelayMSec);
+    _reconnectAttempt = 0;
+}
+
+//!
+//! \brief Включено ли автоматическое переподключение
+//! \return
+//!
+bool QtRedisTransporter::isAutoReconnect() const
+{
+    QMutexLocker lock(&_mutex);
+    return _isAutoReconnect;
+}
+
+//!
+//! \brief Создать объект контекста по работе с Redis-ом
+//! \param type
+//! \param host
+//! \param port
+//! \param supportSignals
+//! \return
+//!
+//! Note: In the I/O thread mode the context is wrapped by QtRedisContextIo.
+//!
+QtRedisContext *QtRedisTransporter::makeContext_unsafe(const Type &type,
+                                                       const QString &host,
+                                                       const int port)
+{
+    _type = type;
+    QtRedisContext *context = nullptr;
+    switch (_type) {
+        case Type::Tcp:
+            context = new QtRedisContextTcp(host, port);
+            break;
+        case Type::Ssl:
+            context = new QtRedisContextSsl(host, port);
+            break;
+        case Type::Unix:
+            context = new QtRedisContextUnix(host);
+            break;
+        default:
+            _type = Type::Tcp;
+            context = new QtRedisContextTcp(host, port);
+            break;
+    }
+    if (!_isIoThreadMode)
+        return context;
+
+    if (!_ioThread) {
+        _ioThread = new QThread();
+        _ioThread->setObjectName(QString("QtRedisIoThread"));
+        _ioThread->start();
+    }
+    return new QtRedisContextIo(context, _ioThread);
+}
+
+//!
+//! \brief Получить объект контекста по типу подписки
+//! \return
+//!
+QtRedisContext *QtRedisTransporter::channelContext_unsafe() const
+{
+    switch (_channelMode) {
+        case ChannelMode::CurrentConnection:
+            return _context;
+        case ChannelMode::SeparateConnection:
+            return _contextSub;
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+//!
+//! \brief Получить объект потокового парсера для контекста
+//! \param context Контекст redis-a
+//! \return
+//!
+QtRedisStreamParser *QtRedisTransporter::contextParser_unsafe(QtRedisContext *context)
+{
+    if (context && context == _contextSub)
+        return &_parserSub;
+
+    return &_parser;
+}
+
+QtRedisReply QtRedisTransporter::sendContextCommand(QtRedisContext *context, const QtRedisCommand &command, QString &error, bool *ok)
+{
+    // clear err & ok
+    error.clear();
+    if (ok)
+        *ok = false;
+
+    if (!context) {
+        error = QString("QtRedisTransporter is not initialyzed!");
+        return QtRedisReply();
+    }
+    if (!command.isValid()) {
+        error = QString("Command is Invalid!");
+        return QtRedisReply();
+    }
+    if (context == _context
+        && !this->waitAsyncReplies_unsafe(error))
+        return QtRedisReply();
+    const bool isSessionCommand = this->isCommandSession(command);
+    const bool isChannelCommand = this->isCommandChannel(command);
+    const int replyCount = this->commandReplyCount(command);
+    QtRedisStreamParser *parser = this->contextParser_unsafe(context);
+    parser->clearReplies();
+    if (isChannelCommand
+        && !command.command().endsWith("UNSUBSCRIBE")
+        && _protocolVersion == 2) // RESP3 messages are push replies, the arrays are always replies
+        parser->setChannelMessagesAsPush(true); // the messages may arrive before the confirmations
+    context->writeRawData(QtRedisParser::createRawData(command));
+    QtRedisReply pushReplyList(QtRedisReply::ReplyType::Array); // RESP3 confirmations of the channel command
+    while (true) {
+        this->takePushReplies_unsafe(parser, isChannelCommand, pushReplyList);
+        const int buffCount = parser->repliesCount() + pushReplyList.arrayValueSize();
+        if (buffCount > 0 && buffCount >= replyCount)
+            break;
+        if (!context->canReadRawData()
+            && !context->waitForReadyRead()) {
+            parser->clear(); // the rest of the reply is lost
+            error = QString("Context waitForReadyRead failed!");
+            return QtRedisReply();
+        }
+        if (!parser->appendRawData(context->readRawData(), error))
+            return QtRedisReply();
+    }
+    QtRedisReply reply = parser->takeReplies(replyCount > 0 ? qMax(replyCount - pushReplyList.arrayValueSize(), 0) : -1);
+    for (const QtRedisReply &pushReply : pushReplyList.arrayValue_ref())
+        reply.appendArrayValue(pushReply);
+    error = this->replyErrorMessage(reply);
+    if (ok)
+        *ok = true;
+
+    if (isSessionCommand && !reply.isArrayValueEmpty())
+        this->checkCommandResult(context, command, reply.arrayValueFirst_ref());
+    if (isChannelCommand && error.isEmpty())
+        this->updateSubscriptions_unsafe(command);
+    if (isChannelCommand && parser != &_parserSub
+        && this->channelSubscriptionCount(reply) == 0)
+        parser->setChannelMessagesAsPush(false); // the connection is not subscribed, the arrays are replies again
+    if (reply.arrayValueSize() == 1)
+        return reply.arrayValueFirst();
+
+    return reply;
+}
+
+QtRedisReply QtRedisTransporter::sendContextCommands(QtRedisContext *context, const QList<QtRedisCommand> &commands, QString &error, bool *ok)
+{
+    // clear err & ok
+    error.clear();
+    if (ok)
+        *ok = false;
+
+    if (!context) {
+        error = QString("QtRedisTransporter is not initialyzed!");
+        return QtRedisReply();
+    }
+    if (commands.isEmpty()) {
+        error = QString("Commands is Empty!");
+        return QtRedisReply();
+    }
+    // create data
+    int dataSize = 0;
+    for (const QtRedisCommand &cmd : commands) {
+        if (!cmd.isValid()) {
+            error = QString("Invalid command in commands list!");
+            return QtRedisReply();
+        }
+        dataSize += QtRedisParser::rawDataSize(cmd);
+    }
+    QByteArray data;
+    data.reserve(dataSize);
+    for (const QtRedisCommand &cmd : commands)
+        QtRedisParser::appendRawData(data, cmd);
+    return this->sendContextCommandsData(context, commands, data, error, ok);
+}
+
+//!
+//! \brief Отправить закодированные команды и получить ответ от сервера
+//! \param context Контекст
+//! \param commands Список команд (для разбора ответов)
+//! \param data Закодированные команды
+//! \param error Сообщение об ошибке
+//! \param ok Состояние об ошибке
+//! \return
+//!
+QtRedisReply QtRedisTransporter::sendContextCommandsData(QtRedisContext *context,
+                                                         const QList<QtRedisCommand> &commands,
+                                                         const QByteArray &data,
+                                                         QString &error,
+                                                         bool *ok)
+{
+    if (context == _context
+        && !this->waitAsyncReplies_unsafe(error))
+        return QtRedisReply();
+    // send
+    QtRedisStreamParser *parser = this->contextParser_unsafe(context);
+    parser->clearReplies();
+    context->writeRawData(data);
+    QtRedisReply pushReplyList(QtRedisReply::ReplyType::Array);
+    while (true) {
+        this->takePushReplies_unsafe(parser, false, pushReplyList);
+        if (parser->repliesCount() >= commands.size())
+            break;
+        if (!context->canReadRawData()
+            && !context->waitForReadyRead()) {
+            parser->clear(); // the rest of the reply is lost
+            error = QString("Context waitForReadyRead failed!");
+            return QtRedisReply();
+        }
+        if (!parser->appendRawData(context->readRawData(), error))
+            return QtRedisReply();
+    }
+    const QtRedisReply reply = parser->takeReplies(commands.size());
+    error = this->replyErrorMessage(reply);
+    if (commands.size() != reply.arrayValueSize()) {
+        error = QString("Invalid reply size (command-list-size != reply-list-size)!");
+        return QtRedisReply();
+    }
+    for (int index = 0; index < commands.size(); ++index) {
+        if (this->isCommandSession(commands.at(index)))
+            this->checkCommandResult(context, commands.at(index), reply.arrayValueAt_ref(index));
+    }
+
+    if (ok)
+        *ok = true;
+
+    if (reply.arrayValueSize() == 1)
+        return reply.arrayValueFirst();
+    return reply;
+}
+
+//!
+//! \brief Изменяет ли команда состояние сессии
+//! \param command Команда
+//! \return
+//!
+//! Commands SELECT, AUTH, HELLO and CLIENT SETNAME (see checkCommandResult()).
+//!
+bool QtRedisTransporter::isCommandSession(const QtRedisCommand &command) const
+{
+    if (!command.isValid())
+        return false;
+
+    const QByteArray &name = command.command();
+    return (command.size() == 2 && name == "SELECT")
+           || name == "AUTH"
+           || name == "HELLO"
+           || (command.size() == 3 && name == "CLIENT" && command.commandArgv().constFirst().toUpper() == "SETNAME");
+}
+
+//!
+//! \brief Является ли команда командой подписки (отписки) на каналы
+//! \param command Команда
+//! \return
+//!
+//! Commands SUBSCRIBE/UNSUBSCRIBE/PSUBSCRIBE/PUNSUBSCRIBE/SSUBSCRIBE/SUNSUBSCRIBE
+//!
+bool QtRedisTransporter::isCommandChannel(const QtRedisCommand &command) const
+{
+    return (command.command() == QString("SUBSCRIBE")
+            || command.command() == QString("UNSUBSCRIBE")
+            || command.command() == QString("PSUBSCRIBE")
+            || command.command() == QString("PUNSUBSCRIBE")
+            || command.command() == QString("SSUBSCRIBE")
+            || command.command() == QString("SUNSUBSCRIBE"));
+}
+
+//!
+//! \brief Является ли ответ сообщением канала
+//! \param reply Ответ
+//! \return
+//!
+//! Checks the "message", "smessage" and "pmessage" replies (RESP2 Array or RESP3 Push).
+//!
+bool QtRedisTransporter::isChannelMessage(const QtRedisReply &reply) const
+{
+    return QtRedisStreamParser::isChannelMessage(reply);
+}
+
+//!
+//! \brief Количество подписок соединения из подтверждений команды подписки (отписки)
+//! \param reply Список подтверждений ([type, channel, count])
+//! \return -1, если количество не найдено
+//!
+int QtRedisTransporter::channelSubscriptionCount(const QtRedisReply &reply) const
+{
+    if (reply.isArrayValueEmpty())
+        return -1;
+    const QtRedisReply &confirmation = reply.arrayValueLast_ref();
+    if ((!confirmation.isArray() && !confirmation.isPush())
+        || confirmation.arrayValueSize() != 3
+        || !confirmation.arrayValueLast_ref().isInteger())
+        return -1;
+
+    return static_cast<int>(confirmation.arrayValueLast_ref().intValue());
+}
+
+//!
+//! \brief Забрать внеочередные сообщения (RESP3 push) из парсера
+//! \param parser Потоковый парсер
+//! \param isChannelCommand Выполняется ли команда подписки (отписки) на каналы
+//! \param replyList Список подтверждений команды подписки (отписки)
+//!
+//! Channel messages are queued and emitted asynchronously (see onChannelMessages()).
+//! Other push replies are confirmations of the channel command, or are ignored for other commands.
+//!
+void QtRedisTransporter::takePushReplies_unsafe(QtRedisStreamParser *parser, const bool isChannelCommand, QtRedisReply &replyList)
+{
+    if (!parser->hasPushReplies())
+        return;
+
+    const bool isEmptyQueue = _channelMessages.isEmpty();
+    const QtRedisReply pushReplyList = parser->takePushReplies();
+    for (const QtRedisReply &reply : pushReplyList.arrayValue_ref()) {
+        if (this->isChannelMessage(reply))
+            _channelMessages.append(reply);
+        else if (isChannelCommand)
+            replyList.appendArrayValue(reply);
+    }
+    if (isEmptyQueue && !_channelMessages.isEmpty())
+        QMetaObject::invokeMethod(this, "onChannelMessages", Qt::QueuedConnection);
+}
+
+//!
+//! \brief Отправить сигналы о полученных сообщениях каналов
+//! \param replyList Список ответов
+//!
+//! The message of the channel (pattern) with the handler is passed to the handler,
+//! the other messages are passed to the batch handler (one call for the list) if it is set,
+//! are queued for the receivers if the queue is set (see setChannelQueue()), otherwise the signals are emitted.
+//!
+//! Warn: Must be called without locking the mutex!
+//!
+void QtRedisTransporter::emitChannelMessages(const QVector<QtRedisReply> &replyList)
+{
+    QHash<QByteArray, MessageHandler> handlers;
+    MessageBatchHandler batchHandler;
+    bool isQueued = false;
+    {
+        QMutexLocker lock(&_mutex);
+        handlers = _channelHandlers;
+        batchHandler = _channelBatchHandler;
+        isQueued = (_channelQueueLimit > 0);
+    }
+    QVector<ChannelMessage> batchMessages;
+    QVector<QtRedisReply> queueMessages;
+    for (const QtRedisReply &reply : replyList) {
+        if (!this->isChannelMessage(reply))
+            continue;
+
+        const QVector<QtRedisReply> &values = reply.arrayValue_ref();
+        const bool isPattern = (values.size() == 4);
+        if (!handlers.isEmpty()) {
+            const auto it = handlers.constFind(values.at(1).rawValueView());
+            if (it != handlers.constEnd()) {
+                it.value()(values.at(isPattern ? 2 : 1).rawValue(), values.constLast().rawValue());
+                continue;
+            }
+        }
+        if (batchHandler) {
+            ChannelMessage message;
+            if (isPattern) {
+                message.type = ChannelMessage::Type::PatternMessage;
+                message.pattern = values.at(1).rawValue();
+            } else if (values.constFirst().rawValueView() == "smessage") {
+                message.type = ChannelMessage::Type::ShardMessage;
+            }
+            message.channel = values.at(isPattern ? 2 : 1).rawValue();
+            message.payload = values.constLast().rawValue();
+            batchMessages.append(message);
+            continue;
+        }
+        if (isQueued) {
+            queueMessages.append(reply);
+            continue;
+        }
+        if (values.constFirst().rawValueView() == "message")
+            emit this->incomingChannelMessage(values.at(1).strValue(), values.at(2));
+
+        else if (values.constFirst().rawValueView() == "smessage")
+            emit this->incomingChannelShardMessage(values.at(1).strValue(), values.at(2));
+
+        else if (values.constFirst().rawValueView() == "pmessage")
+            emit this->incomingChannelPatternMessage(values.at(1).strValue(), values.at(2).strValue(), values.at(3));
+    }
+    if (!batchMessages.isEmpty())
+        batchHandler(batchMessages);
+    if (!queueMessages.isEmpty())
+        this->enqueueChannelMessages(queueMessages);
+}
+
+//!
+//! \brief Добавить сообщения каналов в очередь для получателей
+//! \param replyList Список сообщений
+//! \return false, если очередь выключена
+//!
+//! Warn: Must be called without locking the mutex!
+//!
+bool QtRedisTransporter::enqueueChannelMessages(const QVector<QtRedisReply> &replyList)
+{
+    QMutexLocker lock(&_mutex);
+    if (_channelQueueLimit <= 0)
+        return false;
+    const bool isEmptyQueue = _channelQueue.isEmpty();
+    const bool isPaused = (_channelQueuePolicy == ChannelQueuePolicy::BlockReader
+                           && _channelMode == ChannelMode::SeparateConnection);
+    for (const QtRedisReply &reply : replyList) {
+        if (_channelQueue.size() < _channelQueueLimit || isPaused) {
+            _channelQueue.append(reply);
+            continue;
+        }
+        _channelDropped++;
+        switch (_channelQueuePolicy) {
+            case ChannelQueuePolicy::DropOldest: {
+                _channelQueue.removeFirst();
+                _channelQueue.append(reply);
+                break;
+            }
+            case ChannelQueuePolicy::CoalesceByChannel: {
+                const QVector<QtRedisReply> &values = reply.arrayValue_ref();
+                bool isReplaced = false;
+                for (QtRedisReply &queued : _channelQueue) {
+                    const QVector<QtRedisReply> &queuedValues = queued.arrayValue_ref();
+                    if (queuedValues.size() == values.size()
+                        && queuedValues.constFirst().rawValueView() == values.constFirst().rawValueView()
+                        && queuedValues.at(values.size() - 2).rawValueView() == values.at(values.size() - 2).rawValueView()) {
+                        queued = reply; // the position of the channel in the queue is kept
+                        isReplaced = true;
+                        break;
+                    }
+                }
+                if (!isReplaced) {
+                    _channelQueue.removeFirst();
+                    _channelQueue.append(reply);
+                }
+                break;
+            }
+            default: // DropNewest (BlockReader of the shared connection)
+                break;
+        }
+    }
+    if (isEmptyQueue && !_channelQueue.isEmpty()) {
+        lock.unlock();
+        emit this->channelMessagesQueued();
+    }
+    return true;
+}
+
+//!
+//! \brief Заполнена ли очередь сообщений каналов
+//! \return
+//!
+bool QtRedisTransporter::isChannelQueueFull_unsafe() const
+{
+    return (_channelQueueLimit > 0 && _channelQueue.size() >= _channelQueueLimit);
+}
+
+//!
+//! \brief Ограничить буфер чтения соединения подписки (BlockReader)
+//!
+void QtRedisTransporter::applyChannelReadBufferSize_unsafe()
+{
+    if (!_contextSub)
+        return;
+    const bool isBlockReader = (_channelQueueLimit > 0
+                                && _channelQueuePolicy == ChannelQueuePolicy::BlockReader);
+    _contextSub->setReadBufferSize(isBlockReader ? 65536 : 0);
+}
+
+//!
+//! \brief Добавить запрос в очередь отправки
+//! \param request Запрос
+//!
+void QtRedisTransporter::appendPipelineRequest_unsafe(const AsyncRequest &request)
+{
+    QtRedisParser::appendRawData(_pipelineData, request.command);
+    _pipelineRequests.append(request);
+}
+
+//!
+//! \brief Отправить все запросы из очереди отправки одной записью
+//!
+//! The sent requests are moved to the FIFO of the requests waiting for the reply.
+//!
+void QtRedisTransporter::flushPipeline_unsafe()
+{
+    if (_pipelineRequests.isEmpty())
+        return;
+    if (_context->writeRawData(_pipelineData) <= 0) {
+        this->abortAsyncRequests_unsafe("Context writeRawData failed!");
+        return;
+    }
+    _pipelineData.clear();
+    _asyncRequests.append(_pipelineRequests);
+    _pipelineRequests.clear();
+}
+
+//!
+//! \brief Обмен данными с сервером потоком-лидером автоматической конвейеризации
+//! \param request Запрос потока-лидера
+//!
+//! The leader writes the queued requests and reads the replies until its own request is done.
+//! The mutex is released while waiting for the data, so other callers can queue their requests,
+//! which are written by the leader with the next write.
+//!
+//! While the mutex is released, the context and its parser are used only by the leader (_isPipelineFlushing is set):
+//!     - sendCommandAsync() and sendCommandDeferred() only queue the requests;
+//!     - sendCommandPipelined(), waitDeferredReply() and sendCommandsStreamed() queue the requests and wait for the leader;
+//!     - onReadyRead() doesn't read the context;
+//!     - the other functions that use the context (send, connect, reconnect, disconnect, subscribe, restore the session,
+//!       setSslConfig(), onDisconnected()) wait for the end of the exchange (see waitPipelineFlush_unsafe()).
+//!
+//! Note: The read-only accessors (isConnected(), host(), port(), currentDbIndex()) don't wait.
+//!
+void QtRedisTransporter::processPipeline_unsafe(const PipelineRequest &request)
+{
+    _isPipelineFlushing = true;
+    while (!request.isDone) {
+        this->flushPipeline_unsafe();
+        this->takeAsyncReplies_unsafe();
+        if (request.isDone)
+            break;
+        _mutex.unlock();
+        const bool isReadyRead = (_context->canReadRawData() || _context->waitForReadyRead());
+        _mutex.lock();
+        if (!isReadyRead) {
+            _parser.clear(); // the rest of the reply is lost
+            this->abortAsyncRequests_unsafe("Context waitForReadyRead failed!");
+            break;
+        }
+        QString error;
+        if (!_parser.appendRawData(_context->readRawData(), error)) {
+            this->abortAsyncRequests_unsafe(error);
+            break;
+        }
+    }
+    this->flushPipeline_unsafe(); // requests queued by sendCommandAsync()
+    _isPipelineFlushing = false;
+    _pipelineCondition.wakeAll();
+}
+
+//!
+//! \brief Ожидать завершения обмена данными потоком-лидером автоматической конвейеризации
+//!
+void QtRedisTransporter::waitPipelineFlush_unsafe()
+{
+    while (_isPipelineFlushing)
+        _pipelineCondition.wait(&_mutex);
+}
+
+//!
+//! \brief Забрать разобранные ответы асинхронных запросов
+//!
+//! Replies are matched with the pending requests in FIFO order.
+//!
+void QtRedisTransporter::takeAsyncReplies_unsafe()
+{
+    QtRedisReply pushReplyList(QtRedisReply::ReplyType::Array);
+    this->takePushReplies_unsafe(&_parser, false, pushReplyList);
+    while (!_asyncRequests.isEmpty()
+           && _parser.hasReplies()) {
+        const AsyncRequest request = _asyncRequests.takeFirst();
+        AsyncReply reply;
+        reply.callback = request.callback;
+        reply.reply = _parser.takeReply();
+        reply.error = this->replyErrorMessage(reply.reply);
+        if (this->isCommandSession(request.command))
+            this->checkCommandResult(_context, request.command, reply.reply);
+
+        if (request.streaming) {
+            request.streaming->replies.append(reply.reply);
+            request.streaming->inFlight--;
+            continue;
+        }
+        PipelineRequest *waiter = (request.waiter ? request.waiter : request.deferred.get());
+        if (waiter) {
+            waiter->reply = reply.reply;
+            waiter->error = reply.error;
+            waiter->isOk = true;
+            waiter->isDone = true;
+            _pipelineCondition.wakeAll();
+            continue;
+        }
+        this->appendAsyncReply_unsafe(reply);
+    }
+}
+
+//!
+//! \brief Ожидать ответы всех асинхронных запросов
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! Used by the synchronous commands to keep the order of replies on the connection.
+//!
+bool QtRedisTransporter::waitAsyncReplies_unsafe(QString &error)
+{
+    this->waitPipelineFlush_unsafe();
+    while (true) {
+        this->takeAsyncReplies_unsafe();
+        if (_asyncRequests.isEmpty())
+            return true;
+        if (!_context->canReadRawData()
+            && !_context->waitForReadyRead()) {
+            _parser.clear(); // the rest of the reply is lost
+            error = QString("Context waitForReadyRead failed!");
+            this->abortAsyncRequests_unsafe(error);
+            return false;
+        }
+        if (!_parser.appendRawData(_context->readRawData(), error)) {
+            this->abortAsyncRequests_unsafe(error);
+            return false;
+        }
+    }
+}
+
+//!
+//! \brief Завершить все асинхронные запросы с ошибкой
+//! \param error Сообщение об ошибке
+//!
+void QtRedisTransporter::abortAsyncRequests_unsafe(const QString &error)
+{
+    _asyncRequests.append(_pipelineRequests);
+    _pipelineRequests.clear();
+    _pipelineData.clear();
+    while (!_asyncRequests.isEmpty()) {
+        const AsyncRequest request = _asyncRequests.takeFirst();
+        if (request.streaming) {
+            request.streaming->error = error;
+            request.streaming->inFlight--;
+            continue;
+        }
+        PipelineRequest *waiter = (request.waiter ? request.waiter : request.deferred.get());
+        if (waiter) {
+            waiter->error = error;
+            waiter->isDone = true;
+            _pipelineCondition.wakeAll();
+            continue;
+        }
+        AsyncReply reply;
+        reply.callback = request.callback;
+        reply.error = error;
+        this->appendAsyncReply_unsafe(reply);
+    }
+}
+
+//!
+//! \brief Добавить ответ асинхронного запроса в очередь вызова функций обработки
+//! \param reply Ответ
+//!
+void QtRedisTransporter::appendAsyncReply_unsafe(const AsyncReply &reply)
+{
+    if (!reply.callback)
+        return;
+    if (_asyncReplies.isEmpty())
+        QMetaObject::invokeMethod(this, "onAsyncReplies", Qt::QueuedConnection);
+
+    _asyncReplies.append(reply);
+}
+
+//!
+//! \brief Количество ответов сервера на команду
+//! \param command Команда
+//! \return
+//!
+//! Commands SUBSCRIBE/UNSUBSCRIBE/PSUBSCRIBE/PUNSUBSCRIBE/SSUBSCRIBE/SUNSUBSCRIBE
+//! receive one reply for each channel (pattern) passed as an argument.
+//!
+//! Note: If the number of replies is unknown (for example UNSUBSCRIBE without arguments), returns 0.
+//!
+int QtRedisTransporter::commandReplyCount(const QtRedisCommand &command) const
+{
+    if (this->isCommandChannel(command))
+        return command.commandArgv().size();
+
+    return 1;
+}
+
+//!
+//! \brief Сообщение об ошибке из ответа сервера
+//! \param reply Ответ сервера
+//! \return
+//!
+//! Returns the error message, if the last parsed element of the reply is the error object.
+//!
+QString QtRedisTransporter::replyErrorMessage(const QtRedisReply &reply) const
+{
+    if (reply.isError())
+        return reply.strValue();
+    if (reply.isArray() && !reply.isArrayValueEmpty())
+        return this->replyErrorMessage(reply.arrayValueLast_ref());
+
+    return QString();
+}
+
+//!
+//! \brief Проверка команды и ее результата
+//! \param command Команда
+//! \param reply Результат
+//!
+//! Данный метод нужен для проверки системных команд (смена текущей БД и пр.)
+//! и отслеживания их результата.
+//!
+//! The successful commands of the main connection are stored in the state of the session (see restoreSession()).
+//!
+void QtRedisTransporter::checkCommandResult(QtRedisContext *context, const QtRedisCommand &command, const QtRedisReply &reply)
+{
+    if (!command.isValid())
+        return;
+
+    const bool isOk = (reply.type() == QtRedisReply::ReplyType::Status
+                       && reply.strValue() == QString("OK"));
+    // check select db
+    if (command.size() == 2
+        && command.command() == QString("SELECT")
+        && isOk) {
+        context->setCurrentDbIndex(command.commandArgv().constFirst().toInt());
+        if (context == _context)
+            _session.dbIndex = context->currentDbIndex();
+    }
+    if (context != _context)
+        return;
+
+    // check auth, protocol & client name
+    if (command.command() == QString("AUTH") && isOk) {
+        _session.auth = command.commandArgv();
+    } else if (command.command() == QString("HELLO")
+               && !command.commandArgv().isEmpty()
+               && (reply.isMap() || reply.isArray())) {
+        _session.hello = command.commandArgv();
+        _protocolVersion = command.commandArgv().constFirst().toInt();
+        // RESP2 messages of the subscribed connection are arrays, RESP3 messages are push replies
+        _parser.setChannelMessagesAsPush(_protocolVersion == 2
+                                         && _channelMode == ChannelMode::CurrentConnection
+                                         && _session.hasSubscriptions());
+    } else if (command.command() == QString("CLIENT")
+               && command.size() == 3
+               && command.commandArgv().constFirst().toUpper() == "SETNAME"
+               && isOk) {
+        _session.clientName = command.commandArgv().constLast();
+    }
+}
+
+//!
+//! \brief Обновить список подписок сессии по команде подписки (отписки) на каналы
+//! \param command Команда (выполнена без ошибок)
+//!
+void QtRedisTransporter::updateSubscriptions_unsafe(const QtRedisCommand &command)
+{
+    const QByteArray &name = command.command();
+    QSet<QByteArray> *subscriptions = &_session.channels;
+    if (name.startsWith('P'))
+        subscriptions = &_session.patterns;
+    else if (name.startsWith('S'))
+        subscriptions = &_session.shardChannels;
+
+    if (!name.endsWith("UNSUBSCRIBE")) {
+        for (const QByteArray &channel : command.commandArgv())
+            subscriptions->insert(channel);
         return;
-    QByteArray replyData;
-    const qint64 bytesAvailable = context->bytesAvailable();
-    if (bytesAvailable <= 0)
+    }
+    if (command.commandArgv().isEmpty()) {
+        subscriptions->clear();
         return;
+    }
+    for (const QByteArray &channel : command.commandArgv())
+        subscriptions->remove(channel);
+}
+
+//!
+//! \brief Команды восстановления состояния сессии
+//! \param isMainContext Команды основного соединения
+//! \param isChannelContext Команды соединения для pub/sub
+//! \return
+//!
+//! The order is AUTH, HELLO, CLIENT SETNAME, SELECT, SCRIPT LOAD, then the channel commands
+//! (RESP2 accepts only the channel commands on the subscribed connection).
+//!
+QList<QtRedisCommand> QtRedisTransporter::sessionCommands_unsafe(const bool isMainContext, const bool isChannelContext) const
+{
+    QList<QtRedisCommand> commands;
+    if (!_session.auth.isEmpty())
+        commands.append(QtRedisCommand("AUTH", _session.auth));
+    if (isMainContext) {
+        if (!_session.hello.isEmpty())
+            commands.append(QtRedisCommand("HELLO", _session.hello));
+        if (!_session.clientName.isEmpty())
+            commands.append(QtRedisCommand("CLIENT") << "SETNAME" << _session.clientName);
+        if (_session.dbIndex != 0)
+            commands.append(QtRedisCommand("SELECT") << _session.dbIndex);
+        for (const QtRedisScript &script : _session.scripts)
+            commands.append(script.loadCommand());
+    }
+    if (isChannelContext) {
+        if (!_session.channels.isEmpty())
+            commands.append(QtRedisCommand("SUBSCRIBE", _session.channels.values()));
+        if (!_session.patterns.isEmpty())
+            commands.append(QtRedisCommand("PSUBSCRIBE", _session.patterns.values()));
+        if (!_session.shardChannels.isEmpty())
+            commands.append(QtRedisCommand("SSUBSCRIBE", _session.shardChannels.values()));
+    }
+    return commands;
+}
+
+//!
+//! \brief Восстановить состояние сессии соединения
+//! \param context Контекст
+//! \param commands Команды восстановления (см. sessionCommands_unsafe())
+//! \param error Сообщение об ошибке
+//! \return
+//!
+//! The commands are written at once and all replies are read by one round trip,
+//! the error reply of any command fails the restoration (the error names the command).
+//! The replies are not awaited after the first error reply, the connection should be reconnected.
+//!
+bool QtRedisTransporter::restoreContextSession_unsafe(QtRedisContext *context, const QList<QtRedisCommand> &commands, QString &error)
+{
+    error.clear();
+    if (commands.isEmpty())
+        return true;
+    if (context == _context
+        && !this->waitAsyncReplies_unsafe(error))
+        return false;
+    int replyCount = 0;
+    int dataSize = 0;
+    int sessionCommandCount = 0; // the commands before the channel commands (one reply for each)
+    for (const QtRedisCommand &command : commands) {
+        replyCount += this->commandReplyCount(command);
+        if (!this->isCommandChannel(command))
+            sessionCommandCount++;
+        dataSize += QtRedisParser::rawDataSize(command);
+    }
+    const bool hasChannelCommands = (sessionCommandCount < commands.size());
+    int protocolVersion = _protocolVersion; // the version of the channel commands (after HELLO)
+    for (const QtRedisCommand &command : commands) {
+        if (command.command() == QString("HELLO")
+            && !command.commandArgv().isEmpty())
+            protocolVersion = command.commandArgv().constFirst().toInt();
+    }
+    QByteArray data;
+    data.reserve(dataSize);
+    for (const QtRedisCommand &command : commands)
+        QtRedisParser::appendRawData(data, command);
+
+    QtRedisStreamParser *parser = this->contextParser_unsafe(context);
+    parser->clearReplies();
+    if (hasChannelCommands && protocolVersion == 2) // RESP3 messages are push replies, the arrays are always replies
+        parser->setChannelMessagesAsPush(true); // the messages may arrive before the confirmations
+    context->writeRawData(data);
+    QtRedisReply replyList(QtRedisReply::ReplyType::Array);
+    QtRedisReply pushReplyList(QtRedisReply::ReplyType::Array); // RESP3 confirmations of the channel commands
+    bool isErrorReply = false;
     while (true) {
-        replyData += context->readRawData();
-        if (replyData.size() >= bytesAvailable)
+        this->takePushReplies_unsafe(parser, hasChannelCommands, pushReplyList);
+        if (parser->hasReplies()) {
+            const QtRedisReply replies = parser->takeReplies();
+            for (const QtRedisReply &value : replies.arrayValue_ref()) {
+                replyList.appendArrayValue(value);
+                isErrorReply = isErrorReply || value.isError();
+            }
+        }
+        if (isErrorReply // the failed channel command sends one error instead of the confirmations
+            || replyList.arrayValueSize() + pushReplyList.arrayValueSize() >= replyCount)
             break;
+        if (!context->canReadRawData()
+            && !context->waitForReadyRead()) {
+            parser->clear(); // the rest of the reply is lost
+            error = QString("Context waitForReadyRead failed!");
+            return false;
+        }
+        if (!parser->appendRawData(context->readRawData(), error))
+            return false;
+    }
+    // the replies of the session commands go first (the channel commands are the last ones)
+    for (int index = 0; index < replyList.arrayValueSize(); ++index) {
+        const QtRedisReply &value = replyList.arrayValueAt_ref(index);
+        if (value.isError()) {
+            const QString commandName = (index < sessionCommandCount ? QString(commands.at(index).command())
+                                                                     : QString("Channel command"));
+            error = QString("%1 failed: %2").arg(commandName, value.strValue());
+            return false;
+        }
+        if (index < sessionCommandCount && this->isCommandSession(commands.at(index)))
+            this->checkCommandResult(context, commands.at(index), value);
+    }
+    for (const QtRedisReply &value : pushReplyList.arrayValue_ref()) {
+        if (value.isError()) {
+            error = QString("Channel command failed: %1").arg(value.strValue());
+            return false;
+        }
+    }
+    return true;
+}
+
+//!
+//! \brief Восстановить состояние сессии после переподключения (все соединения)
+//! \param error Сообщение об ошибке
+//! \return
+//!
+bool QtRedisTransporter::restoreSession_unsafe(QString &error)
+{
+    error.clear();
+    if (!_context) {
+        error = QString("QtRedisTransporter is not initialyzed!");
+        return false;
+    }
+    const bool isSeparateConnection = (_channelMode == ChannelMode::SeparateConnection);
+    if (!this->restoreContextSession_unsafe(_context, this->sessionCommands_unsafe(true, !isSeparateConnection), error))
+        return false;
+    if (!isSeparateConnection
+        || !_contextSub
+        || !_session.hasSubscriptions())
+        return true;
+
+    return this->restoreContextSession_unsafe(_contextSub, this->sessionCommands_unsafe(false, true), error);
+}
+
+//!
+//! \brief Запланировать попытку переподключения
+//!
+//! The delay grows exponentially from the minimal to the maximal one, a random half of the delay
+//! is subtracted (jitter), so the clients of the restarted server do not reconnect at the same moment.
+//!
+//! Warn: Must be called in the thread of the transporter object!
+//!
+void QtRedisTransporter::scheduleReconnect_unsafe()
+{
+    const int shift = qMin(_reconnectAttempt, 16);
+    const qint64 delay = qMin(static_cast<qint64>(_reconnectMinDelayMSec) << shift,
+                              static_cast<qint64>(_reconnectMaxDelayMSec));
+    const int halfDelay = static_cast<int>(delay / 2);
+    _reconnectAttempt++;
+    _reconnectTimer->start(static_cast<int>(delay) - QRandomGenerator::global()->bounded(halfDelay + 1));
+}
+
+//!
+//! \brief Слот обработки подключения к Redis
+//!
+void QtRedisTransporter::onConnected()
+{
+    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
+    if (!context)
+        return;
+    emit this->contextConnected(context->uid(), context->host(), context->port(), context->currentDbIndex());
+}
+
+//!
+//! \brief Слот обработки отключения от Redis
+//!
+void QtRedisTransporter::onDisconnected()
+{
+    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
+    if (!context)
+        return;
+    QMutexLocker lock(&_mutex);
+    this->waitPipelineFlush_unsafe();
+    if (context == _context)
+        this->abortAsyncRequests_unsafe("Disconnected from the server!");
+    if (_isAutoReconnect
+        && _isReconnectArmed
+        && !_reconnectTimer->isActive()
+        && !context->isConnected() // the signal of the previous attempt
+        && (context == _context || (context == _contextSub && _session.hasSubscriptions())))
+        this->scheduleReconnect_unsafe();
+    lock.unlock();
+    emit this->contextDisconnected(context->uid(), context->host(), context->port(), context->currentDbIndex());
+}
+
+//!
+//! \brief Слот чтения ответов от сервера Redis (основное соединение)
+//!
+//! Replies are passed to the pending asynchronous requests. In the ChannelMode::CurrentConnection mode
+//! the rest of the replies are processed as incoming channel messages.
+//!
+void QtRedisTransporter::onReadyRead()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_context
+        || _isPipelineFlushing // the data is read by the leader of the auto-pipelining
+        || !_context->canReadRawData())
+        return;
+    QString error;
+    if (!_parser.appendRawData(_context->readRawData(), error)) {
+        qWarning() << qPrintable(QString("[QtRedisTransporter][onReadyRead] %1").arg(error));
+        this->abortAsyncRequests_unsafe(error);
+        return;
+    }
+    this->takeAsyncReplies_unsafe();
+    if (_channelMode != ChannelMode::CurrentConnection
+        || !_parser.hasReplies())
+        return;
+    const QtRedisReply replyList = _parser.takeReplies();
+    lock.unlock();
+    this->emitChannelMessages(replyList.arrayValue_ref());
+}
+
+//!
+//! \brief Слот чтения входящих сообщений от сервера Redis
+//!
+void QtRedisTransporter::onReadyReadSub()
+{
+    QtRedisContext *context = qobject_cast<QtRedisContext*>(sender());
+    if (!context)
+        return;
+    this->readContextSub(context);
+}
+
+//!
+//! \brief Прочитать входящие сообщения соединения подписки
+//! \param context Контекст (nullptr - текущий контекст подписки)
+//!
+//! While the queue of the messages is full (BlockReader), the connection is not read
+//! and the reading is resumed by takeChannelMessages().
+//!
+void QtRedisTransporter::readContextSub(QtRedisContext *context)
+{
+    QMutexLocker lock(&_mutex);
+    if (!context)
+        context = _contextSub;
+    if (!context
+        || context != _contextSub)
+        return;
+    if (_channelQueuePolicy == ChannelQueuePolicy::BlockReader
+        && this->isChannelQueueFull_unsafe()) {
+        _isChannelReadPaused = true;
+        return;
     }
-    if (replyData.isEmpty())
+    if (!context->canReadRawData())
         return;
-//    qDebug() << "===>" << replyData;
     QString error;
-    bool isOk = false;
-    const QtRedisReply replyList = QtRedisParser::parseRawData(replyData, error, &isOk);
-    if (!isOk)
+    QtRedisStreamParser *parser = this->contextParser_unsafe(context);
+    if (!parser->appendRawData(context->readRawData(), error)) {
+        qWarning() << qPrintable(QString("[QtRedisTransporter][readContextSub] %1").arg(error));
+        context->disconnectFromServer(); // the stream is out of sync, the next messages can not be parsed
+        return;
+    }
+    if (!parser->hasReplies() && !parser->hasPushReplies())
+        return;
+    const QtRedisReply replyList = parser->takeReplies();
+    const QtRedisReply pushReplyList = parser->takePushReplies();
+    lock.unlock();
+    this->emitChannelMessages(replyList.arrayValue_ref());
+    this->emitChannelMessages(pushReplyList.arrayValue_ref());
+}
+
+//!
+//! \brief Слот обработки сообщений каналов, полученных во время выполнения команд (RESP3 push)
+//!
+void QtRedisTransporter::onChannelMessages()
+{
+    QMutexLocker lock(&_mutex);
+    const QVector<QtRedisReply> replyList = _channelMessages.toVector();
+    _channelMessages.clear();
+    lock.unlock();
+    this->emitChannelMessages(replyList);
+}
+
+//!
+//! \brief Слот вызова функций обработки ответов асинхронных запросов
+//!
+void QtRedisTransporter::onAsyncReplies()
+{
+    QMutexLocker lock(&_mutex);
+    const QList<AsyncReply> replyList = _asyncReplies;
+    _asyncReplies.clear();
+    lock.unlock();
+    for (const AsyncReply &reply : replyList)
+        reply.callback(reply.reply, reply.error);
+}
+
+//!
+//! \brief Слот попытки автоматического переподключения
+//!
+//! Only the dropped connection is reconnected and its session is restored: the loss of the connection
+//! for pub/sub does not abort the asynchronous requests of the main connection.
+//! On failure the next attempt is scheduled with the greater delay, the connection with the failed
+//! restoration is closed, so the next attempt reconnects it.
+//!
+//! Warn: The connection and the restoration are synchronous, the event loop of the thread
+//! of the transporter is blocked for up to the timeout of the connect (and of the replies) per connection.
+//!
+void QtRedisTransporter::onReconnectTimeout()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_context
+        || !_isAutoReconnect
+        || !_isReconnectArmed)
+        return;
+    const bool isMainDropped = !_context->isConnected();
+    const bool isSubDropped = (_contextSub && !_contextSub->isConnected() && _session.hasSubscriptions());
+    if (!isMainDropped && !isSubDropped) {
+        _reconnectAttempt = 0; // reconnected by the caller
         return;
-    for (const QtRedisReply &reply : replyList.arrayValue_ref()) {
-        if (reply.type() == QtRedisReply::ReplyType::Array
-            && reply.arrayValueSize() == 3
-            && reply.arrayValue().at(0).strValue() == "message")
-            emit this->incomingChannelMessage(reply.arrayValue().at(1).strValue(), reply.arrayValue().at(2));
-
-        else if (reply.type() == QtRedisReply::ReplyType::Array
-                 && reply.arrayValueSize() == 3
-                 && reply.arrayValue().at(0).strValue() == "smessage")
-            emit this->incomingChannelShardMessage(reply.arrayValue().at(1).strValue(), reply.arrayValue().at(2));
-
-        else if (reply.type() == QtRedisReply::ReplyType::Array
-                 && reply.arrayValueSize() == 4
-                 && reply.arrayValue().at(0).strValue() == "pmessage")
-            emit this->incomingChannelPatternMessage(reply.arrayValue().at(1).strValue(), reply.arrayValue().at(2).strValue(), reply.arrayValue().at(3));
     }
+    struct RestoredContext {
+        QString uid;
+        QString host;
+        int port;
+        int dbIndex;
+    };
+    QList<QtRedisContext*> contexts;
+    if (isMainDropped)
+        contexts.append(_context);
+    if (isSubDropped)
+        contexts.append(_contextSub);
+    QString error;
+    QList<RestoredContext> restoredContexts;
+    for (QtRedisContext *context : contexts) {
+        const bool isMainContext = (context == _context);
+        const bool isChannelContext = (!isMainContext || _channelMode == ChannelMode::CurrentConnection);
+        if (!this->reconnectContext_unsafe(context, error))
+            break;
+        if (!this->restoreContextSession_unsafe(context, this->sessionCommands_unsafe(isMainContext, isChannelContext), error)) {
+            context->disconnectFromServer(); // the next attempt reconnects it
+            break;
+        }
+        restoredContexts.append({context->uid(), context->host(), context->port(), context->currentDbIndex()});
+    }
+    if (restoredContexts.size() == contexts.size()) {
+        _reconnectAttempt = 0;
+    } else {
+        qWarning() << qPrintable(QString("[QtRedisTransporter][onReconnectTimeout] %1").arg(error));
+        this->scheduleReconnect_unsafe();
+    }
+    lock.unlock();
+    for (const RestoredContext &restored : restoredContexts)
+        emit this->contextRestored(restored.uid, restored.host, restored.port, restored.dbIndex);
 }
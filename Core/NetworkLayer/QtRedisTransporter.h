@@ -3,12 +3,24 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
 #include <QString>
 #include <QList>
+#include <QHash>
+#include <QSet>
+#include <QVector>
+#include <QTimer>
+
+#include <functional>
+#include <memory>
 
 #include "QtRedisContext.h"
+#include "QtRedisStreamParser.h"
 #include "../QtRedisCommand.h"
 #include "../QtRedisReply.h"
+#include "../QtRedisReplyTree.h"
+#include "../QtRedisScript.h"
 
 //!
 //! \file QtRedisTransporter.h
@@ -38,6 +50,100 @@ public:
         SeparateConnection      //!< использовать отдельное соединение для pub/sub
     };
 
+    //!
+    //! \brief Функция обработки ответа асинхронной команды
+    //!
+    //! Called with the reply of the server and the error message (empty on success).
+    //!
+    typedef std::function<void(const QtRedisReply &reply, const QString &error)> ReplyCallback;
+
+    //!
+    //! \brief Сообщение канала
+    //!
+    //! The fields are own copies of the data (valid after the handler returns), without conversion to QString.
+    //!
+    struct ChannelMessage {
+        //!
+        //! \brief Типы сообщений
+        //!
+        enum class Type {
+            Message = 0,    //!< сообщение канала (SUBSCRIBE)
+            ShardMessage,   //!< сообщение шардированного канала (SSUBSCRIBE)
+            PatternMessage  //!< сообщение канала по шаблону (PSUBSCRIBE)
+        };
+
+        Type        type {Type::Message};   //!< тип сообщения
+        QByteArray  pattern;                //!< шаблон (Type::PatternMessage)
+        QByteArray  channel;                //!< канал
+        QByteArray  payload;                //!< данные
+    };
+
+    //!
+    //! \brief Политики переполнения очереди сообщений каналов (см. setChannelQueue())
+    //!
+    enum class ChannelQueuePolicy {
+        BlockReader = 0,    //!< приостановить чтение соединения (TCP backpressure)
+        DropOldest,         //!< удалить самое старое сообщение
+        DropNewest,         //!< отбросить новое сообщение
+        CoalesceByChannel   //!< заменить сообщение того же канала (или удалить самое старое)
+    };
+
+    //!
+    //! \brief Функция обработки сообщения канала
+    //!
+    //! Called with the channel and the payload of the message.
+    //!
+    //! Note: The arguments are own copies of the data, they may be stored by the handler.
+    //!
+    typedef std::function<void(const QByteArray &channel, const QByteArray &payload)> MessageHandler;
+
+    //!
+    //! \brief Функция обработки пакета сообщений каналов
+    //!
+    //! Called with all messages received by one read of the connection (in the order of receipt).
+    //!
+    typedef std::function<void(const QVector<ChannelMessage> &messages)> MessageBatchHandler;
+
+    //!
+    //! \brief Параметры подключения (см. setConnectionOptions())
+    //!
+    struct ConnectionOptions {
+        QString userName;               //!< имя пользователя ACL (пусто - пользователь default)
+        QString password;               //!< пароль (пусто - без авторизации)
+        int     dbIndex {0};            //!< индекс БД
+        QString clientName;             //!< имя соединения (пусто - без имени)
+        int     protocolVersion {2};    //!< версия протокола RESP (2 или 3)
+    };
+
+    //!
+    //! \brief Синхронный запрос, ожидающий ответа (автоматическая конвейеризация, отложенные команды)
+    //!
+    struct PipelineRequest {
+        QtRedisReply    reply;          //!< ответ сервера
+        QString         error;          //!< сообщение об ошибке
+        bool            isOk {false};   //!< получен ли ответ
+        bool            isDone {false}; //!< завершен ли запрос
+    };
+
+    //!
+    //! \brief Отложенный запрос (см. sendCommandDeferred())
+    //!
+    typedef std::shared_ptr<PipelineRequest> DeferredRequest;
+
+    //!
+    //! \brief Состояние потоковой отправки команд (см. sendCommandsStreamed())
+    //!
+    struct StreamingState {
+        QList<QtRedisReply> replies;        //!< полученные ответы, еще не переданные отправителю
+        QString             error;          //!< сообщение об ошибке соединения
+        int                 inFlight {0};   //!< количество отправленных команд, ожидающих ответа
+    };
+
+    //!
+    //! \brief Потоковая отправка команд
+    //!
+    typedef std::shared_ptr<StreamingState> StreamingRequest;
+
     explicit QtRedisTransporter(const QtRedisTransporter::ChannelMode contextChannelMode);
     ~QtRedisTransporter();
 
@@ -47,10 +153,15 @@ public:
     QString host() const;
     int port() const;
     int currentDbIndex() const;
+    int protocolVersion() const;
+    void setProtocolVersion(const int protocolVersion);
 
     void setSslConfig(const QSslConfiguration &sslConfig);
     QSslConfiguration sslConfig() const;
 
+    void setIoThreadMode(const bool enable);
+    bool isIoThreadMode() const;
+
     bool initTransporter(const Type &type,
                          const QString &host,
                          const int port,
@@ -60,6 +171,8 @@ public:
 
     bool connectToServer(QString &error, const int timeoutMSec = 0);
     bool reconnectToServer(QString &error, const int timeoutMSec = 0);
+    bool restoreSession(QString &error);
+    void setConnectionOptions(const ConnectionOptions &options);
     bool subscribeToServer(QString &error, const int timeoutMSec = 0);
     void unsubscribeFromServer();
     void disconnectFromServer();
@@ -68,16 +181,111 @@ public:
 
     QtRedisReply sendCommand(const QtRedisCommand &command, QString &error, bool *ok = 0);
     QtRedisReply sendCommands(const QList<QtRedisCommand> &commands, QString &error, bool *ok = 0);
+    QtRedisReply sendCommandsEncoded(const QList<QtRedisCommand> &commands, const QByteArray &data, QString &error, bool *ok = 0);
 
     QtRedisReply sendChannelCommand(const QtRedisCommand &command, QString &error, bool *ok = 0);
 
+    QtRedisReplyTree sendCommandTree(const QtRedisCommand &command, QString &error, bool *ok = 0);
+
+    QtRedisReply sendCommandPipelined(const QtRedisCommand &command, QString &error, bool *ok = 0);
+
+    bool sendCommandAsync(const QtRedisCommand &command, const ReplyCallback &callback, QString &error);
+    int asyncRequestsCount() const;
+
+    DeferredRequest sendCommandDeferred(const QtRedisCommand &command, QString &error);
+    QtRedisReply waitDeferredReply(const DeferredRequest &request, QString &error, bool *ok = 0);
+
+    bool sendCommandsStreamed(const StreamingRequest &request,
+                              const QList<QtRedisCommand> &commands,
+                              const int maxInFlight,
+                              QList<QtRedisReply> &replies,
+                              QString &error);
+
+    bool loadScripts(const QList<QtRedisScript> &scripts, QString &error);
+
+    void setChannelHandler(const QByteArray &channel, const MessageHandler &handler);
+    void setChannelBatchHandler(const MessageBatchHandler &handler);
+
+    void setChannelQueue(const int limit, const ChannelQueuePolicy policy = ChannelQueuePolicy::DropOldest);
+    int channelQueueSize() const;
+    qint64 channelMessagesDropped() const;
+    QVector<QtRedisReply> takeChannelMessages();
+
+    void setAutoReconnect(const bool enable, const int minDelayMSec = 100, const int maxDelayMSec = 30000);
+    bool isAutoReconnect() const;
+
 protected:
+    //!
+    //! \brief Состояние сессии, восстанавливаемое после переподключения (см. restoreSession())
+    //!
+    struct SessionState {
+        QList<QByteArray>   auth;           //!< аргументы команды AUTH
+        QList<QByteArray>   hello;          //!< аргументы команды HELLO
+        QByteArray          clientName;     //!< имя соединения (CLIENT SETNAME)
+        int                 dbIndex {0};    //!< индекс БД (SELECT)
+        QList<QtRedisScript> scripts;       //!< загруженные скрипты (SCRIPT LOAD)
+        QSet<QByteArray>    channels;       //!< каналы (SUBSCRIBE)
+        QSet<QByteArray>    patterns;       //!< шаблоны каналов (PSUBSCRIBE)
+        QSet<QByteArray>    shardChannels;  //!< шардированные каналы (SSUBSCRIBE)
+
+        bool hasSubscriptions() const {
+            return !channels.isEmpty() || !patterns.isEmpty() || !shardChannels.isEmpty();
+        }
+    };
+
+    //!
+    //! \brief Асинхронный запрос, ожидающий ответа
+    //!
+    struct AsyncRequest {
+        QtRedisCommand  command;            //!< команда
+        ReplyCallback   callback;           //!< функция обработки ответа
+        PipelineRequest *waiter {nullptr};  //!< ожидающий синхронный запрос (вместо функции обработки ответа)
+        DeferredRequest deferred;           //!< отложенный запрос (вместо функции обработки ответа)
+        StreamingRequest streaming;         //!< потоковая отправка (вместо функции обработки ответа)
+    };
+
+    //!
+    //! \brief Полученный ответ асинхронного запроса
+    //!
+    struct AsyncReply {
+        ReplyCallback   callback;   //!< функция обработки ответа
+        QtRedisReply    reply;      //!< ответ сервера
+        QString         error;      //!< сообщение об ошибке
+    };
+
     Type            _type {Type::NoType};                            //!< тип
     ChannelMode     _channelMode {ChannelMode::CurrentConnection};   //!< тип соединения для pub/sub
     int             _timeoutMSec {0};                                //!< время ожидания мсек
+    int             _protocolVersion {2};                            //!< версия протокола RESP (см. HELLO)
 
     QtRedisContext  *_context {nullptr};                             //!< контекс redis-a
     QtRedisContext  *_contextSub {nullptr};                          //!< контекс redis-a для subscribe
+    bool            _isIoThreadMode {false};                         //!< обслуживаются ли сокеты потоком ввода-вывода
+    QThread         *_ioThread {nullptr};                            //!< поток ввода-вывода (владеет сокетами контекстов)
+
+    QtRedisStreamParser _parser;                                     //!< потоковый парсер ответов контекста redis-a
+    QtRedisStreamParser _parserSub;                                  //!< потоковый парсер ответов контекста redis-a для subscribe
+    QList<QtRedisReply> _channelMessages;                            //!< очередь сообщений каналов, полученных во время выполнения команд (RESP3 push)
+    QList<AsyncRequest> _asyncRequests;                              //!< очередь асинхронных запросов, ожидающих ответа (FIFO)
+    QList<AsyncReply>   _asyncReplies;                               //!< очередь полученных ответов асинхронных запросов
+    QList<AsyncRequest> _pipelineRequests;                           //!< очередь запросов, ожидающих отправки (автоматическая конвейеризация)
+    QByteArray          _pipelineData;                               //!< данные запросов, ожидающих отправки (автоматическая конвейеризация)
+    bool                _isPipelineFlushing {false};                 //!< выполняет ли поток-лидер обмен данными с сервером
+    QWaitCondition      _pipelineCondition;                          //!< условие завершения обмена данными потоком-лидером
+    QHash<QByteArray, MessageHandler> _channelHandlers;              //!< функции обработки сообщений каналов (канал или шаблон)
+    MessageBatchHandler _channelBatchHandler;                        //!< функция обработки пакета сообщений каналов
+    int                 _channelQueueLimit {0};                      //!< размер очереди сообщений каналов (0 - без очереди)
+    ChannelQueuePolicy  _channelQueuePolicy {ChannelQueuePolicy::DropOldest}; //!< политика переполнения очереди
+    QList<QtRedisReply> _channelQueue;                               //!< очередь сообщений каналов для получателей
+    qint64              _channelDropped {0};                         //!< количество отброшенных сообщений каналов
+    bool                _isChannelReadPaused {false};                //!< приостановлено ли чтение соединения подписки
+    SessionState        _session;                                    //!< состояние сессии (восстанавливается после переподключения)
+    bool                _isAutoReconnect {false};                    //!< режим автоматического переподключения
+    bool                _isReconnectArmed {false};                   //!< подключен ли пользователем (переподключаться при разрыве)
+    int                 _reconnectMinDelayMSec {100};                //!< минимальная задержка переподключения мсек
+    int                 _reconnectMaxDelayMSec {30000};              //!< максимальная задержка переподключения мсек
+    int                 _reconnectAttempt {0};                       //!< номер попытки переподключения
+    QTimer              *_reconnectTimer {nullptr};                  //!< таймер переподключения
 
     mutable QMutex  _mutex;                                          //!< мьютекс
 
@@ -86,25 +294,64 @@ protected:
                                        const int port);
 
     QtRedisContext *channelContext_unsafe() const;
+    QtRedisStreamParser *contextParser_unsafe(QtRedisContext *context);
 
     QtRedisReply sendContextCommand(QtRedisContext *context, const QtRedisCommand &command, QString &error, bool *ok = 0);
     QtRedisReply sendContextCommands(QtRedisContext *context, const QList<QtRedisCommand> &commands, QString &error, bool *ok = 0);
+    QtRedisReply sendContextCommandsData(QtRedisContext *context,
+                                         const QList<QtRedisCommand> &commands,
+                                         const QByteArray &data,
+                                         QString &error,
+                                         bool *ok = 0);
 
-    bool isCommandSelect(const QtRedisCommand &command) const;
+    bool isCommandSession(const QtRedisCommand &command) const;
+    bool isCommandChannel(const QtRedisCommand &command) const;
+    bool isChannelMessage(const QtRedisReply &reply) const;
+    int channelSubscriptionCount(const QtRedisReply &reply) const;
+    void takePushReplies_unsafe(QtRedisStreamParser *parser, const bool isChannelCommand, QtRedisReply &replyList);
+    void emitChannelMessages(const QVector<QtRedisReply> &replyList);
+    bool enqueueChannelMessages(const QVector<QtRedisReply> &replyList);
+    bool isChannelQueueFull_unsafe() const;
+    void applyChannelReadBufferSize_unsafe();
+    void readContextSub(QtRedisContext *context);
+    void appendPipelineRequest_unsafe(const AsyncRequest &request);
+    void flushPipeline_unsafe();
+    void processPipeline_unsafe(const PipelineRequest &request);
+    void waitPipelineFlush_unsafe();
+    void takeAsyncReplies_unsafe();
+    bool waitAsyncReplies_unsafe(QString &error);
+    void abortAsyncRequests_unsafe(const QString &error);
+    void appendAsyncReply_unsafe(const AsyncReply &reply);
+    int commandReplyCount(const QtRedisCommand &command) const;
+    QString replyErrorMessage(const QtRedisReply &reply) const;
     void checkCommandResult(QtRedisContext *context, const QtRedisCommand &command, const QtRedisReply &reply);
+    void updateSubscriptions_unsafe(const QtRedisCommand &command);
+    bool reconnectToServer_unsafe(QString &error, const int timeoutMSec);
+    bool reconnectContext_unsafe(QtRedisContext *context, QString &error);
+    QList<QtRedisCommand> sessionCommands_unsafe(const bool isMainContext, const bool isChannelContext) const;
+    bool restoreContextSession_unsafe(QtRedisContext *context, const QList<QtRedisCommand> &commands, QString &error);
+    bool restoreSession_unsafe(QString &error);
+    void scheduleReconnect_unsafe();
 
 protected slots:
     void onConnected();
     void onDisconnected();
+    void onReadyRead();
     void onReadyReadSub();
+    void onChannelMessages();
+    void onAsyncReplies();
+    void onReconnectTimeout();
 
 signals:
     void contextConnected(QString contextUid, QString host, int port, int dbIndex);
     void contextDisconnected(QString contextUid, QString host, int port, int dbIndex);
+    void contextRestored(QString contextUid, QString host, int port, int dbIndex);
 
     void incomingChannelMessage(QString channel, QtRedisReply data);
     void incomingChannelShardMessage(QString shardChannel, QtRedisReply data);
     void incomingChannelPatternMessage(QString pattern, QString channel, QtRedisReply data);
+
+    void channelMessagesQueued();
 };
 
 #endif // QTREDISTRANSPORTER_H
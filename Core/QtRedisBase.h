@@ -7,10 +7,14 @@
 #include <QByteArray>
 #include <QVariant>
 #include <QList>
+#include <QMap>
+#include <QHash>
 #include <QStringList>
 #include <QMutex>
+#include <QThread>
 
 #include "QtRedisCommand.h"
+#include "QtRedisScript.h"
 
 //!
 //! \file QtRedisBase.h
@@ -26,11 +30,19 @@ public:
     QtRedisBase() {}
     virtual ~QtRedisBase() {}
 
+    //!
+    //! \brief Условие выбора перегрузок с бинарными аргументами (T == U)
+    //!
+    //! Note: The QByteArray overloads are templates, so that calls with string literals still select the QString methods.
+    //!
+    template<typename T, typename U>
+    using EnableIfSame = typename std::enable_if<std::is_same<T, U>::value>::type;
+
     // ------------------------------------------------------------------------
     // -- ERRORS FUNCTIONS ----------------------------------------------------
     // ------------------------------------------------------------------------
     bool hasLastError() const;
-    const QString &lastError() const;
+    QString lastError() const;
 
     // ------------------------------------------------------------------------
     // -- BASE COMMANDS -------------------------------------------------------
@@ -46,6 +58,10 @@ public:
     // ------------------------------------------------------------------------
     __RESULT_IMPL redisKeys(const QString &arg = QString("*"));
     __RESULT_IMPL redisRandomKey();
+    __RESULT_IMPL redisScan(const qulonglong cursor,
+                            const QString &pattern = QString(),
+                            const int count = 0,
+                            const QString &type = QString());
     __RESULT_IMPL redisExists(const QStringList &keyList);
     __RESULT_IMPL redisGet(const QString &key);
     __RESULT_IMPL redisGetRange(const QString &key, const int startPos, const int endPos);
@@ -81,6 +97,100 @@ public:
     __RESULT_IMPL redisMove(const QString &key, const int dbIndex);
     __RESULT_IMPL redisDump(const QString &key);
 
+    // ------------------------------------------------------------------------
+    // -- KEY-VALUE COMMANDS (QByteArray) -------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisExists(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisGet(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisGetRange(const T &key, const int startPos, const int endPos);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisGetSet(const T &key, const QByteArray &value);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisAppend(const T &key, const QByteArray &appendValue);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSet(const T &key,
+                           const QByteArray &value,
+                           const uint exSec = 0,
+                           const uint pxMSec = 0,
+                           const QString existFlag = QString());
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSetRange(const T &key, const QByteArray &value, const int offset);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisDel(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisStrlen(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisExpire(const T &key, const uint sec);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisExpireAt(const T &key, const uint utcSec);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisPExpire(const T &key, const uint msec);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisPExpireAt(const T &key, const qint64 utcMsec);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisPersist(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisTtl(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisPTtl(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisDecr(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisDecrBy(const T &key, const qint64 decr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisIncr(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisIncrBy(const T &key, const qint64 incr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisIncrByFloat(const T &key, const float incr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRename(const T &key, const QByteArray &newKey);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRenameNx(const T &key, const QByteArray &newKey);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisType(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QMap<QByteArray, QByteArray>>>
+    __RESULT_IMPL redisMSet(const T &keyValue);
+
+    template<typename T, typename = EnableIfSame<T, QMap<QByteArray, QByteArray>>>
+    __RESULT_IMPL redisMSetNx(const T &keyValue);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisMGet(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisMove(const T &key, const int dbIndex);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisDump(const T &key);
+
     // ------------------------------------------------------------------------
     // -- LIST COMMANDS -------------------------------------------------------
     // ------------------------------------------------------------------------
@@ -103,6 +213,54 @@ public:
     __RESULT_IMPL redisRPush(const QString &key, const QStringList &valueList);
     __RESULT_IMPL redisRPushX(const QString &key, const QString &value);
 
+    // ------------------------------------------------------------------------
+    // -- LIST COMMANDS (QByteArray) ------------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLIndex(const T &key, const int index);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLInsert(const T &key,
+                               const QByteArray &pilot,
+                               const QByteArray &value,
+                               const QString &insertFlag = QString("AFTER"));
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLLen(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLPop(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLPush(const T &key, const QList<QByteArray> &valueList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLPushX(const T &key, const QByteArray &value);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLRange(const T &key, const int start, const int stop);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLRem(const T &key, const QByteArray &value, const int count);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLSet(const T &key, const QByteArray &value, const int index);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisLTrim(const T &key, const int start, const int stop);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRPop(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRPopLPush(const T &sourceKey, const QByteArray &destKey);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRPush(const T &key, const QList<QByteArray> &valueList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisRPushX(const T &key, const QByteArray &value);
+
     // ------------------------------------------------------------------------
     // -- STORED COMMANDS -----------------------------------------------------
     // ------------------------------------------------------------------------
@@ -120,6 +278,61 @@ public:
     __RESULT_IMPL redisSRem(const QString &key, const QStringList &memberList);
     __RESULT_IMPL redisSUnion(const QStringList &keyList);
     __RESULT_IMPL redisSUnionStore(const QString &dest, const QStringList &keyList);
+    __RESULT_IMPL redisSScan(const QString &key,
+                             const qulonglong cursor,
+                             const QString &pattern = QString(),
+                             const int count = 0);
+
+    // ------------------------------------------------------------------------
+    // -- STORED COMMANDS (QByteArray) ----------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSAdd(const T &key, const QList<QByteArray> &memberList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSCard(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisSDiff(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSDiffStore(const T &dest, const QList<QByteArray> &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisSInter(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSInterStore(const T &dest, const QList<QByteArray> &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSIsMember(const T &key, const QByteArray &member);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSMembers(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSMove(const T &sourceKey, const QByteArray &destKey, const QByteArray &member);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSPop(const T &key, const uint count = 1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSRandMember(const T &key, const int count = 1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSRem(const T &key, const QList<QByteArray> &memberList);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisSUnion(const T &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSUnionStore(const T &dest, const QList<QByteArray> &keyList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisSScan(const T &key,
+                             const qulonglong cursor,
+                             const QByteArray &pattern = QByteArray(),
+                             const int count = 0);
 
     // ------------------------------------------------------------------------
     // -- SORTED STORED COMMANDS ----------------------------------------------
@@ -194,9 +407,388 @@ public:
                                    const QList<int> &weightList = QList<int>(),
                                    const QString &aggregateFlag = QString());
 
+    __RESULT_IMPL redisZScan(const QString &key,
+                             const qulonglong cursor,
+                             const QString &pattern = QString(),
+                             const int count = 0);
+
+    // ------------------------------------------------------------------------
+    // -- SORTED STORED COMMANDS (QByteArray) ---------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZAdd(const T &key,
+                            const QMultiMap<QString, QByteArray> &scoreMember,
+                            const QString &updFlag = QString(),
+                            const bool chFlag = false,
+                            const bool incrFlag = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZCard(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZCount(const T &key,
+                              const QVariant &min = QVariant(),
+                              const QVariant &max = QVariant());
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZIncrBy(const T &key, const QByteArray &member, const qint64 incr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZInterStore(const T &destKey,
+                                   const QList<QByteArray> &keyList,
+                                   const QList<int> &weightList = QList<int>(),
+                                   const QString &aggregateFlag = QString());
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZLexCount(const T &key, const QByteArray &min, const QByteArray &max);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRange(const T &key,
+                              const int start,
+                              const int stop,
+                              const bool withScores = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRangeByLex(const T &key,
+                                   const QByteArray &min,
+                                   const QByteArray &max,
+                                   const int offset = -1,
+                                   const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRangeByScore(const T &key,
+                                     const QString &min,
+                                     const QString &max,
+                                     const bool withScores = false,
+                                     const int offset = -1,
+                                     const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRank(const T &key, const QByteArray &member);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRem(const T &key, const QList<QByteArray> &members);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRemRangeByLex(const T &key, const QByteArray &min, const QByteArray &max);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRemRangeByRank(const T &key, const int start, const int stop);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRemRangeByScore(const T &key, const QString &min, const QString &max);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRevRange(const T &key,
+                                 const int start,
+                                 const int stop,
+                                 const bool withScores = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRevRangeByLex(const T &key,
+                                      const QByteArray &max,
+                                      const QByteArray &min,
+                                      const int offset = -1,
+                                      const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRevRangeByScore(const T &key,
+                                        const QString &max,
+                                        const QString &min,
+                                        const bool withScores = false,
+                                        const int offset = -1,
+                                        const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZRevRank(const T &key, const QByteArray &member);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZScore(const T &key, const QByteArray &member);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZUnionStore(const T &destKey,
+                                   const QList<QByteArray> &keyList,
+                                   const QList<int> &weightList = QList<int>(),
+                                   const QString &aggregateFlag = QString());
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisZScan(const T &key,
+                             const qulonglong cursor,
+                             const QByteArray &pattern = QByteArray(),
+                             const int count = 0);
+
+    // ------------------------------------------------------------------------
+    // -- HASH COMMANDS -------------------------------------------------------
+    // ------------------------------------------------------------------------
+    __RESULT_IMPL redisHDel(const QString &key, const QStringList &fieldList);
+    __RESULT_IMPL redisHExists(const QString &key, const QString &field);
+    __RESULT_IMPL redisHGet(const QString &key, const QString &field);
+    __RESULT_IMPL redisHGetAll(const QString &key);
+    __RESULT_IMPL redisHIncrBy(const QString &key, const QString &field, const qint64 incr);
+    __RESULT_IMPL redisHIncrByFloat(const QString &key, const QString &field, const double incr);
+    __RESULT_IMPL redisHKeys(const QString &key);
+    __RESULT_IMPL redisHLen(const QString &key);
+    __RESULT_IMPL redisHMGet(const QString &key, const QStringList &fieldList);
+    __RESULT_IMPL redisHSet(const QString &key, const QString &field, const QString &value);
+    __RESULT_IMPL redisHSet(const QString &key, const QMap<QString, QString> &fieldValue);
+    __RESULT_IMPL redisHSetNx(const QString &key, const QString &field, const QString &value);
+    __RESULT_IMPL redisHStrlen(const QString &key, const QString &field);
+    __RESULT_IMPL redisHVals(const QString &key);
+    __RESULT_IMPL redisHScan(const QString &key,
+                             const qulonglong cursor,
+                             const QString &pattern = QString(),
+                             const int count = 0);
+
+    // ------------------------------------------------------------------------
+    // -- HASH COMMANDS (QByteArray) ------------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHDel(const T &key, const QList<QByteArray> &fieldList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHExists(const T &key, const QByteArray &field);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHGet(const T &key, const QByteArray &field);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHGetAll(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHIncrBy(const T &key, const QByteArray &field, const qint64 incr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHIncrByFloat(const T &key, const QByteArray &field, const double incr);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHKeys(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHLen(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHMGet(const T &key, const QList<QByteArray> &fieldList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHSet(const T &key, const QByteArray &field, const QByteArray &value);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHSet(const T &key, const QMap<QByteArray, QByteArray> &fieldValue);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHSetNx(const T &key, const QByteArray &field, const QByteArray &value);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHStrlen(const T &key, const QByteArray &field);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHVals(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisHScan(const T &key,
+                             const qulonglong cursor,
+                             const QByteArray &pattern = QByteArray(),
+                             const int count = 0);
+
+    // ------------------------------------------------------------------------
+    // -- STREAM COMMANDS -----------------------------------------------------
+    // ------------------------------------------------------------------------
+    __RESULT_IMPL redisXAdd(const QString &key,
+                            const QMap<QString, QString> &fieldValue,
+                            const QString &id = QString("*"),
+                            const qlonglong maxLen = -1,
+                            const bool approximate = true);
+    __RESULT_IMPL redisXLen(const QString &key);
+    __RESULT_IMPL redisXRange(const QString &key,
+                              const QString &start = QString("-"),
+                              const QString &end = QString("+"),
+                              const int count = -1);
+    __RESULT_IMPL redisXRevRange(const QString &key,
+                                 const QString &end = QString("+"),
+                                 const QString &start = QString("-"),
+                                 const int count = -1);
+    __RESULT_IMPL redisXDel(const QString &key, const QStringList &idList);
+    __RESULT_IMPL redisXTrim(const QString &key, const qlonglong maxLen, const bool approximate = true);
+    __RESULT_IMPL redisXRead(const QStringList &keyList,
+                             const QStringList &idList,
+                             const int count = -1,
+                             const int blockMSec = -1);
+    __RESULT_IMPL redisXReadGroup(const QString &group,
+                                  const QString &consumer,
+                                  const QStringList &keyList,
+                                  const QStringList &idList,
+                                  const int count = -1,
+                                  const int blockMSec = -1,
+                                  const bool noAck = false);
+    __RESULT_IMPL redisXAck(const QString &key, const QString &group, const QStringList &idList);
+    __RESULT_IMPL redisXGroupCreate(const QString &key,
+                                    const QString &group,
+                                    const QString &id = QString("$"),
+                                    const bool mkStream = false);
+    __RESULT_IMPL redisXGroupDestroy(const QString &key, const QString &group);
+    __RESULT_IMPL redisXGroupCreateConsumer(const QString &key, const QString &group, const QString &consumer);
+    __RESULT_IMPL redisXGroupDelConsumer(const QString &key, const QString &group, const QString &consumer);
+    __RESULT_IMPL redisXGroupSetId(const QString &key, const QString &group, const QString &id);
+    __RESULT_IMPL redisXPending(const QString &key, const QString &group);
+    __RESULT_IMPL redisXPending(const QString &key,
+                                const QString &group,
+                                const QString &start,
+                                const QString &end,
+                                const int count,
+                                const QString &consumer = QString(),
+                                const qlonglong minIdleMSec = -1);
+    __RESULT_IMPL redisXClaim(const QString &key,
+                              const QString &group,
+                              const QString &consumer,
+                              const qlonglong minIdleMSec,
+                              const QStringList &idList,
+                              const bool justId = false);
+    __RESULT_IMPL redisXAutoClaim(const QString &key,
+                                  const QString &group,
+                                  const QString &consumer,
+                                  const qlonglong minIdleMSec,
+                                  const QString &start = QString("0-0"),
+                                  const int count = -1,
+                                  const bool justId = false);
+
+    // ------------------------------------------------------------------------
+    // -- STREAM COMMANDS (QByteArray) ----------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXAdd(const T &key,
+                            const QMap<QByteArray, QByteArray> &fieldValue,
+                            const QString &id = QString("*"),
+                            const qlonglong maxLen = -1,
+                            const bool approximate = true);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXLen(const T &key);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXRange(const T &key,
+                              const QString &start = QString("-"),
+                              const QString &end = QString("+"),
+                              const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXRevRange(const T &key,
+                                 const QString &end = QString("+"),
+                                 const QString &start = QString("-"),
+                                 const int count = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXDel(const T &key, const QStringList &idList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXTrim(const T &key, const qlonglong maxLen, const bool approximate = true);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisXRead(const T &keyList,
+                             const QStringList &idList,
+                             const int count = -1,
+                             const int blockMSec = -1);
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisXReadGroup(const QString &group,
+                                  const QString &consumer,
+                                  const T &keyList,
+                                  const QStringList &idList,
+                                  const int count = -1,
+                                  const int blockMSec = -1,
+                                  const bool noAck = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXAck(const T &key, const QString &group, const QStringList &idList);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXGroupCreate(const T &key,
+                                    const QString &group,
+                                    const QString &id = QString("$"),
+                                    const bool mkStream = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXGroupDestroy(const T &key, const QString &group);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXGroupCreateConsumer(const T &key, const QString &group, const QString &consumer);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXGroupDelConsumer(const T &key, const QString &group, const QString &consumer);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXGroupSetId(const T &key, const QString &group, const QString &id);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXPending(const T &key, const QString &group);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXPending(const T &key,
+                                const QString &group,
+                                const QString &start,
+                                const QString &end,
+                                const int count,
+                                const QString &consumer = QString(),
+                                const qlonglong minIdleMSec = -1);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXClaim(const T &key,
+                              const QString &group,
+                              const QString &consumer,
+                              const qlonglong minIdleMSec,
+                              const QStringList &idList,
+                              const bool justId = false);
+
+    template<typename T, typename = EnableIfSame<T, QByteArray>>
+    __RESULT_IMPL redisXAutoClaim(const T &key,
+                                  const QString &group,
+                                  const QString &consumer,
+                                  const qlonglong minIdleMSec,
+                                  const QString &start = QString("0-0"),
+                                  const int count = -1,
+                                  const bool justId = false);
+
+    // ------------------------------------------------------------------------
+    // -- SCRIPTING COMMANDS --------------------------------------------------
+    // ------------------------------------------------------------------------
+    __RESULT_IMPL redisEval(const QString &script,
+                            const QStringList &keyList = QStringList(),
+                            const QStringList &argList = QStringList());
+    __RESULT_IMPL redisEvalSha(const QString &sha1,
+                               const QStringList &keyList = QStringList(),
+                               const QStringList &argList = QStringList());
+    __RESULT_IMPL redisEvalScript(const QtRedisScript &script,
+                                  const QStringList &keyList = QStringList(),
+                                  const QStringList &argList = QStringList());
+    __RESULT_IMPL redisScriptLoad(const QString &script);
+    __RESULT_IMPL redisScriptExists(const QStringList &sha1List);
+    __RESULT_IMPL redisScriptFlush(const bool async = false);
+
+    // ------------------------------------------------------------------------
+    // -- SCRIPTING COMMANDS (QByteArray) -------------------------------------
+    // ------------------------------------------------------------------------
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisEval(const QString &script,
+                            const T &keyList,
+                            const QList<QByteArray> &argList = QList<QByteArray>());
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisEvalSha(const QString &sha1,
+                               const T &keyList,
+                               const QList<QByteArray> &argList = QList<QByteArray>());
+
+    template<typename T, typename = EnableIfSame<T, QList<QByteArray>>>
+    __RESULT_IMPL redisEvalScript(const QtRedisScript &script,
+                                  const T &keyList,
+                                  const QList<QByteArray> &argList = QList<QByteArray>());
+
 protected:
     void setLastError_safe(const QString &error);
     void clearLastError_safe();
+    void setLastErrorPerThread_safe(const bool enable);
+
+    static QList<QByteArray> toUtf8List(const QStringList &list);
+    static QMap<QByteArray, QByteArray> toUtf8Map(const QMap<QString, QString> &map);
+    static QMultiMap<QString, QByteArray> toUtf8MultiMap(const QMultiMap<QString, QString> &map);
 
     mutable QMutex  _mutex;  //!< мьютекс
 
@@ -227,8 +819,10 @@ private:
 
     __CLIENT_IMPL *as_CLIENT_IMPL_ptr();
 
-    mutable QMutex  _mutexErr;  //!< мьютекс для обработки ошибок
-    QString         _lastError; //!< сообщение об ошибке
+    mutable QMutex             _mutexErr;                     //!< мьютекс для обработки ошибок
+    QString                    _lastError;                    //!< сообщение об ошибке
+    bool                       _isLastErrorPerThread {false}; //!< хранить ли сообщение об ошибке отдельно для каждого потока
+    QHash<Qt::HANDLE, QString> _lastErrorPerThread;           //!< сообщения об ошибках потоков (см. setLastErrorPerThread_safe())
 };
 
 
@@ -240,10 +834,15 @@ private:
 //! \brief Задано ли сообщение об ошибке
 //! \return
 //!
+//! Note: In the per-thread mode checks the error of the calling thread (see setLastErrorPerThread_safe()).
+//!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 bool QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::hasLastError() const
 {
     QMutexLocker lock(&_mutexErr);
+    if (_isLastErrorPerThread)
+        return _lastErrorPerThread.contains(QThread::currentThreadId());
+
     return !_lastError.isEmpty();
 }
 
@@ -251,10 +850,16 @@ bool QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::hasLastError() const
 //! \brief Сообщение об ошибке
 //! \return
 //!
+//! Note: Return copy of value (the error may be changed by another thread).
+//! Note: In the per-thread mode returns the error of the calling thread (see setLastErrorPerThread_safe()).
+//!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
-const QString &QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::lastError() const
+QString QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::lastError() const
 {
     QMutexLocker lock(&_mutexErr);
+    if (_isLastErrorPerThread)
+        return _lastErrorPerThread.value(QThread::currentThreadId());
+
     return _lastError;
 }
 
@@ -284,6 +889,9 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExecCommand(const
 //! \param command Команда
 //! \return
 //!
+//! Note: The string is split into arguments with a space (see QtRedisCommand::fromString()),
+//! use QtRedisCommand to pass arguments containing spaces or binary data.
+//!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExecCommand(const QString &command)
 {
@@ -295,6 +903,9 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExecCommand(const
 //! \param command Команда
 //! \return
 //!
+//! Note: The string is split into arguments with a space (see QtRedisCommand::fromByteArray()),
+//! use QtRedisCommand to pass arguments containing spaces or binary data.
+//!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExecCommand(const QByteArray &command)
 {
@@ -388,10 +999,13 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExecCommand(const
 //! RESP2/RESP3 Reply
 //! Array reply: a list of keys matching pattern.
 //!
+//! Warn: KEYS blocks the server while the whole keyspace is scanned and returns it in one reply!
+//! Use redisScan() or QtRedisScanIterator on production servers.
+//!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisKeys(const QString &arg)
 {
-    return this->redisExecCommand(QString("KEYS %1").arg(arg));
+    return this->redisExecCommand(QtRedisCommand("KEYS") << arg);
 }
 
 //!
@@ -428,7 +1042,74 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisKeys(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRandomKey()
 {
-    return this->redisExecCommand(QString("RANDOMKEY"));
+    return this->redisExecCommand(QtRedisCommand("RANDOMKEY"));
+}
+
+//!
+//! \brief Выполнить итерацию по ключам текущей БД
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон ключей (пустой - все ключи)
+//! \param count Рекомендуемое количество ключей за итерацию (0 - по умолчанию)
+//! \param type Тип значений ключей (пустой - все типы)
+//! \return
+//!
+//! Redis command: SCAN
+//!
+//! Syntax
+//!
+//! SCAN cursor [MATCH pattern] [COUNT count] [TYPE type]
+//!
+//! Available since:
+//!     2.8.0
+//! Time complexity:
+//!     O(1) for every call. O(N) for a complete iteration, including enough command calls for the cursor to return back to 0.
+//!     N is the number of elements inside the collection.
+//! ACL categories:
+//!     @keyspace, @read, @slow
+//!
+//! The SCAN command and the closely related commands SSCAN, HSCAN and ZSCAN are used in order to incrementally iterate over a collection of elements.
+//!
+//! SCAN is a cursor based iterator. This means that at every call of the command, the server returns an updated cursor
+//! that the user needs to use as the cursor argument in the next call.
+//! An iteration starts when the cursor is set to 0, and terminates when the cursor returned by the server is 0.
+//!
+//! The COUNT option is only a hint for the implementation, the server may return fewer or more elements per call
+//! (an empty batch with a non-zero cursor does not mean the end of the iteration).
+//! The MATCH filter is applied after the elements are retrieved from the collection.
+//! The TYPE option asks SCAN to only return objects that match a given type (string, list, set, zset, hash, stream).
+//!
+//! A given element may be returned multiple times. It is up to the application to handle the case of duplicated elements.
+//!
+//! Examples
+//! redis> SCAN 0 MATCH *11* COUNT 1000
+//! 1) "288"
+//! 2) 1) "key:911"
+//! redis> SCAN 288 MATCH *11* COUNT 1000
+//! 1) "0"
+//! 2) 1) "key:611"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a two-element array.
+//!     The first element is a Bulk string reply that represents an unsigned 64-bit number, the cursor.
+//!     The second element is an Array reply with the names of scanned keys.
+//!
+//! History
+//!     Starting with Redis version 6.0.0: Added the TYPE subcommand.
+//!
+//! Note: See QtRedisScanIterator for the iteration with batches and prefetch.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisScan(const qulonglong cursor, const QString &pattern, const int count, const QString &type)
+{
+    QtRedisCommand command("SCAN");
+    command << cursor;
+    if (!pattern.isEmpty())
+        command << "MATCH" << pattern;
+    if (count > 0)
+        command << "COUNT" << count;
+    if (!type.isEmpty())
+        command << "TYPE" << type;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -474,15 +1155,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRandomKey()
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExists(const QStringList &keyList)
+{
+    return this->redisExists(toUtf8List(keyList));
+}
+
+//!
+//! \brief Проверка наличия ключей в БД
+//! \param keyList Список ключей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExists(const T &keyList)
 {
     if (keyList.isEmpty())
         return make_error("Invalid key list (Empty)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("EXISTS %1").arg(keyList.join(" ")).trimmed());
+    return this->redisExecCommand(QtRedisCommand("EXISTS") << keyList);
 }
 
 //!
@@ -528,10 +1219,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExists(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGet(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisGet(key.toUtf8());
+}
+
+//!
+//! \brief Получить значение по ключу
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGet(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("GET %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("GET") << key);
 }
 
 //!
@@ -579,10 +1284,26 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGet(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetRange(const QString &key, const int startPos, const int endPos)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisGetRange(key.toUtf8(), startPos, endPos);
+}
+
+//!
+//! \brief Получить подстроку значения в указанных диапазонах
+//! \param key Ключ
+//! \param startPos Начало
+//! \param endPos Конец
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetRange(const T &key, const int startPos, const int endPos)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("GETRANGE %1 %2 %3").arg(key).arg(startPos).arg(endPos));
+    return this->redisExecCommand(QtRedisCommand("GETRANGE") << key << startPos << endPos);
 }
 
 //!
@@ -646,12 +1367,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetRange(const QSt
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetSet(const QString &key, const QString &value)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisGetSet(key.toUtf8(), value.toUtf8());
+}
+
+//!
+//! \brief Получить значение ключа и задать новое
+//! \param key Ключ
+//! \param value Новое значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetSet(const T &key, const QByteArray &value)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "GETSET" << key << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("GETSET");
+    command << key << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -723,12 +1459,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisGetSet(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisAppend(const QString &key, const QString &appendValue)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisAppend(key.toUtf8(), appendValue.toUtf8());
+}
+
+//!
+//! \brief Добавить/задать значение ключу
+//! \param key Ключ
+//! \param appendValue Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisAppend(const T &key, const QByteArray &appendValue)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "APPEND" << key << appendValue;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("APPEND");
+    command << key << appendValue;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -835,24 +1586,42 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisAppend(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSet(const QString &key, const QString &value, const uint exSec, const uint pxMSec, const QString existFlag)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
-        return make_error("Invalid key!");
-
-    if (!existFlag.isEmpty()
-        && existFlag.toUpper() != QString("NX")
-        && existFlag.toUpper() != QString("XX"))
-        return make_error("Invalid existFlag!");
+    return this->redisSet(key.toUtf8(), value.toUtf8(), exSec, pxMSec, existFlag);
+}
 
-    QStringList argv;
-    argv << "SET" << key << value;
+//!
+//! \brief Задать значение ключу
+//! \param key Ключ
+//! \param value Значение
+//! \param exSec Время "жизни" объекта в сек.
+//! \param pxMSec Время "жизни" объекта в мсек.
+//! \param existFlag Флаг проверки существования объекта (NX|XX)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSet(const T &key, const QByteArray &value, const uint exSec, const uint pxMSec, const QString existFlag)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (!existFlag.isEmpty()
+        && existFlag.toUpper() != QString("NX")
+        && existFlag.toUpper() != QString("XX"))
+        return make_error("Invalid existFlag!");
+
+    QtRedisCommand command("SET");
+    command << key << value;
     if (exSec > 0)
-        argv << "EX" << QString::number(exSec);
+        command << "EX" << exSec;
     if (pxMSec > 0)
-        argv << "PX" << QString::number(pxMSec);
+        command << "PX" << pxMSec;
     if (!existFlag.isEmpty())
-        argv << existFlag.toUpper();
+        command << existFlag.toUpper();
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -914,12 +1683,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSet(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSetRange(const QString &key, const QString &value, const int offset)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSetRange(key.toUtf8(), value.toUtf8(), offset);
+}
+
+//!
+//! \brief Перезаписать часть строки значения на новое, начиная с позиции
+//! \param key Ключ
+//! \param value Новое значение
+//! \param offset Позиция
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSetRange(const T &key, const QByteArray &value, const int offset)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "SETRANGE" << key << QString::number(offset) << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("SETRANGE");
+    command << key << offset << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -957,15 +1742,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSetRange(const QSt
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDel(const QStringList &keyList)
+{
+    return this->redisDel(toUtf8List(keyList));
+}
+
+//!
+//! \brief Удалить ключи и их значения из БД
+//! \param keyList Список ключей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDel(const T &keyList)
 {
     if (keyList.isEmpty())
         return make_error("Invalid key list (Empty)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("DEL %1").arg(keyList.join(" ")).trimmed());
+    return this->redisExecCommand(QtRedisCommand("DEL") << keyList);
 }
 
 //!
@@ -1002,10 +1797,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDel(const QStringL
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisStrlen(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisStrlen(key.toUtf8());
+}
+
+//!
+//! \brief Получить длину строки значения
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisStrlen(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("STRLEN %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("STRLEN") << key);
 }
 
 //!
@@ -1155,13 +1964,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisStrlen(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpire(const QString &key, const uint sec)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisExpire(key.toUtf8(), sec);
+}
+
+//!
+//! \brief Задать время "жизни" объекта в сек.
+//! \param key Ключ
+//! \param sec Время в сек.
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpire(const T &key, const uint sec)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (sec == 0)
         return make_error("Invalid sec!");
 
-    return this->redisExecCommand(QString("EXPIRE %1 %2").arg(key).arg(sec));
+    return this->redisExecCommand(QtRedisCommand("EXPIRE") << key << sec);
 }
 
 //!
@@ -1225,13 +2049,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpire(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpireAt(const QString &key, const uint utcSec)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisExpireAt(key.toUtf8(), utcSec);
+}
+
+//!
+//! \brief Задать время "жизни" объекта в формате utc (сек)
+//! \param key Ключ
+//! \param utcSec Время в формате utc (сек)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpireAt(const T &key, const uint utcSec)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (utcSec == 0)
         return make_error("Invalid utcSec!");
 
-    return this->redisExecCommand(QString("EXPIREAT %1 %2").arg(key).arg(utcSec));
+    return this->redisExecCommand(QtRedisCommand("EXPIREAT") << key << utcSec);
 }
 
 //!
@@ -1296,10 +2135,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisExpireAt(const QSt
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpire(const QString &key, const uint msec)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisPExpire(key.toUtf8(), msec);
+}
+
+//!
+//! \brief Задать время "жизни" объекта в мсек.
+//! \param key Ключ
+//! \param msec Время в мсек
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpire(const T &key, const uint msec)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("PEXPIRE %1 %2").arg(key).arg(msec));
+    return this->redisExecCommand(QtRedisCommand("PEXPIRE") << key << msec);
 }
 
 //!
@@ -1356,10 +2210,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpire(const QStr
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpireAt(const QString &key, const qint64 utcMsec)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisPExpireAt(key.toUtf8(), utcMsec);
+}
+
+//!
+//! \brief Задать время "жизни" объекта в формате utc (мсек)
+//! \param key Ключ
+//! \param utcMsec Время в формате utc (мсек)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpireAt(const T &key, const qint64 utcMsec)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("PEXPIREAT %1 %2").arg(key).arg(utcMsec));
+    return this->redisExecCommand(QtRedisCommand("PEXPIREAT") << key << utcMsec);
 }
 
 //!
@@ -1403,10 +2272,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPExpireAt(const QS
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPersist(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisPersist(key.toUtf8());
+}
+
+//!
+//! \brief Удалить заданное время "жизни" объекта
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPersist(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("PERSIST %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("PERSIST") << key);
 }
 
 //!
@@ -1460,10 +2343,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPersist(const QStr
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisTtl(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisTtl(key.toUtf8());
+}
+
+//!
+//! \brief Получить время "жизни" объекта в сек.
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisTtl(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("TTL %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("TTL") << key);
 }
 
 //!
@@ -1515,10 +2412,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisTtl(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPTtl(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisPTtl(key.toUtf8());
+}
+
+//!
+//! \brief Получить время "жизни" объекта в мсек.
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPTtl(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("PTTL %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("PTTL") << key);
 }
 
 //!
@@ -1561,10 +2472,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisPTtl(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecr(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisDecr(key.toUtf8());
+}
+
+//!
+//! \brief Уменьшить число, сохраненное в ключе на один
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecr(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("DECR %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("DECR") << key);
 }
 
 //!
@@ -1605,10 +2530,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecr(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecrBy(const QString &key, const qint64 decr)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisDecrBy(key.toUtf8(), decr);
+}
+
+//!
+//! \brief Уменьшить число, сохраненное в ключе на значение
+//! \param key Ключ
+//! \param decr Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecrBy(const T &key, const qint64 decr)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("DECRBY %1 %2").arg(key).arg(decr));
+    return this->redisExecCommand(QtRedisCommand("DECRBY") << key << decr);
 }
 
 //!
@@ -1753,10 +2693,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDecrBy(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncr(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisIncr(key.toUtf8());
+}
+
+//!
+//! \brief Увеличить число, сохраненное в ключе на один
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncr(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("INCR %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("INCR") << key);
 }
 
 //!
@@ -1796,10 +2750,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncr(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrBy(const QString &key, const qint64 incr)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisIncrBy(key.toUtf8(), incr);
+}
+
+//!
+//! \brief Увеличить число, сохраненное в ключе на значение
+//! \param key Ключ
+//! \param incr Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrBy(const T &key, const qint64 incr)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("INCRBY %1 %2").arg(key).arg(incr));
+    return this->redisExecCommand(QtRedisCommand("INCRBY") << key << incr);
 }
 
 //!
@@ -1859,10 +2828,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrBy(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrByFloat(const QString &key, const float incr)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisIncrByFloat(key.toUtf8(), incr);
+}
+
+//!
+//! \brief Увеличить число, сохраненное в ключе на значение
+//! \param key Ключ
+//! \param incr Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrByFloat(const T &key, const float incr)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("INCRBYFLOAT %1 %2").arg(key).arg(incr));
+    return this->redisExecCommand(QtRedisCommand("INCRBYFLOAT") << key << incr);
 }
 
 //!
@@ -1906,13 +2890,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisIncrByFloat(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRename(const QString &key, const QString &newKey)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisRename(key.toUtf8(), newKey.toUtf8());
+}
+
+//!
+//! \brief Переименовать ключ
+//! \param key Ключ
+//! \param newKey Новое имя ключа
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRename(const T &key, const QByteArray &newKey)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (newKey.isEmpty() || newKey.indexOf(" ") != -1)
+    if (newKey.isEmpty())
         return make_error("Invalid newKey!");
 
-    return this->redisExecCommand(QString("RENAME %1 %2").arg(key, newKey));
+    return this->redisExecCommand(QtRedisCommand("RENAME") << key << newKey);
 }
 
 //!
@@ -1960,13 +2959,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRename(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRenameNx(const QString &key, const QString &newKey)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisRenameNx(key.toUtf8(), newKey.toUtf8());
+}
+
+//!
+//! \brief Переименовать ключ, если новое имя не существует
+//! \param key Ключ
+//! \param newKey Новое имя ключа
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRenameNx(const T &key, const QByteArray &newKey)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (newKey.isEmpty() || newKey.indexOf(" ") != -1)
+    if (newKey.isEmpty())
         return make_error("Invalid newKey!");
 
-    return this->redisExecCommand(QString("RENAMENX %1 %2").arg(key, newKey));
+    return this->redisExecCommand(QtRedisCommand("RENAMENX") << key << newKey);
 }
 
 //!
@@ -2009,10 +3023,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRenameNx(const QSt
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisType(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisType(key.toUtf8());
+}
+
+//!
+//! \brief Получить тип значения ключа
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisType(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("TYPE %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("TYPE") << key);
 }
 
 //!
@@ -2050,23 +3078,37 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisType(const QString
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSet(const QMap<QString, QString> &keyValue)
+{
+    return this->redisMSet(toUtf8Map(keyValue));
+}
+
+//!
+//! \brief Установить ключи в соответствии со значениями
+//! \param keyValue Список ключ-значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSet(const T &keyValue)
 {
     if (keyValue.isEmpty())
         return make_error("Invalid key-value (Empty)!");
 
-    const QList<QString> keyList = keyValue.keys();
-    for (const QString &key : keyList) {
-        if (key.isEmpty() || key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
+    const QList<QByteArray> keyList = keyValue.keys();
+    for (const QByteArray &key : keyList) {
+        if (key.isEmpty())
+            return make_error(QString("Invalid key (%1)!").arg(QString::fromUtf8(key)));
     }
-    QStringList argv;
-    argv << "MSET";
-    QMapIterator<QString, QString> i (keyValue);
+    QtRedisCommand command("MSET");
+    command.reserve(keyValue.size() * 2);
+    QMapIterator<QByteArray, QByteArray> i (keyValue);
     while (i.hasNext()) {
         i.next();
-        argv << i.key() << i.value();
+        command << i.key() << i.value();
     }
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2111,23 +3153,37 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSet(const QMap<QS
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSetNx(const QMap<QString, QString> &keyValue)
+{
+    return this->redisMSetNx(toUtf8Map(keyValue));
+}
+
+//!
+//! \brief Установить ключи в соответствии со значениями, если ключи не существуют
+//! \param keyValue Список ключ-значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSetNx(const T &keyValue)
 {
     if (keyValue.isEmpty())
         return make_error("Invalid key-value (Empty)!");
 
-    const QList<QString> keyList = keyValue.keys();
-    for (const QString &key : keyList) {
-        if (key.isEmpty() || key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
+    const QList<QByteArray> keyList = keyValue.keys();
+    for (const QByteArray &key : keyList) {
+        if (key.isEmpty())
+            return make_error(QString("Invalid key (%1)!").arg(QString::fromUtf8(key)));
     }
-    QStringList argv;
-    argv << "MSETNX";
-    QMapIterator<QString, QString> i (keyValue);
+    QtRedisCommand command("MSETNX");
+    command.reserve(keyValue.size() * 2);
+    QMapIterator<QByteArray, QByteArray> i (keyValue);
     while (i.hasNext()) {
         i.next();
-        argv << i.key() << i.value();
+        command << i.key() << i.value();
     }
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2166,15 +3222,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMSetNx(const QMap<
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMGet(const QStringList &keyList)
+{
+    return this->redisMGet(toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить значения ключей
+//! \param keyList Список ключей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMGet(const T &keyList)
 {
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("MGET %1").arg(keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("MGET") << keyList);
 }
 
 //!
@@ -2209,13 +3275,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMGet(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMove(const QString &key, const int dbIndex)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisMove(key.toUtf8(), dbIndex);
+}
+
+//!
+//! \brief Переместить ключ с его значениями в другую БД
+//! \param key Ключ
+//! \param dbIndex Индекс БД
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMove(const T &key, const int dbIndex)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (dbIndex < 0)
         return make_error("Invalid db index!");
 
-    return this->redisExecCommand(QString("MOVE %1 %2").arg(key).arg(dbIndex));
+    return this->redisExecCommand(QtRedisCommand("MOVE") << key << dbIndex);
 }
 
 //!
@@ -2271,13 +3352,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisMove(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDump(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
-        return make_error("Invalid key!");
-
-    return this->redisExecCommand(QString("DUMP %1").arg(key));
+    return this->redisDump(key.toUtf8());
 }
 
-
+//!
+//! \brief Преобразовать значение ключа в формат Redis-а
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDump(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("DUMP") << key);
+}
+
+
 // ------------------------------------------------------------------------
 // -- LIST COMMANDS -------------------------------------------------------
 // ------------------------------------------------------------------------
@@ -2334,10 +3429,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisDump(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLIndex(const QString &key, const int index)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLIndex(key.toUtf8(), index);
+}
+
+//!
+//! \brief Получить элменет списка по индексу
+//! \param key Ключ
+//! \param index Индекс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLIndex(const T &key, const int index)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("LINDEX %1 %2").arg(key).arg(index));
+    return this->redisExecCommand(QtRedisCommand("LINDEX") << key << index);
 }
 
 //!
@@ -2391,16 +3501,33 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLIndex(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLInsert(const QString &key, const QString &pilot, const QString &value, const QString &insertFlag)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLInsert(key.toUtf8(), pilot.toUtf8(), value.toUtf8(), insertFlag);
+}
+
+//!
+//! \brief Вставить значение (value) в список до или после значения (pilot)
+//! \param key Ключ
+//! \param pilot Значение поиска
+//! \param value Новое значение
+//! \param insertFlag Тип вставки (BEFORE|AFTER)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLInsert(const T &key, const QByteArray &pilot, const QByteArray &value, const QString &insertFlag)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (insertFlag.toUpper() != QString("BEFORE")
         && insertFlag.toUpper() != QString("AFTER"))
         return make_error("Invalid insertFlag!");
 
-    QStringList argv;
-    argv << "LINSERT" << key << insertFlag.toUpper() << pilot << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("LINSERT");
+    command << key << insertFlag.toUpper() << pilot << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2438,10 +3565,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLInsert(const QStr
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLLen(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLLen(key.toUtf8());
+}
+
+//!
+//! \brief Получить размер списка
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLLen(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("LLEN %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("LLEN") << key);
 }
 
 //!
@@ -2499,10 +3640,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLLen(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPop(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLPop(key.toUtf8());
+}
+
+//!
+//! \brief Удалить и вернуть первый элменет списка
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPop(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("LPOP %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("LPOP") << key);
 }
 
 //!
@@ -2550,18 +3705,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPop(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPush(const QString &key, const QStringList &valueList)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLPush(key.toUtf8(), toUtf8List(valueList));
+}
+
+//!
+//! \brief Вставить значения в начало списка
+//! \param key Ключ
+//! \param valueList Значения
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPush(const T &key, const QList<QByteArray> &valueList)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (valueList.isEmpty())
         return make_error("Invalid valueList (Empty)!");
 
-    QStringList argv;
-    argv << "LPUSH" << key;
-    for (const QString &str : valueList)
-        argv << str;
+    QtRedisCommand command("LPUSH");
+    command << key << valueList;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2608,12 +3776,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPush(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPushX(const QString &key, const QString &value)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLPushX(key.toUtf8(), value.toUtf8());
+}
+
+//!
+//! \brief Вставить значение в начало списка, если ключ существует и он содержит список
+//! \param key Ключ
+//! \param value Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPushX(const T &key, const QByteArray &value)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "LPUSHX" << key << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("LPUSHX");
+    command << key << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2678,10 +3861,26 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLPushX(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRange(const QString &key, const int start, const int stop)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLRange(key.toUtf8(), start, stop);
+}
+
+//!
+//! \brief Получить список значений ключа
+//! \param key Ключ
+//! \param start Начальный индекс
+//! \param stop Конечный индекс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRange(const T &key, const int start, const int stop)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("LRANGE %1 %2 %3").arg(key).arg(start).arg(stop));
+    return this->redisExecCommand(QtRedisCommand("LRANGE") << key << start << stop);
 }
 
 //!
@@ -2735,12 +3934,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRange(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRem(const QString &key, const QString &value, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLRem(key.toUtf8(), value.toUtf8(), count);
+}
+
+//!
+//! \brief Удалить первое найденное значение из списка начиная с заданного индекса
+//! \param key Ключ
+//! \param value Значение
+//! \param count Индекс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRem(const T &key, const QByteArray &value, const int count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "LREM" << key << QString::number(count) << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("LREM");
+    command << key << count << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2789,12 +4004,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLRem(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLSet(const QString &key, const QString &value, const int index)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLSet(key.toUtf8(), value.toUtf8(), index);
+}
+
+//!
+//! \brief Установить новое знаяение в списке по индексу
+//! \param key Ключ
+//! \param value Новое значение
+//! \param index Индекс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLSet(const T &key, const QByteArray &value, const int index)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "LSET" << key << QString::number(index) << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("LSET");
+    command << key << index << value;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -2855,10 +4086,26 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLSet(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLTrim(const QString &key, const int start, const int stop)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisLTrim(key.toUtf8(), start, stop);
+}
+
+//!
+//! \brief Обрезать список, чтобы он содержал тоько указанный диапазон элементов
+//! \param key Ключ
+//! \param start Начало диапазона
+//! \param stop Конец диапазона
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLTrim(const T &key, const int start, const int stop)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("LTRIM %1 %2 %3").arg(key).arg(start).arg(stop));
+    return this->redisExecCommand(QtRedisCommand("LTRIM") << key << start << stop);
 }
 
 //!
@@ -2916,10 +4163,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisLTrim(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPop(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisRPop(key.toUtf8());
+}
+
+//!
+//! \brief Удалить и получить последний элемент списка, хранящегося в ключе
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPop(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("RPOP %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("RPOP") << key);
 }
 
 //!
@@ -3011,13 +4272,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPop(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPopLPush(const QString &sourceKey, const QString &destKey)
 {
-    if (sourceKey.isEmpty() || sourceKey.indexOf(" ") != -1)
+    return this->redisRPopLPush(sourceKey.toUtf8(), destKey.toUtf8());
+}
+
+//!
+//! \brief Удалить и получить последний элемент списка (sourceKey), и поместить его в начало списка (destKey)
+//! \param sourceKey Ключ-ичтоник
+//! \param destKey Ключ-получатель
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPopLPush(const T &sourceKey, const QByteArray &destKey)
+{
+    if (sourceKey.isEmpty())
         return make_error("Invalid sourceKey!");
 
-    if (destKey.isEmpty() || destKey.indexOf(" ") != -1)
+    if (destKey.isEmpty())
         return make_error("Invalid destKey!");
 
-    return this->redisExecCommand(QString("RPOPLPUSH %1 %2").arg(sourceKey, destKey));
+    return this->redisExecCommand(QtRedisCommand("RPOPLPUSH") << sourceKey << destKey);
 }
 
 //!
@@ -3064,18 +4340,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPopLPush(const QS
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPush(const QString &key, const QStringList &valueList)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisRPush(key.toUtf8(), toUtf8List(valueList));
+}
+
+//!
+//! \brief Вставить значения в конец списка
+//! \param key Ключ
+//! \param valueList Значения
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPush(const T &key, const QList<QByteArray> &valueList)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (valueList.isEmpty())
         return make_error("Invalid valueList (Empty)!");
 
-    QStringList argv;
-    argv << "RPUSH" << key;
-    for (const QString &str : valueList)
-        argv << str;
+    QtRedisCommand command("RPUSH");
+    command << key << valueList;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3122,12 +4411,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPush(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPushX(const QString &key, const QString &value)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisRPushX(key.toUtf8(), value.toUtf8());
+}
+
+//!
+//! \brief Вставить значение в конец списка, если ключ существует и содержит список
+//! \param key Ключ
+//! \param value Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPushX(const T &key, const QByteArray &value)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "RPUSHX" << key << value;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("RPUSHX");
+    command << key << value;
+    return this->redisExecCommand(command);
 }
 
 
@@ -3179,18 +4483,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisRPushX(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSAdd(const QString &key, const QStringList &memberList)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSAdd(key.toUtf8(), toUtf8List(memberList));
+}
+
+//!
+//! \brief Добавить значения в набор
+//! \param key Ключ
+//! \param memberList Значения
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSAdd(const T &key, const QList<QByteArray> &memberList)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (memberList.isEmpty())
         return make_error("Invalid memberList (Empty)!");
 
-    QStringList argv;
-    argv << "SADD" << key;
-    for (const QString &str : memberList)
-        argv << str;
+    QtRedisCommand command("SADD");
+    command << key << memberList;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3230,10 +4547,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSAdd(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSCard(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSCard(key.toUtf8());
+}
+
+//!
+//! \brief Получить количество элементов в наборе
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSCard(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("SCARD %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("SCARD") << key);
 }
 
 //!
@@ -3290,15 +4621,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSCard(const QStrin
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiff(const QStringList &keyList)
+{
+    return this->redisSDiff(toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученный путем разницы между первым набором(keyList[0]) и остальными(keyList[1..N])
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiff(const T &keyList)
 {
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SDIFF %1").arg(keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SDIFF") << keyList);
 }
 
 //!
@@ -3349,17 +4690,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiff(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiffStore(const QString &dest, const QStringList &keyList)
 {
-    if (dest.isEmpty() || dest.indexOf(" ") != -1)
+    return this->redisSDiffStore(dest.toUtf8(), toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученный путем разницы между первым набором(keyList[0]) и остальными(keyList[1..N]), и записать результат в новый набор
+//! \param dest Название нового набора
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiffStore(const T &dest, const QList<QByteArray> &keyList)
+{
+    if (dest.isEmpty())
         return make_error("Invalid dest!");
 
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SDIFFSTORE %1 %2").arg(dest, keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SDIFFSTORE") << dest << keyList);
 }
 
 //!
@@ -3416,15 +4768,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSDiffStore(const Q
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInter(const QStringList &keyList)
+{
+    return this->redisSInter(toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученных путем пересечения наборов
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInter(const T &keyList)
 {
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SINTER %1").arg(keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SINTER") << keyList);
 }
 
 //!
@@ -3477,17 +4839,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInter(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInterStore(const QString &dest, const QStringList &keyList)
 {
-    if (dest.isEmpty() || dest.indexOf(" ") != -1)
+    return this->redisSInterStore(dest.toUtf8(), toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученных путем пересечения наборов, и записать результат в новый набор
+//! \param dest Название нового набора
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInterStore(const T &dest, const QList<QByteArray> &keyList)
+{
+    if (dest.isEmpty())
         return make_error("Invalid dest!");
 
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SINTERSTORE %1 %2").arg(dest, keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SINTERSTORE") << dest << keyList);
 }
 
 //!
@@ -3528,12 +4901,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSInterStore(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSIsMember(const QString &key, const QString &member)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSIsMember(key.toUtf8(), member.toUtf8());
+}
+
+//!
+//! \brief Входит ли элемент в набор
+//! \param key Ключ набора
+//! \param member Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSIsMember(const T &key, const QByteArray &member)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "SISMEMBER" << key << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("SISMEMBER");
+    command << key << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3576,17 +4964,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSIsMember(const QS
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMembers(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
-        return make_error("Invalid key!");
-
-    return this->redisExecCommand(QString("SMEMBERS %1").arg(key));
+    return this->redisSMembers(key.toUtf8());
 }
 
 //!
-//! \brief Переместить элемент из одного набора(sourceKey) в другой(destKey)
-//! \param sourceKey Ключ набора источника
-//! \param destKey Ключ набора получателя
-//! \param member Значение
+//! \brief Получить список всех элементов набора
+//! \param key Ключ набора
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMembers(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("SMEMBERS") << key);
+}
+
+//!
+//! \brief Переместить элемент из одного набора(sourceKey) в другой(destKey)
+//! \param sourceKey Ключ набора источника
+//! \param destKey Ключ набора получателя
+//! \param member Значение
 //! \return
 //!
 //! Redis command: SMOVE
@@ -3635,15 +5037,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMembers(const QSt
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMove(const QString &sourceKey, const QString &destKey, const QString &member)
 {
-    if (sourceKey.isEmpty() || sourceKey.indexOf(" ") != -1)
+    return this->redisSMove(sourceKey.toUtf8(), destKey.toUtf8(), member.toUtf8());
+}
+
+//!
+//! \brief Переместить элемент из одного набора(sourceKey) в другой(destKey)
+//! \param sourceKey Ключ набора источника
+//! \param destKey Ключ набора получателя
+//! \param member Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMove(const T &sourceKey, const QByteArray &destKey, const QByteArray &member)
+{
+    if (sourceKey.isEmpty())
         return make_error("Invalid sourceKey!");
 
-    if (destKey.isEmpty() || destKey.indexOf(" ") != -1)
+    if (destKey.isEmpty())
         return make_error("Invalid destKey!");
 
-    QStringList argv;
-    argv << "SMOVE" << sourceKey << destKey << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("SMOVE");
+    command << sourceKey << destKey << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3720,15 +5138,30 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSMove(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSPop(const QString &key, const uint count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSPop(key.toUtf8(), count);
+}
+
+//!
+//! \brief Удалить и вернуть один или несколько случайных элментов в наборе
+//! \param key Ключ набора
+//! \param count Количество элементов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSPop(const T &key, const uint count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "SPOP" << key;
+    QtRedisCommand command("SPOP");
+    command << key;
     if (count > 1)
-        argv << QString::number(count);
+        command << count;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3818,13 +5251,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSPop(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRandMember(const QString &key, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSRandMember(key.toUtf8(), count);
+}
+
+//!
+//! \brief Получить один или несколько случайных элементов из набора
+//! \param key Ключ набора
+//! \param count Количество элементов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRandMember(const T &key, const int count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (count == 0 || count == 1)
-        return this->redisExecCommand(QString("SRANDMEMBER %1").arg(key));
+        return this->redisExecCommand(QtRedisCommand("SRANDMEMBER") << key);
 
-    return this->redisExecCommand(QString("SRANDMEMBER %1 %2").arg(key).arg(count));
+    return this->redisExecCommand(QtRedisCommand("SRANDMEMBER") << key << count);
 }
 
 //!
@@ -3878,18 +5326,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRandMember(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRem(const QString &key, const QStringList &memberList)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisSRem(key.toUtf8(), toUtf8List(memberList));
+}
+
+//!
+//! \brief Удалить элемент(ы) из набора
+//! \param key Ключ набора
+//! \param memberList Список элементов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRem(const T &key, const QList<QByteArray> &memberList)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (memberList.isEmpty())
         return make_error("Invalid memberList (Empty)!");
 
-    QStringList argv;
-    argv << "SREM" << key;
-    for (const QString &str : memberList)
-        argv << str;
+    QtRedisCommand command("SREM");
+    command << key << memberList;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -3949,15 +5410,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSRem(const QString
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnion(const QStringList &keyList)
+{
+    return this->redisSUnion(toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученных путем объединения всех заданных наборов
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnion(const T &keyList)
 {
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SUNION %1").arg(keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SUNION") << keyList);
 }
 
 //!
@@ -4014,17 +5485,100 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnion(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnionStore(const QString &dest, const QStringList &keyList)
 {
-    if (dest.isEmpty() || dest.indexOf(" ") != -1)
+    return this->redisSUnionStore(dest.toUtf8(), toUtf8List(keyList));
+}
+
+//!
+//! \brief Получить список элементов, полученных путем объединения всех заданных наборов, и записать в новый набор (dest)
+//! \param dest Название ключа нового набора
+//! \param keyList Список ключей наборов
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnionStore(const T &dest, const QList<QByteArray> &keyList)
+{
+    if (dest.isEmpty())
         return make_error("Invalid dest!");
 
     if (keyList.isEmpty() || keyList.size() < 2)
         return make_error("Invalid keyList (Empty or size < 2)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    return this->redisExecCommand(QString("SUNIONSTORE %1 %2").arg(dest, keyList.join(" ")));
+    return this->redisExecCommand(QtRedisCommand("SUNIONSTORE") << dest << keyList);
+}
+
+//!
+//! \brief Выполнить итерацию по элементам набора
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон элементов (пустой - все элементы)
+//! \param count Рекомендуемое количество элементов за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Redis command: SSCAN
+//!
+//! Syntax
+//!
+//! SSCAN key cursor [MATCH pattern] [COUNT count]
+//!
+//! Available since:
+//!     2.8.0
+//! Time complexity:
+//!     O(1) for every call. O(N) for a complete iteration, including enough command calls for the cursor to return back to 0.
+//!     N is the number of elements inside the collection.
+//! ACL categories:
+//!     @read, @set, @slow
+//!
+//! See SCAN for SSCAN documentation.
+//!
+//! Examples
+//! redis> SADD myset a b c
+//! (integer) 3
+//! redis> SSCAN myset 0
+//! 1) "0"
+//! 2) 1) "a"
+//!    2) "c"
+//!    3) "b"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a two-element array.
+//!     The first element is a Bulk string reply that represents an unsigned 64-bit number, the cursor.
+//!     The second element is an Array reply with the members of the set.
+//!
+//! Note: See QtRedisScanIterator for the iteration with batches and prefetch.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSScan(const QString &key, const qulonglong cursor, const QString &pattern, const int count)
+{
+    return this->redisSScan(key.toUtf8(), cursor, pattern.toUtf8(), count);
+}
+
+//!
+//! \brief Выполнить итерацию по элементам набора
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон элементов (пустой - все элементы)
+//! \param count Рекомендуемое количество элементов за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSScan(const T &key, const qulonglong cursor, const QByteArray &pattern, const int count)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    QtRedisCommand command("SSCAN");
+    command << key << cursor;
+    if (!pattern.isEmpty())
+        command << "MATCH" << pattern;
+    if (count > 0)
+        command << "COUNT" << count;
+    return this->redisExecCommand(command);
 }
 
 
@@ -4151,7 +5705,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisSUnionStore(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZAdd(const QString &key, const QMultiMap<QString, QString> scoreMember, const QString &updFlag, const bool chFlag, const bool incrFlag)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZAdd(key.toUtf8(), toUtf8MultiMap(scoreMember), updFlag, chFlag, incrFlag);
+}
+
+//!
+//! \brief Добавить элементы со значениями в отсортированный набор
+//! \param key Ключ
+//! \param scoreMember Список элементов со значениями
+//! \param updFlag Флаг обновления (NX|XX)
+//! \param chFlag Флаг модификации
+//! \param incrFlag Флаг инкремента
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZAdd(const T &key, const QMultiMap<QString, QByteArray> &scoreMember, const QString &updFlag, const bool chFlag, const bool incrFlag)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (scoreMember.isEmpty())
@@ -4162,21 +5734,18 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZAdd(const QString
         && updFlag.toUpper() != QString("XX"))
         return make_error("Invalid updFlag!");
 
-    QStringList argv;
-    argv << "ZADD" << key;
+    QtRedisCommand command("ZADD");
+    command << key;
     if (!updFlag.isEmpty())
-        argv << updFlag.toUpper();
+        command << updFlag.toUpper();
     if (chFlag)
-        argv << "CH";
+        command << "CH";
     if (incrFlag)
-        argv << "INCR";
+        command << "INCR";
 
-    QMapIterator<QString, QString> i (scoreMember);
-    while (i.hasNext()) {
-        i.next();
-        argv << i.key() << i.value();
-    }
-    return this->redisExecCommand(argv);
+    for (auto i = scoreMember.constBegin(); i != scoreMember.constEnd(); ++i)
+        command << i.key() << i.value();
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4213,10 +5782,24 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZAdd(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCard(const QString &key)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZCard(key.toUtf8());
+}
+
+//!
+//! \brief Получить размер отсортированного набора
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCard(const T &key)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("ZCARD %1").arg(key));
+    return this->redisExecCommand(QtRedisCommand("ZCARD") << key);
 }
 
 //!
@@ -4264,7 +5847,23 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCard(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCount(const QString &key, const QVariant &min, const QVariant &max)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZCount(key.toUtf8(), min, max);
+}
+
+//!
+//! \brief Получить кличество элементов отсортированного набора, находящихся между min и max
+//! \param key Ключ
+//! \param min Мин.
+//! \param max Макс.
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCount(const T &key, const QVariant &min, const QVariant &max)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (min.type() != QVariant::Invalid
@@ -4291,7 +5890,7 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCount(const QStri
     if (max.type() != QVariant::Invalid)
         buffMax = max.toString();
 
-    return this->redisExecCommand(QString("ZCOUNT %1 %2 %3").arg(key, buffMin, buffMax));
+    return this->redisExecCommand(QtRedisCommand("ZCOUNT") << key << buffMin << buffMax);
 }
 
 //!
@@ -4345,12 +5944,28 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZCount(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZIncrBy(const QString &key, const QString &member, const qint64 incr)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZIncrBy(key.toUtf8(), member.toUtf8(), incr);
+}
+
+//!
+//! \brief Увеличить значение отсортированного набора на величину incr
+//! \param key Ключ
+//! \param member Значение набора
+//! \param incr Инкремент
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZIncrBy(const T &key, const QByteArray &member, const qint64 incr)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "ZINCRBY" << key << QString::number(incr) << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("ZINCRBY");
+    command << key << incr << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4411,21 +6026,32 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZIncrBy(const QStr
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZInterStore(const QString &destKey, const QStringList &keyList, const QList<int> &weightList, const QString &aggregateFlag)
 {
-    if (destKey.isEmpty() || destKey.indexOf(" ") != -1)
+    return this->redisZInterStore(destKey.toUtf8(), toUtf8List(keyList), weightList, aggregateFlag);
+}
+
+//!
+//! \brief Вычислить пересечения отсортированных наборов и результат записать в новый набор
+//! \param destKey Название ключа нового набора
+//! \param keyList Список ключей
+//! \param weightList Список значений
+//! \param aggregateFlag Флаг агрегации (SUM|MIN|MAX)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZInterStore(const T &destKey, const QList<QByteArray> &keyList, const QList<int> &weightList, const QString &aggregateFlag)
+{
+    if (destKey.isEmpty())
         return make_error("Invalid destKey!");
 
     if (keyList.isEmpty())
         return make_error("Invalid keyList (Empty)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    QString weightListStr;
     for (const int weight : weightList) {
         if (weight <= 0)
             return __RESULT_IMPL();
-        weightListStr += QString("%1 ").arg(weight);
     }
     if (!aggregateFlag.isEmpty()
         && aggregateFlag.toUpper() != QString("SUM")
@@ -4435,17 +6061,17 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZInterStore(const
         return __RESULT_IMPL();
     }
 
-    QString command = QString("ZINTERSTORE %1 %2 %3")
-                      .arg(destKey)
-                      .arg(keyList.size())
-                      .arg(keyList.join(" "));
-
-    if (!weightList.isEmpty())
-        command += QString(" WEIGHTS %1").arg(weightListStr);
+    QtRedisCommand command("ZINTERSTORE");
+    command << destKey << keyList.size() << keyList;
+    if (!weightList.isEmpty()) {
+        command << "WEIGHTS";
+        for (const int weight : weightList)
+            command << weight;
+    }
     if (!aggregateFlag.isEmpty())
-        command += QString(" AGGREGATE %1").arg(aggregateFlag.toUpper());
+        command << "AGGREGATE" << aggregateFlag.toUpper();
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4492,13 +6118,29 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZInterStore(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZLexCount(const QString &key, const QString &min, const QString &max)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZLexCount(key.toUtf8(), min.toUtf8(), max.toUtf8());
+}
+
+//!
+//! \brief Когда все элементы в отсортированном наборе вставляются с одинаковой оценкой, возвращает количество элементов в отсортированном наборе между min и max.
+//! \param key Ключ
+//! \param min Мин
+//! \param max Макс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZLexCount(const T &key, const QByteArray &min, const QByteArray &max)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -4509,7 +6151,7 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZLexCount(const QS
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    return this->redisExecCommand(QString("ZLEXCOUNT %1 %2 %3").arg(key, min, max));
+    return this->redisExecCommand(QtRedisCommand("ZLEXCOUNT") << key << min << max);
 }
 
 //!
@@ -4520,23 +6162,25 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZLexCount(const QS
 //! \param withScores Если true - вернуть количество элементов вместе с элементами
 //! \return
 //!
-//! Redis command: ZREMRANGEBYRANK
+//! Redis command: ZRANGE
 //!
 //! Syntax
 //!
-//! ZREMRANGEBYRANK key start stop
+//! ZRANGE key start stop [WITHSCORES]
 //!
 //! Available since:
-//!     2.0.0
+//!     1.2.0
 //! Time complexity:
-//!     O(log(N)+M) with N being the number of elements in the sorted set and M the number of elements removed by the operation.
+//!     O(log(N)+M) with N being the number of elements in the sorted set and M the number of elements returned.
 //! ACL categories:
-//!     @write, @sortedset, @slow
+//!     @read, @sortedset, @slow
+//!
+//! Returns the specified range of elements in the sorted set stored at key.
+//! The elements are considered to be ordered from the lowest to the highest score.
+//! Lexicographical order is used for elements with equal score.
 //!
-//! Removes all elements in the sorted set stored at key with rank between start and stop.
 //! Both start and stop are 0 -based indexes with 0 being the element with the lowest score.
 //! These indexes can be negative numbers, where they indicate offsets starting at the element with the highest score.
-//! For example: -1 is the element with the highest score, -2 the element with the second highest score and so forth.
 //!
 //! Examples
 //! redis> ZADD myzset 1 "one"
@@ -4545,29 +6189,46 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZLexCount(const QS
 //! (integer) 1
 //! redis> ZADD myzset 3 "three"
 //! (integer) 1
-//! redis> ZREMRANGEBYRANK myzset 0 1
-//! (integer) 2
-//! redis> ZRANGE myzset 0 -1 WITHSCORES
-//! 1) "three"
-//! 2) "3"
-//!
-//! RESP2 Reply
-//! Integer reply: the number of members removed.
+//! redis> ZRANGE myzset 0 -1
+//! 1) "one"
+//! 2) "two"
+//! 3) "three"
+//! redis> ZRANGE myzset -2 -1
+//! 1) "two"
+//! 2) "three"
 //!
-//! RESP3 Reply
-//! Integer reply: Number of members removed.
+//! RESP2/RESP3 Reply
+//!     Array reply: a list of members in the specified range, optionally with their scores if WITHSCORES was used.
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRange(const QString &key, const int start, const int stop, const bool withScores)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRange(key.toUtf8(), start, stop, withScores);
+}
+
+//!
+//! \brief Получить диапазон элементов отсортированного набора
+//! \param key Ключ
+//! \param start Начальный индекс
+//! \param stop Конечный индекс
+//! \param withScores Если true - вернуть количество элементов вместе с элементами
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRange(const T &key, const int start, const int stop, const bool withScores)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QString command = QString("ZREMRANGEBYRANK %1 %2 %3").arg(key).arg(start).arg(stop);
+    QtRedisCommand command("ZRANGE");
+    command << key << start << stop;
     if (withScores)
-        command += QString(" WITHSCORES");
+        command << "WITHSCORES";
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4659,13 +6320,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRange(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByLex(const QString &key, const QString &min, const QString &max, const int offset, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRangeByLex(key.toUtf8(), min.toUtf8(), max.toUtf8(), offset, count);
+}
+
+//!
+//! \brief Когда все элементы в отсортированном наборе вставляются с одинаковой оценкой, возвращает все элементы между min и max.
+//! \param key Ключ
+//! \param min Мин
+//! \param max Макс
+//! \param offset Смещение
+//! \param count Количество
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByLex(const T &key, const QByteArray &min, const QByteArray &max, const int offset, const int count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -4676,11 +6355,12 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByLex(const
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    QString command = QString("ZRANGEBYLEX %1 %2 %3").arg(key, min, max);
+    QtRedisCommand command("ZRANGEBYLEX");
+    command << key << min << max;
     if (offset > 0 && count > 0)
-        command += QString(" LIMIT %1 %2").arg(offset).arg(count);
+        command << "LIMIT" << offset << count;
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4798,13 +6478,32 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByLex(const
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByScore(const QString &key, const QString &min, const QString &max, const bool withScores, const int offset, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
-        return make_error("Invalid key!");
-
-    if (min.isEmpty() || min.indexOf(" ") != -1)
-        return make_error("Invalid min!");
+    return this->redisZRangeByScore(key.toUtf8(), min, max, withScores, offset, count);
+}
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+//!
+//! \brief Возвращает все элементы между min и max, включая min и max
+//! \param key Ключ
+//! \param min Мин
+//! \param max Макс
+//! \param withScores Если true - вернуть количество элементов вместе с элементами
+//! \param offset Смещение
+//! \param count Количество
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByScore(const T &key, const QString &min, const QString &max, const bool withScores, const int offset, const int count)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (min.isEmpty())
+        return make_error("Invalid min!");
+
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -4815,13 +6514,14 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByScore(cons
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    QString command = QString("ZRANGEBYSCORE %1 %2 %3").arg(key, min, max);
+    QtRedisCommand command("ZRANGEBYSCORE");
+    command << key << min << max;
     if (withScores)
-        command += QString(" WITHSCORES");
+        command << "WITHSCORES";
     if (offset > 0 && count > 0)
-        command += QString(" LIMIT %1 %2").arg(offset).arg(count);
+        command << "LIMIT" << offset << count;
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4887,12 +6587,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRangeByScore(cons
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRank(const QString &key, const QString &member)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRank(key.toUtf8(), member.toUtf8());
+}
+
+//!
+//! \brief Получить ранг элемента отсортированного набора от мин к макс
+//! \param key Ключ
+//! \param member Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRank(const T &key, const QByteArray &member)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "ZRANK" << key << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("ZRANK");
+    command << key << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -4942,18 +6657,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRank(const QStrin
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRem(const QString &key, const QStringList &members)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRem(key.toUtf8(), toUtf8List(members));
+}
+
+//!
+//! \brief Удалить элемент(ы) отсортированного набора
+//! \param key Ключ
+//! \param members Значения
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRem(const T &key, const QList<QByteArray> &members)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
     if (members.isEmpty())
         return make_error("Invalid members (Empty)!");
 
-    QStringList argv;
-    argv << "ZREM" << key;
-    for (const QString &member : members)
-        argv << member;
+    QtRedisCommand command("ZREM");
+    command << key << members;
 
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5015,13 +6743,29 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRem(const QString
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByLex(const QString &key, const QString &min, const QString &max)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRemRangeByLex(key.toUtf8(), min.toUtf8(), max.toUtf8());
+}
+
+//!
+//! \brief Когда все элементы в отсортированном наборе вставляются с одинаковой оценкой, удаляет все элементы между min и max.
+//! \param key Ключ
+//! \param min Мин
+//! \param max Макс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByLex(const T &key, const QByteArray &min, const QByteArray &max)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -5032,7 +6776,7 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByLex(con
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    return this->redisExecCommand(QString("ZREMRANGEBYLEX %1 %2 %3").arg(key, min, max));
+    return this->redisExecCommand(QtRedisCommand("ZREMRANGEBYLEX") << key << min << max);
 }
 
 //!
@@ -5082,10 +6826,26 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByLex(con
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByRank(const QString &key, const int start, const int stop)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRemRangeByRank(key.toUtf8(), start, stop);
+}
+
+//!
+//! \brief Удалить все элементе в отсортированном наборе между индексами start и stop
+//! \param key Ключ
+//! \param start Начальный индекс
+//! \param stop Конечный индекс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByRank(const T &key, const int start, const int stop)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    return this->redisExecCommand(QString("ZREMRANGEBYRANK %1 %2 %3").arg(key).arg(start).arg(stop));
+    return this->redisExecCommand(QtRedisCommand("ZREMRANGEBYRANK") << key << start << stop);
 }
 
 //!
@@ -5134,13 +6894,29 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByRank(co
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByScore(const QString &key, const QString &min, const QString &max)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRemRangeByScore(key.toUtf8(), min, max);
+}
+
+//!
+//! \brief Удалить все элементе в отсортированном наборе между min и max, включая их.
+//! \param key Ключ
+//! \param min Мин
+//! \param max Макс
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByScore(const T &key, const QString &min, const QString &max)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -5151,7 +6927,7 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByScore(c
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    return this->redisExecCommand(QString("ZREMRANGEBYSCORE %1 %2 %3").arg(key, min, max));
+    return this->redisExecCommand(QtRedisCommand("ZREMRANGEBYSCORE") << key << min << max);
 }
 
 //!
@@ -5208,14 +6984,32 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRemRangeByScore(c
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRange(const QString &key, const int start, const int stop, const bool withScores)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRevRange(key.toUtf8(), start, stop, withScores);
+}
+
+//!
+//! \brief Получить набор элементов в указанном диапазоне индексов start - stop
+//! \param key Ключ
+//! \param start Начальный индекс
+//! \param stop Конечный индекс
+//! \param withScores
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRange(const T &key, const int start, const int stop, const bool withScores)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QString command = QString("ZREVRANGE %1 %2 %3").arg(key).arg(start).arg(stop);
+    QtRedisCommand command("ZREVRANGE");
+    command << key << start << stop;
     if (withScores)
-        command += QString(" WITHSCORES");
+        command << "WITHSCORES";
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5276,13 +7070,31 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRange(const QS
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByLex(const QString &key, const QString &max, const QString &min, const int offset, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRevRangeByLex(key.toUtf8(), max.toUtf8(), min.toUtf8(), offset, count);
+}
+
+//!
+//! \brief Когда все элементы в отсортированном наборе вставляются с одинаковой оценкой, возвращает все элементы между min и max в обратном порядке.
+//! \param key Ключ
+//! \param max Макс
+//! \param min Мин
+//! \param offset Смещение
+//! \param count Количество
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByLex(const T &key, const QByteArray &max, const QByteArray &min, const int offset, const int count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -5293,11 +7105,12 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByLex(con
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    QString command = QString("ZREVRANGEBYLEX %1 %2 %3").arg(key, max, min);
+    QtRedisCommand command("ZREVRANGEBYLEX");
+    command << key << max << min;
     if (offset > 0 && count > 0)
-        command += QString(" LIMIT %1 %2").arg(offset).arg(count);
+        command << "LIMIT" << offset << count;
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5363,13 +7176,32 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByLex(con
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByScore(const QString &key, const QString &max, const QString &min, const bool withScores, const int offset, const int count)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRevRangeByScore(key.toUtf8(), max, min, withScores, offset, count);
+}
+
+//!
+//! \brief Получить все элементе в отсортированном наборе между min и max, включая их, в обратном порядке.
+//! \param key Ключ
+//! \param max Макс
+//! \param min Мин
+//! \param withScores
+//! \param offset Смещение
+//! \param count Количество
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByScore(const T &key, const QString &max, const QString &min, const bool withScores, const int offset, const int count)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    if (min.isEmpty() || min.indexOf(" ") != -1)
+    if (min.isEmpty())
         return make_error("Invalid min!");
 
-    if (max.isEmpty() || max.indexOf(" ") != -1)
+    if (max.isEmpty())
         return make_error("Invalid max!");
 
     if (min.at(0) != '(' && min.at(0) != '['
@@ -5380,13 +7212,14 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByScore(c
         && max != "+" && max != "-")
         return make_error("Invalid max!");
 
-    QString command = QString("ZREVRANGEBYSCORE %1 %2 %3").arg(key, max, min);
+    QtRedisCommand command("ZREVRANGEBYSCORE");
+    command << key << max << min;
     if (withScores)
-        command += QString(" WITHSCORES");
+        command << "WITHSCORES";
     if (offset > 0 && count > 0)
-        command += QString(" LIMIT %1 %2").arg(offset).arg(count);
+        command << "LIMIT" << offset << count;
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5452,12 +7285,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRangeByScore(c
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRank(const QString &key, const QString &member)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZRevRank(key.toUtf8(), member.toUtf8());
+}
+
+//!
+//! \brief Получить ранг элемента отсортированного набора от макс к мин
+//! \param key Ключ
+//! \param member Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRank(const T &key, const QByteArray &member)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "ZREVRANK" << key << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("ZREVRANK");
+    command << key << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5504,12 +7352,27 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZRevRank(const QSt
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZScore(const QString &key, const QString &member)
 {
-    if (key.isEmpty() || key.indexOf(" ") != -1)
+    return this->redisZScore(key.toUtf8(), member.toUtf8());
+}
+
+//!
+//! \brief Получить счет элемента отсортированного набора
+//! \param key Ключ
+//! \param member Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZScore(const T &key, const QByteArray &member)
+{
+    if (key.isEmpty())
         return make_error("Invalid key!");
 
-    QStringList argv;
-    argv << "ZSCORE" << key << member;
-    return this->redisExecCommand(argv);
+    QtRedisCommand command("ZSCORE");
+    command << key << member;
+    return this->redisExecCommand(command);
 }
 
 //!
@@ -5576,21 +7439,32 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZScore(const QStri
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
 __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZUnionStore(const QString &destKey, const QStringList &keyList, const QList<int> &weightList, const QString &aggregateFlag)
 {
-    if (destKey.isEmpty() || destKey.indexOf(" ") != -1)
+    return this->redisZUnionStore(destKey.toUtf8(), toUtf8List(keyList), weightList, aggregateFlag);
+}
+
+//!
+//! \brief Вычислить объединение отсортированных наборов и сохранить результат в новый набор
+//! \param destKey Название ключа нового набора
+//! \param keyList Список ключей наборов
+//! \param weightList Список "весов"
+//! \param aggregateFlag Флаг агрегации (SUM|MIN|MAX)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZUnionStore(const T &destKey, const QList<QByteArray> &keyList, const QList<int> &weightList, const QString &aggregateFlag)
+{
+    if (destKey.isEmpty())
         return make_error("Invalid destKey!");
 
     if (keyList.isEmpty())
         return make_error("Invalid keyList (Empty)!");
 
-    for (const QString &key : keyList) {
-        if (key.indexOf(" ") != -1)
-            return make_error(QString("Invalid key (%1)!").arg(key));
-    }
-    QString weightListStr;
     for (const int weight : weightList) {
         if (weight <= 0)
             return __RESULT_IMPL();
-        weightListStr += QString("%1 ").arg(weight);
     }
     if (!aggregateFlag.isEmpty()
         && aggregateFlag.toUpper() != QString("SUM")
@@ -5598,40 +7472,2687 @@ __RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZUnionStore(const
         && aggregateFlag.toUpper() != QString("MAX"))
         return make_error("Invalid aggregateFlag!");
 
-    QString command = QString("ZUNIONSTORE %1 %2 %3")
-                      .arg(destKey)
-                      .arg(keyList.size())
-                      .arg(keyList.join(" "));
-
-    if (!weightList.isEmpty())
-        command += QString(" WEIGHTS %1").arg(weightListStr);
+    QtRedisCommand command("ZUNIONSTORE");
+    command << destKey << keyList.size() << keyList;
+    if (!weightList.isEmpty()) {
+        command << "WEIGHTS";
+        for (const int weight : weightList)
+            command << weight;
+    }
     if (!aggregateFlag.isEmpty())
-        command += QString(" AGGREGATE %1").arg(aggregateFlag.toUpper());
+        command << "AGGREGATE" << aggregateFlag.toUpper();
 
-    return this->redisExecCommand(command.trimmed());
+    return this->redisExecCommand(command);
 }
 
-// --- protected ---
+//!
+//! \brief Выполнить итерацию по элементам отсортированного набора
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон элементов (пустой - все элементы)
+//! \param count Рекомендуемое количество элементов за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Redis command: ZSCAN
+//!
+//! Syntax
+//!
+//! ZSCAN key cursor [MATCH pattern] [COUNT count]
+//!
+//! Available since:
+//!     2.8.0
+//! Time complexity:
+//!     O(1) for every call. O(N) for a complete iteration, including enough command calls for the cursor to return back to 0.
+//!     N is the number of elements inside the collection.
+//! ACL categories:
+//!     @read, @sortedset, @slow
+//!
+//! See SCAN for ZSCAN documentation.
+//!
+//! Examples
+//! redis> ZADD myzset 1 one 2 two
+//! (integer) 2
+//! redis> ZSCAN myzset 0
+//! 1) "0"
+//! 2) 1) "one"
+//!    2) "1"
+//!    3) "two"
+//!    4) "2"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a two-element array.
+//!     The first element is a Bulk string reply that represents an unsigned 64-bit number, the cursor.
+//!     The second element is an Array reply of member/score pairs (members and scores alternate).
+//!
+//! Note: See QtRedisScanIterator for the iteration with batches and prefetch.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZScan(const QString &key, const qulonglong cursor, const QString &pattern, const int count)
+{
+    return this->redisZScan(key.toUtf8(), cursor, pattern.toUtf8(), count);
+}
 
 //!
-//! \brief Установить последнюю ошибку
-//! \param error Ошибка
+//! \brief Выполнить итерацию по элементам отсортированного набора
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон элементов (пустой - все элементы)
+//! \param count Рекомендуемое количество элементов за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
-void QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::setLastError_safe(const QString &error)
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisZScan(const T &key, const qulonglong cursor, const QByteArray &pattern, const int count)
 {
-    QMutexLocker lock(&_mutexErr);
-    _lastError = error;
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    QtRedisCommand command("ZSCAN");
+    command << key << cursor;
+    if (!pattern.isEmpty())
+        command << "MATCH" << pattern;
+    if (count > 0)
+        command << "COUNT" << count;
+    return this->redisExecCommand(command);
+}
+
+
+// ------------------------------------------------------------------------
+// -- HASH COMMANDS -------------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Удалить поля хэша
+//! \param key Ключ
+//! \param fieldList Список полей
+//! \return
+//!
+//! Redis command: HDEL
+//!
+//! Syntax
+//!
+//! HDEL key field [field ...]
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(N) where N is the number of fields to be removed.
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Removes the specified fields from the hash stored at key. Specified fields that do not exist within this hash are ignored.
+//! Deletes the hash if no fields remain. If key does not exist, it is treated as an empty hash and this command returns 0.
+//!
+//! Examples
+//! redis> HSET myhash field1 "foo"
+//! (integer) 1
+//! redis> HDEL myhash field1
+//! (integer) 1
+//! redis> HDEL myhash field2
+//! (integer) 0
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of fields that were removed from the hash, excluding any specified but non-existing fields.
+//!
+//! History
+//!     Starting with Redis version 2.4.0: Accepts multiple field arguments.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHDel(const QString &key, const QStringList &fieldList)
+{
+    return this->redisHDel(key.toUtf8(), toUtf8List(fieldList));
 }
 
 //!
-//! \brief Очистить посленюю ошибку
+//! \brief Удалить поля хэша
+//! \param key Ключ
+//! \param fieldList Список полей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
 //!
 template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
-void QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::clearLastError_safe()
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHDel(const T &key, const QList<QByteArray> &fieldList)
 {
-    QMutexLocker lock(&_mutexErr);
-    _lastError.clear();
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (fieldList.isEmpty())
+        return make_error("Invalid fieldList (Empty)!");
+
+    QtRedisCommand command("HDEL");
+    command.reserve(fieldList.size() + 1);
+    command << key << fieldList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Проверить существование поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Redis command: HEXISTS
+//!
+//! Syntax
+//!
+//! HEXISTS key field
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @read, @hash, @fast
+//!
+//! Returns if field is an existing field in the hash stored at key.
+//!
+//! Examples
+//! redis> HSET myhash field1 "foo"
+//! (integer) 1
+//! redis> HEXISTS myhash field1
+//! (integer) 1
+//! redis> HEXISTS myhash field2
+//! (integer) 0
+//!
+//! RESP2/RESP3 Reply
+//! One of the following:
+//!     Integer reply: 0 if the hash does not contain the field, or the key does not exist.
+//!     Integer reply: 1 if the hash contains the field.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHExists(const QString &key, const QString &field)
+{
+    return this->redisHExists(key.toUtf8(), field.toUtf8());
+}
+
+//!
+//! \brief Проверить существование поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHExists(const T &key, const QByteArray &field)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HEXISTS") << key << field);
+}
+
+//!
+//! \brief Получить значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Redis command: HGET
+//!
+//! Syntax
+//!
+//! HGET key field
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @read, @hash, @fast
+//!
+//! Returns the value associated with field in the hash stored at key.
+//!
+//! Examples
+//! redis> HSET myhash field1 "foo"
+//! (integer) 1
+//! redis> HGET myhash field1
+//! "foo"
+//! redis> HGET myhash field2
+//! (nil)
+//!
+//! RESP2 Reply
+//! One of the following:
+//!     Bulk string reply: The value associated with the field.
+//!     Nil reply: If the field is not present in the hash or key does not exist.
+//!
+//! RESP3 Reply
+//! One of the following:
+//!     Bulk string reply: The value associated with the field.
+//!     Null reply: If the field is not present in the hash or key does not exist.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHGet(const QString &key, const QString &field)
+{
+    return this->redisHGet(key.toUtf8(), field.toUtf8());
+}
+
+//!
+//! \brief Получить значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHGet(const T &key, const QByteArray &field)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HGET") << key << field);
+}
+
+//!
+//! \brief Получить все поля и значения хэша
+//! \param key Ключ
+//! \return
+//!
+//! Redis command: HGETALL
+//!
+//! Syntax
+//!
+//! HGETALL key
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(N) where N is the size of the hash.
+//! ACL categories:
+//!     @read, @hash, @slow
+//!
+//! Returns all fields and values of the hash stored at key. In the returned value,
+//! every field name is followed by its value, so the length of the reply is twice the size of the hash.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HSET myhash field2 "World"
+//! (integer) 1
+//! redis> HGETALL myhash
+//! 1) "field1"
+//! 2) "Hello"
+//! 3) "field2"
+//! 4) "World"
+//!
+//! RESP2 Reply
+//! Array reply: a list of fields and their values stored in the hash, or an empty list when key does not exist.
+//!
+//! RESP3 Reply
+//! Map reply: a map of all fields and their values stored in the hash, or an empty list when key does not exist.
+//!
+//! Note: Use QtRedisReply::replyToByteArrayHash() to get the result as QHash<QByteArray, QByteArray>.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHGetAll(const QString &key)
+{
+    return this->redisHGetAll(key.toUtf8());
+}
+
+//!
+//! \brief Получить все поля и значения хэша
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHGetAll(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("HGETALL") << key);
+}
+
+//!
+//! \brief Увеличить целочисленное значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param incr Приращение
+//! \return
+//!
+//! Redis command: HINCRBY
+//!
+//! Syntax
+//!
+//! HINCRBY key field increment
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Increments the number stored at field in the hash stored at key by increment. If key does not exist,
+//! a new key holding a hash is created. If field does not exist the value is set to 0 before the operation is performed.
+//!
+//! The range of values supported by HINCRBY is limited to 64 bit signed integers.
+//!
+//! Examples
+//! redis> HSET myhash field 5
+//! (integer) 1
+//! redis> HINCRBY myhash field 1
+//! (integer) 6
+//! redis> HINCRBY myhash field -1
+//! (integer) 5
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the value of the field after the increment operation.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHIncrBy(const QString &key, const QString &field, const qint64 incr)
+{
+    return this->redisHIncrBy(key.toUtf8(), field.toUtf8(), incr);
+}
+
+//!
+//! \brief Увеличить целочисленное значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param incr Приращение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHIncrBy(const T &key, const QByteArray &field, const qint64 incr)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HINCRBY") << key << field << incr);
+}
+
+//!
+//! \brief Увеличить вещественное значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param incr Приращение
+//! \return
+//!
+//! Redis command: HINCRBYFLOAT
+//!
+//! Syntax
+//!
+//! HINCRBYFLOAT key field increment
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Increment the specified field of a hash stored at key, and representing a floating point number, by the specified increment.
+//! If the increment value is negative, the result is to have the hash field value decremented instead of incremented.
+//! If the field does not exist, it is set to 0 before performing the operation.
+//!
+//! Examples
+//! redis> HSET mykey field 10.50
+//! (integer) 1
+//! redis> HINCRBYFLOAT mykey field 0.1
+//! "10.6"
+//! redis> HINCRBYFLOAT mykey field -5
+//! "5.6"
+//!
+//! RESP2/RESP3 Reply
+//! Bulk string reply: the value of the field after the increment operation.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHIncrByFloat(const QString &key, const QString &field, const double incr)
+{
+    return this->redisHIncrByFloat(key.toUtf8(), field.toUtf8(), incr);
+}
+
+//!
+//! \brief Увеличить вещественное значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param incr Приращение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHIncrByFloat(const T &key, const QByteArray &field, const double incr)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HINCRBYFLOAT") << key << field << incr);
+}
+
+//!
+//! \brief Получить все поля хэша
+//! \param key Ключ
+//! \return
+//!
+//! Redis command: HKEYS
+//!
+//! Syntax
+//!
+//! HKEYS key
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(N) where N is the size of the hash.
+//! ACL categories:
+//!     @read, @hash, @slow
+//!
+//! Returns all field names in the hash stored at key.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HSET myhash field2 "World"
+//! (integer) 1
+//! redis> HKEYS myhash
+//! 1) "field1"
+//! 2) "field2"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a list of fields in the hash, or an empty list when the key does not exist.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHKeys(const QString &key)
+{
+    return this->redisHKeys(key.toUtf8());
+}
+
+//!
+//! \brief Получить все поля хэша
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHKeys(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("HKEYS") << key);
+}
+
+//!
+//! \brief Получить количество полей хэша
+//! \param key Ключ
+//! \return
+//!
+//! Redis command: HLEN
+//!
+//! Syntax
+//!
+//! HLEN key
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @read, @hash, @fast
+//!
+//! Returns the number of fields contained in the hash stored at key.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HSET myhash field2 "World"
+//! (integer) 1
+//! redis> HLEN myhash
+//! (integer) 2
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of fields in the hash, or 0 when the key does not exist.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHLen(const QString &key)
+{
+    return this->redisHLen(key.toUtf8());
+}
+
+//!
+//! \brief Получить количество полей хэша
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHLen(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("HLEN") << key);
+}
+
+//!
+//! \brief Получить значения нескольких полей хэша
+//! \param key Ключ
+//! \param fieldList Список полей
+//! \return
+//!
+//! Redis command: HMGET
+//!
+//! Syntax
+//!
+//! HMGET key field [field ...]
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(N) where N is the number of fields being requested.
+//! ACL categories:
+//!     @read, @hash, @fast
+//!
+//! Returns the values associated with the specified fields in the hash stored at key.
+//!
+//! For every field that does not exist in the hash, a nil value is returned. Because non-existing keys are treated as empty hashes,
+//! running HMGET against a non-existing key will return a list of nil values.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HSET myhash field2 "World"
+//! (integer) 1
+//! redis> HMGET myhash field1 field2 nofield
+//! 1) "Hello"
+//! 2) "World"
+//! 3) (nil)
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a list of values associated with the given fields, in the same order as they are requested.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHMGet(const QString &key, const QStringList &fieldList)
+{
+    return this->redisHMGet(key.toUtf8(), toUtf8List(fieldList));
+}
+
+//!
+//! \brief Получить значения нескольких полей хэша
+//! \param key Ключ
+//! \param fieldList Список полей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHMGet(const T &key, const QList<QByteArray> &fieldList)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (fieldList.isEmpty())
+        return make_error("Invalid fieldList (Empty)!");
+
+    QtRedisCommand command("HMGET");
+    command.reserve(fieldList.size() + 1);
+    command << key << fieldList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Задать значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param value Значение
+//! \return
+//!
+//! Redis command: HSET
+//!
+//! Syntax
+//!
+//! HSET key field value [field value ...]
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1) for each field/value pair added, so O(N) to add N field/value pairs when the command is called with multiple field/value pairs.
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Sets the specified fields to their respective values in the hash stored at key.
+//!
+//! This command overwrites the values of specified fields that exist in the hash. If key doesn't exist, a new key holding a hash is created.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HGET myhash field1
+//! "Hello"
+//! redis> HSET myhash field2 "Hi" field3 "World"
+//! (integer) 2
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of fields that were added.
+//!
+//! History
+//!     Starting with Redis version 4.0.0: Accepts multiple field and value arguments.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSet(const QString &key, const QString &field, const QString &value)
+{
+    return this->redisHSet(key.toUtf8(), field.toUtf8(), value.toUtf8());
+}
+
+//!
+//! \brief Задать значение поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \param value Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSet(const T &key, const QByteArray &field, const QByteArray &value)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HSET") << key << field << value);
+}
+
+//!
+//! \brief Задать значения нескольких полей хэша
+//! \param key Ключ
+//! \param fieldValue Список поле-значение
+//! \return
+//!
+//! Redis command: HSET
+//!
+//! Syntax
+//!
+//! HSET key field value [field value ...]
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1) for each field/value pair added, so O(N) to add N field/value pairs when the command is called with multiple field/value pairs.
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Sets the specified fields to their respective values in the hash stored at key.
+//!
+//! This command overwrites the values of specified fields that exist in the hash. If key doesn't exist, a new key holding a hash is created.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HGET myhash field1
+//! "Hello"
+//! redis> HSET myhash field2 "Hi" field3 "World"
+//! (integer) 2
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of fields that were added.
+//!
+//! History
+//!     Starting with Redis version 4.0.0: Accepts multiple field and value arguments.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSet(const QString &key, const QMap<QString, QString> &fieldValue)
+{
+    return this->redisHSet(key.toUtf8(), toUtf8Map(fieldValue));
+}
+
+//!
+//! \brief Задать значения нескольких полей хэша
+//! \param key Ключ
+//! \param fieldValue Список поле-значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSet(const T &key, const QMap<QByteArray, QByteArray> &fieldValue)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (fieldValue.isEmpty())
+        return make_error("Invalid field-value (Empty)!");
+
+    QtRedisCommand command("HSET");
+    command.reserve(fieldValue.size() * 2 + 1);
+    command << key;
+    for (auto i = fieldValue.constBegin(); i != fieldValue.constEnd(); ++i) {
+        if (i.key().isEmpty())
+            return make_error("Invalid field!");
+
+        command << i.key() << i.value();
+    }
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Задать значение поля хэша, если поле не существует
+//! \param key Ключ
+//! \param field Поле
+//! \param value Значение
+//! \return
+//!
+//! Redis command: HSETNX
+//!
+//! Syntax
+//!
+//! HSETNX key field value
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @hash, @fast
+//!
+//! Sets field in the hash stored at key to value, only if field does not yet exist.
+//! If key does not exist, a new key holding a hash is created. If field already exists, this operation has no effect.
+//!
+//! Examples
+//! redis> HSETNX myhash field "Hello"
+//! (integer) 1
+//! redis> HSETNX myhash field "World"
+//! (integer) 0
+//! redis> HGET myhash field
+//! "Hello"
+//!
+//! RESP2/RESP3 Reply
+//! One of the following:
+//!     Integer reply: 0 if the field already exists in the hash and no operation was performed.
+//!     Integer reply: 1 if the field is a new field in the hash and the value was set.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSetNx(const QString &key, const QString &field, const QString &value)
+{
+    return this->redisHSetNx(key.toUtf8(), field.toUtf8(), value.toUtf8());
+}
+
+//!
+//! \brief Задать значение поля хэша, если поле не существует
+//! \param key Ключ
+//! \param field Поле
+//! \param value Значение
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHSetNx(const T &key, const QByteArray &field, const QByteArray &value)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HSETNX") << key << field << value);
+}
+
+//!
+//! \brief Получить длину значения поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Redis command: HSTRLEN
+//!
+//! Syntax
+//!
+//! HSTRLEN key field
+//!
+//! Available since:
+//!     3.2.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @read, @hash, @fast
+//!
+//! Returns the string length of the value associated with field in the hash stored at key.
+//! If the key or the field do not exist, 0 is returned.
+//!
+//! Examples
+//! redis> HSET myhash f1 HelloWorld f2 99 f3 -256
+//! (integer) 3
+//! redis> HSTRLEN myhash f1
+//! (integer) 10
+//! redis> HSTRLEN myhash f2
+//! (integer) 2
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the string length of the value associated with the field, or zero when the field isn't present in the hash or the key doesn't exist at all.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHStrlen(const QString &key, const QString &field)
+{
+    return this->redisHStrlen(key.toUtf8(), field.toUtf8());
+}
+
+//!
+//! \brief Получить длину значения поля хэша
+//! \param key Ключ
+//! \param field Поле
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHStrlen(const T &key, const QByteArray &field)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (field.isEmpty())
+        return make_error("Invalid field!");
+
+    return this->redisExecCommand(QtRedisCommand("HSTRLEN") << key << field);
+}
+
+//!
+//! \brief Получить все значения хэша
+//! \param key Ключ
+//! \return
+//!
+//! Redis command: HVALS
+//!
+//! Syntax
+//!
+//! HVALS key
+//!
+//! Available since:
+//!     2.0.0
+//! Time complexity:
+//!     O(N) where N is the size of the hash.
+//! ACL categories:
+//!     @read, @hash, @slow
+//!
+//! Returns all values in the hash stored at key.
+//!
+//! Examples
+//! redis> HSET myhash field1 "Hello"
+//! (integer) 1
+//! redis> HSET myhash field2 "World"
+//! (integer) 1
+//! redis> HVALS myhash
+//! 1) "Hello"
+//! 2) "World"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a list of values in the hash, or an empty list when the key does not exist.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHVals(const QString &key)
+{
+    return this->redisHVals(key.toUtf8());
+}
+
+//!
+//! \brief Получить все значения хэша
+//! \param key Ключ
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHVals(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("HVALS") << key);
+}
+
+//!
+//! \brief Выполнить итерацию по полям хэша
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон полей (пустой - все поля)
+//! \param count Рекомендуемое количество полей за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Redis command: HSCAN
+//!
+//! Syntax
+//!
+//! HSCAN key cursor [MATCH pattern] [COUNT count]
+//!
+//! Available since:
+//!     2.8.0
+//! Time complexity:
+//!     O(1) for every call. O(N) for a complete iteration, including enough command calls for the cursor to return back to 0.
+//!     N is the number of elements inside the collection.
+//! ACL categories:
+//!     @read, @hash, @slow
+//!
+//! Incrementally iterates the fields of the hash stored at key (see SCAN for the cursor semantics).
+//! The iteration starts with the cursor 0 and is complete when the server returns the cursor 0.
+//!
+//! Examples
+//! redis> HSET myhash name Jack age 33
+//! (integer) 2
+//! redis> HSCAN myhash 0
+//! 1) "0"
+//! 2) 1) "name"
+//!    2) "Jack"
+//!    3) "age"
+//!    4) "33"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a two-element array.
+//!     The first element is a Bulk string reply that represents an unsigned 64-bit number, the cursor.
+//!     The second element is an Array reply of field/value pairs that were scanned.
+//!
+//! Note: See QtRedisScanIterator for the iteration with batches and prefetch.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHScan(const QString &key, const qulonglong cursor, const QString &pattern, const int count)
+{
+    return this->redisHScan(key.toUtf8(), cursor, pattern.toUtf8(), count);
+}
+
+//!
+//! \brief Выполнить итерацию по полям хэша
+//! \param key Ключ
+//! \param cursor Курсор (0 - начало итерации)
+//! \param pattern Шаблон полей (пустой - все поля)
+//! \param count Рекомендуемое количество полей за итерацию (0 - по умолчанию)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisHScan(const T &key, const qulonglong cursor, const QByteArray &pattern, const int count)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    QtRedisCommand command("HSCAN");
+    command << key << cursor;
+    if (!pattern.isEmpty())
+        command << "MATCH" << pattern;
+    if (count > 0)
+        command << "COUNT" << count;
+    return this->redisExecCommand(command);
+}
+
+
+// ------------------------------------------------------------------------
+// -- STREAM COMMANDS -----------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Добавить запись в поток
+//! \param key Ключ потока
+//! \param fieldValue Список поле-значение
+//! \param id Идентификатор записи (* - генерируется сервером)
+//! \param maxLen Максимальная длина потока (-1 - без ограничения)
+//! \param approximate Приблизительное ограничение длины (~)
+//! \return
+//!
+//! Redis command: XADD
+//!
+//! Syntax
+//!
+//! XADD key [NOMKSTREAM] [<MAXLEN | MINID> [= | ~] threshold [LIMIT count]] <* | id> field value [field value ...]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1) when adding a new entry, O(N) when trimming where N being the number of entries evicted.
+//! ACL categories:
+//!     @write, @stream, @fast
+//!
+//! Appends the specified stream entry to the stream at the specified key. If the key does not exist,
+//! as a side effect of running this command the key is created with a stream value.
+//!
+//! An entry is composed of a list of field-value pairs. The field-value pairs are stored in the same order they are given by the user.
+//! Commands that read the stream, such as XRANGE or XREAD, are guaranteed to return the fields and values exactly in the same order they were added by XADD.
+//!
+//! When the MAXLEN option is given, the stream is trimmed to the threshold (see XTRIM). The ~ argument
+//! enables the efficient (approximate) trimming of whole macro nodes.
+//!
+//! Examples
+//! redis> XADD mystream * name Sara surname OConnor
+//! "1714566612045-0"
+//! redis> XADD mystream * field1 value1 field2 value2 field3 value3
+//! "1714566612046-0"
+//! redis> XLEN mystream
+//! (integer) 2
+//!
+//! RESP2 Reply
+//! One of the following:
+//!     Bulk string reply: The ID of the added entry. The ID is the one automatically generated if an asterisk (*) is passed as the id argument,
+//!     otherwise the command just returns the same ID specified by the user during insertion.
+//!     Nil reply: if the NOMKSTREAM option is given and the key doesn't exist.
+//!
+//! RESP3 Reply
+//! One of the following:
+//!     Bulk string reply: The ID of the added entry.
+//!     Null reply: if the NOMKSTREAM option is given and the key doesn't exist.
+//!
+//! Note: The fields are sent in the order of QMap (sorted by the field name).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAdd(const QString &key, const QMap<QString, QString> &fieldValue, const QString &id, const qlonglong maxLen, const bool approximate)
+{
+    return this->redisXAdd(key.toUtf8(), toUtf8Map(fieldValue), id, maxLen, approximate);
+}
+
+//!
+//! \brief Добавить запись в поток
+//! \param key Ключ потока
+//! \param fieldValue Список поле-значение
+//! \param id Идентификатор записи (* - генерируется сервером)
+//! \param maxLen Максимальная длина потока (-1 - без ограничения)
+//! \param approximate Приблизительное ограничение длины (~)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAdd(const T &key, const QMap<QByteArray, QByteArray> &fieldValue, const QString &id, const qlonglong maxLen, const bool approximate)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (fieldValue.isEmpty())
+        return make_error("Invalid field-value (Empty)!");
+
+    if (id.isEmpty())
+        return make_error("Invalid id!");
+
+    QtRedisCommand command("XADD");
+    command.reserve(fieldValue.size() * 2 + 5);
+    command << key;
+    if (maxLen >= 0) {
+        command << "MAXLEN";
+        if (approximate)
+            command << "~";
+        command << maxLen;
+    }
+    command << id;
+    for (auto i = fieldValue.constBegin(); i != fieldValue.constEnd(); ++i) {
+        if (i.key().isEmpty())
+            return make_error("Invalid field!");
+
+        command << i.key() << i.value();
+    }
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Получить количество записей потока
+//! \param key Ключ потока
+//! \return
+//!
+//! Redis command: XLEN
+//!
+//! Syntax
+//!
+//! XLEN key
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @read, @stream, @fast
+//!
+//! Returns the number of entries inside a stream. If the specified key does not exist the command returns zero, as if the stream was empty.
+//!
+//! Examples
+//! redis> XADD mystream * item 1
+//! "1714566612045-0"
+//! redis> XLEN mystream
+//! (integer) 1
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of entries of the stream at key.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXLen(const QString &key)
+{
+    return this->redisXLen(key.toUtf8());
+}
+
+//!
+//! \brief Получить количество записей потока
+//! \param key Ключ потока
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXLen(const T &key)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    return this->redisExecCommand(QtRedisCommand("XLEN") << key);
+}
+
+//!
+//! \brief Получить записи потока в диапазоне идентификаторов
+//! \param key Ключ потока
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param count Максимальное количество записей (-1 - без ограничения)
+//! \return
+//!
+//! Redis command: XRANGE
+//!
+//! Syntax
+//!
+//! XRANGE key start end [COUNT count]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N) with N being the number of elements being returned.
+//!     If N is constant (e.g. always asking for the first 10 elements with COUNT), you can consider it O(1).
+//! ACL categories:
+//!     @read, @stream, @slow
+//!
+//! The command returns the stream entries matching a given range of IDs. The range is specified by a minimum and maximum ID.
+//! The - and + special IDs mean respectively the minimum ID possible and the maximum ID possible inside a stream.
+//! The ( prefix makes the range exclusive (since 6.2.0).
+//!
+//! Examples
+//! redis> XADD writers * name Virginia surname Woolf
+//! "1714566612045-0"
+//! redis> XRANGE writers - + COUNT 1
+//! 1) 1) "1714566612045-0"
+//!    2) 1) "name"
+//!       2) "Virginia"
+//!       3) "surname"
+//!       4) "Woolf"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: a list of stream entries with IDs matching the specified range.
+//!
+//! Note: Use QtRedisStreamEntry::fromReply() to get the list of entries.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRange(const QString &key, const QString &start, const QString &end, const int count)
+{
+    return this->redisXRange(key.toUtf8(), start, end, count);
+}
+
+//!
+//! \brief Получить записи потока в диапазоне идентификаторов
+//! \param key Ключ потока
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param count Максимальное количество записей (-1 - без ограничения)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRange(const T &key, const QString &start, const QString &end, const int count)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (start.isEmpty() || end.isEmpty())
+        return make_error("Invalid range!");
+
+    QtRedisCommand command("XRANGE");
+    command << key << start << end;
+    if (count > 0)
+        command << "COUNT" << count;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Получить записи потока в диапазоне идентификаторов в обратном порядке
+//! \param key Ключ потока
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param count Максимальное количество записей (-1 - без ограничения)
+//! \return
+//!
+//! Redis command: XREVRANGE
+//!
+//! Syntax
+//!
+//! XREVRANGE key end start [COUNT count]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N) with N being the number of elements returned.
+//!     If N is constant (e.g. always asking for the first 10 elements with COUNT), you can consider it O(1).
+//! ACL categories:
+//!     @read, @stream, @slow
+//!
+//! This command is exactly like XRANGE, but with the notable difference of returning the entries in reverse order,
+//! and also taking the start-end range in reverse order: in XREVRANGE you need to state the end ID and later the start ID.
+//!
+//! Examples
+//! redis> XREVRANGE writers + - COUNT 1
+//! 1) 1) "1714566612047-0"
+//!    2) 1) "name"
+//!       2) "Jane"
+//!       3) "surname"
+//!       4) "Austen"
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: The command returns the entries with IDs matching the specified range.
+//! The returned entries are complete, which means that the ID and all the fields they are composed of are returned.
+//!
+//! Note: Use QtRedisStreamEntry::fromReply() to get the list of entries.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRevRange(const QString &key, const QString &end, const QString &start, const int count)
+{
+    return this->redisXRevRange(key.toUtf8(), end, start, count);
+}
+
+//!
+//! \brief Получить записи потока в диапазоне идентификаторов в обратном порядке
+//! \param key Ключ потока
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param count Максимальное количество записей (-1 - без ограничения)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRevRange(const T &key, const QString &end, const QString &start, const int count)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (end.isEmpty() || start.isEmpty())
+        return make_error("Invalid range!");
+
+    QtRedisCommand command("XREVRANGE");
+    command << key << end << start;
+    if (count > 0)
+        command << "COUNT" << count;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Удалить записи потока
+//! \param key Ключ потока
+//! \param idList Список идентификаторов записей
+//! \return
+//!
+//! Redis command: XDEL
+//!
+//! Syntax
+//!
+//! XDEL key id [id ...]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1) for each single item to delete in the stream, regardless of the stream size.
+//! ACL categories:
+//!     @write, @stream, @fast
+//!
+//! Removes the specified entries from a stream, and returns the number of entries deleted.
+//! This number may be less than the number of IDs passed to the command in the case where some of the specified IDs do not exist in the stream.
+//!
+//! Examples
+//! redis> XADD mystream 1538561700640-0 a 1
+//! "1538561700640-0"
+//! redis> XDEL mystream 1538561700640-0
+//! (integer) 1
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of entries that were deleted.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXDel(const QString &key, const QStringList &idList)
+{
+    return this->redisXDel(key.toUtf8(), idList);
+}
+
+//!
+//! \brief Удалить записи потока
+//! \param key Ключ потока
+//! \param idList Список идентификаторов записей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXDel(const T &key, const QStringList &idList)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (idList.isEmpty())
+        return make_error("Invalid idList (Empty)!");
+
+    QtRedisCommand command("XDEL");
+    command.reserve(idList.size() + 1);
+    command << key << idList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Ограничить длину потока
+//! \param key Ключ потока
+//! \param maxLen Максимальная длина потока
+//! \param approximate Приблизительное ограничение длины (~)
+//! \return
+//!
+//! Redis command: XTRIM
+//!
+//! Syntax
+//!
+//! XTRIM key <MAXLEN | MINID> [= | ~] threshold [LIMIT count]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N), with N being the number of evicted entries.
+//!     Constant times are very small however, since entries are organized in macro nodes containing multiple entries that can be released with a single deallocation.
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! XTRIM trims the stream by evicting older entries (entries with lower IDs) if needed.
+//! MAXLEN evicts entries as long as the stream's length exceeds the specified threshold.
+//! The ~ argument makes the trimming approximate (more efficient, the stream can be slightly longer).
+//!
+//! Examples
+//! redis> XTRIM mystream MAXLEN 2
+//! (integer) 0
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: The number of entries deleted from the stream.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXTrim(const QString &key, const qlonglong maxLen, const bool approximate)
+{
+    return this->redisXTrim(key.toUtf8(), maxLen, approximate);
+}
+
+//!
+//! \brief Ограничить длину потока
+//! \param key Ключ потока
+//! \param maxLen Максимальная длина потока
+//! \param approximate Приблизительное ограничение длины (~)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXTrim(const T &key, const qlonglong maxLen, const bool approximate)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (maxLen < 0)
+        return make_error("Invalid maxLen!");
+
+    QtRedisCommand command("XTRIM");
+    command << key << "MAXLEN";
+    if (approximate)
+        command << "~";
+    command << maxLen;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Прочитать записи потоков
+//! \param keyList Список ключей потоков
+//! \param idList Список идентификаторов, после которых читать записи ($ - только новые записи)
+//! \param count Максимальное количество записей каждого потока (-1 - без ограничения)
+//! \param blockMSec Время ожидания записей мсек (-1 - не ожидать, 0 - ожидать бесконечно)
+//! \return
+//!
+//! Redis command: XREAD
+//!
+//! Syntax
+//!
+//! XREAD [COUNT count] [BLOCK milliseconds] STREAMS key [key ...] id [id ...]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     For each stream mentioned: O(N) with N being the number of elements being returned,
+//!     it means that XREAD-ing with a fixed COUNT is O(1). Note that when the BLOCK option is used,
+//!     XADD will pay O(M) time in order to serve the M clients blocked on the stream getting new data.
+//! ACL categories:
+//!     @read, @stream, @slow, @blocking
+//!
+//! Read data from one or multiple streams, only returning entries with an ID greater than the last received ID reported by the caller.
+//! This command has an option to block if items are not available, in a similar fashion to BRPOP or BZPOPMIN and others.
+//!
+//! RESP2 Reply
+//! One of the following:
+//!     Array reply: an array where each element is an array composed of a two elements containing the key name and the entries reported for that key.
+//!     The entries reported are full stream entries, having IDs and the list of all the fields and values.
+//!     Nil reply: if the BLOCK option is given and a timeout occurs, or if there is no stream that can be served.
+//!
+//! RESP3 Reply
+//! One of the following:
+//!     Map reply: A map of key-value elements where each element is composed of the key name and the entries reported for that key.
+//!     Null reply: if the BLOCK option is given and a timeout occurs, or if there is no stream that can be served.
+//!
+//! Note: Use QtRedisStreamEntry::fromReply() to get the list of entries.
+//! Warn: The reply is waited no longer than the read timeout of the connection (30 sec), use blockMSec below it!
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRead(const QStringList &keyList, const QStringList &idList, const int count, const int blockMSec)
+{
+    return this->redisXRead(toUtf8List(keyList), idList, count, blockMSec);
+}
+
+//!
+//! \brief Прочитать записи потоков
+//! \param keyList Список ключей потоков
+//! \param idList Список идентификаторов, после которых читать записи ($ - только новые записи)
+//! \param count Максимальное количество записей каждого потока (-1 - без ограничения)
+//! \param blockMSec Время ожидания записей мсек (-1 - не ожидать, 0 - ожидать бесконечно)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXRead(const T &keyList, const QStringList &idList, const int count, const int blockMSec)
+{
+    if (keyList.isEmpty() || keyList.size() != idList.size())
+        return make_error("Invalid keyList or idList (Empty or size mismatch)!");
+
+    QtRedisCommand command("XREAD");
+    command.reserve(keyList.size() * 2 + 5);
+    if (count > 0)
+        command << "COUNT" << count;
+    if (blockMSec >= 0)
+        command << "BLOCK" << blockMSec;
+    command << "STREAMS" << keyList << idList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Прочитать записи потоков в группе потребителей
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \param keyList Список ключей потоков
+//! \param idList Список идентификаторов (> - новые записи, иначе - ожидающие подтверждения записи потребителя)
+//! \param count Максимальное количество записей каждого потока (-1 - без ограничения)
+//! \param blockMSec Время ожидания записей мсек (-1 - не ожидать, 0 - ожидать бесконечно)
+//! \param noAck Не добавлять записи в список ожидающих подтверждения
+//! \return
+//!
+//! Redis command: XREADGROUP
+//!
+//! Syntax
+//!
+//! XREADGROUP GROUP group consumer [COUNT count] [BLOCK milliseconds] [NOACK] STREAMS key [key ...] id [id ...]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     For each stream mentioned: O(M) with M being the number of elements returned.
+//!     If M is constant (e.g. always asking for the first 10 elements with COUNT), you can consider it O(1).
+//!     On the other side when XREADGROUP blocks, XADD will pay the O(N) time in order to serve the N clients blocked on the stream getting new data.
+//! ACL categories:
+//!     @write, @stream, @slow, @blocking
+//!
+//! The XREADGROUP command is a special version of the XREAD command with support for consumer groups.
+//!
+//! The special ID > means that the consumer wants to receive only messages that were never delivered to any other consumer.
+//! Any other ID will have the effect of returning to the consumer the pending entries (delivered but not yet acknowledged by XACK)
+//! with IDs greater than the one provided.
+//!
+//! RESP2 Reply
+//! One of the following:
+//!     Array reply: an array where each element is an array composed of a two elements containing the key name and the entries reported for that key.
+//!     The entries reported are full stream entries, having IDs and the list of all the fields and values.
+//!     Nil reply: if the BLOCK option is given and a timeout occurs, or if there is no stream that can be served.
+//!
+//! RESP3 Reply
+//! One of the following:
+//!     Map reply: A map of key-value elements where each element is composed of the key name and the entries reported for that key.
+//!     Null reply: if the BLOCK option is given and a timeout occurs, or if there is no stream that can be served.
+//!
+//! Note: Use QtRedisStreamEntry::fromReply() to get the list of entries, or QtRedisStreamConsumer for the consumer loop.
+//! Warn: The reply is waited no longer than the read timeout of the connection (30 sec), use blockMSec below it!
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXReadGroup(const QString &group, const QString &consumer, const QStringList &keyList, const QStringList &idList, const int count, const int blockMSec, const bool noAck)
+{
+    return this->redisXReadGroup(group, consumer, toUtf8List(keyList), idList, count, blockMSec, noAck);
+}
+
+//!
+//! \brief Прочитать записи потоков в группе потребителей
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \param keyList Список ключей потоков
+//! \param idList Список идентификаторов (> - новые записи, иначе - ожидающие подтверждения записи потребителя)
+//! \param count Максимальное количество записей каждого потока (-1 - без ограничения)
+//! \param blockMSec Время ожидания записей мсек (-1 - не ожидать, 0 - ожидать бесконечно)
+//! \param noAck Не добавлять записи в список ожидающих подтверждения
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXReadGroup(const QString &group, const QString &consumer, const T &keyList, const QStringList &idList, const int count, const int blockMSec, const bool noAck)
+{
+    if (group.isEmpty() || consumer.isEmpty())
+        return make_error("Invalid group or consumer!");
+
+    if (keyList.isEmpty() || keyList.size() != idList.size())
+        return make_error("Invalid keyList or idList (Empty or size mismatch)!");
+
+    QtRedisCommand command("XREADGROUP");
+    command.reserve(keyList.size() * 2 + 9);
+    command << "GROUP" << group << consumer;
+    if (count > 0)
+        command << "COUNT" << count;
+    if (blockMSec >= 0)
+        command << "BLOCK" << blockMSec;
+    if (noAck)
+        command << "NOACK";
+    command << "STREAMS" << keyList << idList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Подтвердить обработку записей потока в группе потребителей
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param idList Список идентификаторов записей
+//! \return
+//!
+//! Redis command: XACK
+//!
+//! Syntax
+//!
+//! XACK key group id [id ...]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1) for each message ID processed.
+//! ACL categories:
+//!     @write, @stream, @fast
+//!
+//! The XACK command removes one or multiple messages from the Pending Entries List (PEL) of a stream consumer group.
+//! A message is pending, and as such stored inside the PEL, when it was delivered to some consumer,
+//! normally as a side effect of calling XREADGROUP, or when a consumer took ownership of a message calling XCLAIM.
+//!
+//! Examples
+//! redis> XACK mystream mygroup 1526569495631-0
+//! (integer) 1
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: The command returns the number of messages successfully acknowledged.
+//! Certain message IDs may no longer be part of the PEL (for example because they have already been acknowledged),
+//! and XACK will not count them as successfully acknowledged.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAck(const QString &key, const QString &group, const QStringList &idList)
+{
+    return this->redisXAck(key.toUtf8(), group, idList);
+}
+
+//!
+//! \brief Подтвердить обработку записей потока в группе потребителей
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param idList Список идентификаторов записей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAck(const T &key, const QString &group, const QStringList &idList)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (idList.isEmpty())
+        return make_error("Invalid idList (Empty)!");
+
+    QtRedisCommand command("XACK");
+    command.reserve(idList.size() + 2);
+    command << key << group << idList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Создать группу потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param id Идентификатор последней доставленной записи ($ - только новые записи, 0 - все записи)
+//! \param mkStream Создать поток, если он не существует
+//! \return
+//!
+//! Redis command: XGROUP CREATE
+//!
+//! Syntax
+//!
+//! XGROUP CREATE key group <id | $> [MKSTREAM] [ENTRIESREAD entries-read]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! Create a new consumer group uniquely identified by group for the stream stored at key.
+//!
+//! The id argument specifies the last delivered entry in the stream from the new group's perspective.
+//! The special ID $ is the ID of the last entry in the stream, but you can substitute it with any valid ID.
+//! By default, the XGROUP CREATE command expects that the target stream exists, and returns an error when it doesn't.
+//! If a stream does not exist, you can create it automatically with length of 0 by using the optional MKSTREAM subcommand.
+//!
+//! RESP2/RESP3 Reply
+//! Simple string reply: OK.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupCreate(const QString &key, const QString &group, const QString &id, const bool mkStream)
+{
+    return this->redisXGroupCreate(key.toUtf8(), group, id, mkStream);
+}
+
+//!
+//! \brief Создать группу потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param id Идентификатор последней доставленной записи ($ - только новые записи, 0 - все записи)
+//! \param mkStream Создать поток, если он не существует
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupCreate(const T &key, const QString &group, const QString &id, const bool mkStream)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (id.isEmpty())
+        return make_error("Invalid id!");
+
+    QtRedisCommand command("XGROUP");
+    command << "CREATE" << key << group << id;
+    if (mkStream)
+        command << "MKSTREAM";
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Удалить группу потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \return
+//!
+//! Redis command: XGROUP DESTROY
+//!
+//! Syntax
+//!
+//! XGROUP DESTROY key group
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N) where N is the number of entries in the group's pending entries list (PEL).
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! The XGROUP DESTROY command completely destroys a consumer group.
+//! The consumer group will be destroyed even if there are active consumers, and pending messages,
+//! so make sure to call this command only when really needed.
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of destroyed consumer groups, either 0 or 1.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupDestroy(const QString &key, const QString &group)
+{
+    return this->redisXGroupDestroy(key.toUtf8(), group);
+}
+
+//!
+//! \brief Удалить группу потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupDestroy(const T &key, const QString &group)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    return this->redisExecCommand(QtRedisCommand("XGROUP") << "DESTROY" << key << group);
+}
+
+//!
+//! \brief Создать потребителя в группе потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \return
+//!
+//! Redis command: XGROUP CREATECONSUMER
+//!
+//! Syntax
+//!
+//! XGROUP CREATECONSUMER key group consumer
+//!
+//! Available since:
+//!     6.2.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! Create a consumer named consumer in the consumer group group of the stream that's stored at key.
+//! Consumers are also created automatically whenever an operation, such as XREADGROUP, references a consumer that doesn't exist.
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of created consumers, either 0 or 1.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupCreateConsumer(const QString &key, const QString &group, const QString &consumer)
+{
+    return this->redisXGroupCreateConsumer(key.toUtf8(), group, consumer);
+}
+
+//!
+//! \brief Создать потребителя в группе потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupCreateConsumer(const T &key, const QString &group, const QString &consumer)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (consumer.isEmpty())
+        return make_error("Invalid consumer!");
+
+    return this->redisExecCommand(QtRedisCommand("XGROUP") << "CREATECONSUMER" << key << group << consumer);
+}
+
+//!
+//! \brief Удалить потребителя из группы потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \return
+//!
+//! Redis command: XGROUP DELCONSUMER
+//!
+//! Syntax
+//!
+//! XGROUP DELCONSUMER key group consumer
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! The XGROUP DELCONSUMER command deletes a consumer from the consumer group.
+//! Note, however, that any pending messages that the consumer had will become unclaimable after it was deleted.
+//! It is strongly recommended, therefore, that any pending messages are claimed or acknowledged prior to deleting the consumer from the group.
+//!
+//! RESP2/RESP3 Reply
+//! Integer reply: the number of pending messages the consumer had before it was deleted.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupDelConsumer(const QString &key, const QString &group, const QString &consumer)
+{
+    return this->redisXGroupDelConsumer(key.toUtf8(), group, consumer);
+}
+
+//!
+//! \brief Удалить потребителя из группы потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Потребитель
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupDelConsumer(const T &key, const QString &group, const QString &consumer)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (consumer.isEmpty())
+        return make_error("Invalid consumer!");
+
+    return this->redisExecCommand(QtRedisCommand("XGROUP") << "DELCONSUMER" << key << group << consumer);
+}
+
+//!
+//! \brief Задать идентификатор последней доставленной записи группы потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param id Идентификатор записи ($ - последняя запись)
+//! \return
+//!
+//! Redis command: XGROUP SETID
+//!
+//! Syntax
+//!
+//! XGROUP SETID key group <id | $> [ENTRIESREAD entries-read]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @write, @stream, @slow
+//!
+//! Set the last delivered ID for a consumer group.
+//! Normally, a consumer group's last delivered ID is set when the group is created with XGROUP CREATE.
+//! The XGROUP SETID command allows modifying the group's last delivered ID, without having to delete and recreate the group.
+//!
+//! RESP2/RESP3 Reply
+//! Simple string reply: OK on success.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupSetId(const QString &key, const QString &group, const QString &id)
+{
+    return this->redisXGroupSetId(key.toUtf8(), group, id);
+}
+
+//!
+//! \brief Задать идентификатор последней доставленной записи группы потребителей потока
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param id Идентификатор записи ($ - последняя запись)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXGroupSetId(const T &key, const QString &group, const QString &id)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (id.isEmpty())
+        return make_error("Invalid id!");
+
+    return this->redisExecCommand(QtRedisCommand("XGROUP") << "SETID" << key << group << id);
+}
+
+//!
+//! \brief Получить сводку о записях потока, ожидающих подтверждения
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \return
+//!
+//! Redis command: XPENDING
+//!
+//! Syntax
+//!
+//! XPENDING key group [[IDLE min-idle-time] start end count [consumer]]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N) with N being the number of elements returned, so asking for a small fixed number of entries per call is O(1).
+//!     O(M), where M is the total number of entries scanned when used with the IDLE filter.
+//!     When the command returns just the summary and the list of consumers is small, it runs in O(1) time; otherwise, an additional O(N) time for iterating every consumer.
+//! ACL categories:
+//!     @read, @stream, @slow
+//!
+//! Fetching data from a stream via a consumer group, and not acknowledging such data, has the effect of creating pending entries.
+//! The XPENDING command is the interface to inspect the list of pending messages.
+//!
+//! When XPENDING is called with just a key name and a consumer group name, it just outputs a summary about the pending messages in a given consumer group.
+//! In the extended form every pending entry is reported with the ID, the consumer, the idle time in milliseconds and the delivery counter.
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: different data depending on the way XPENDING is called, as explained above.
+//!
+//! History
+//!     Starting with Redis version 6.2.0: Added the IDLE option and exclusive range intervals.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXPending(const QString &key, const QString &group)
+{
+    return this->redisXPending(key.toUtf8(), group);
+}
+
+//!
+//! \brief Получить сводку о записях потока, ожидающих подтверждения
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXPending(const T &key, const QString &group)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    return this->redisExecCommand(QtRedisCommand("XPENDING") << key << group);
+}
+
+//!
+//! \brief Получить список записей потока, ожидающих подтверждения
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param count Максимальное количество записей
+//! \param consumer Потребитель (пустой - все потребители)
+//! \param minIdleMSec Минимальное время простоя записи мсек (-1 - без фильтра)
+//! \return
+//!
+//! Redis command: XPENDING
+//!
+//! Syntax
+//!
+//! XPENDING key group [[IDLE min-idle-time] start end count [consumer]]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(N) with N being the number of elements returned, so asking for a small fixed number of entries per call is O(1).
+//!     O(M), where M is the total number of entries scanned when used with the IDLE filter.
+//!     When the command returns just the summary and the list of consumers is small, it runs in O(1) time; otherwise, an additional O(N) time for iterating every consumer.
+//! ACL categories:
+//!     @read, @stream, @slow
+//!
+//! Fetching data from a stream via a consumer group, and not acknowledging such data, has the effect of creating pending entries.
+//! The XPENDING command is the interface to inspect the list of pending messages.
+//!
+//! When XPENDING is called with just a key name and a consumer group name, it just outputs a summary about the pending messages in a given consumer group.
+//! In the extended form every pending entry is reported with the ID, the consumer, the idle time in milliseconds and the delivery counter.
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: different data depending on the way XPENDING is called, as explained above.
+//!
+//! History
+//!     Starting with Redis version 6.2.0: Added the IDLE option and exclusive range intervals.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXPending(const QString &key, const QString &group, const QString &start, const QString &end, const int count, const QString &consumer, const qlonglong minIdleMSec)
+{
+    return this->redisXPending(key.toUtf8(), group, start, end, count, consumer, minIdleMSec);
+}
+
+//!
+//! \brief Получить список записей потока, ожидающих подтверждения
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param start Начальный идентификатор (- - минимальный)
+//! \param end Конечный идентификатор (+ - максимальный)
+//! \param count Максимальное количество записей
+//! \param consumer Потребитель (пустой - все потребители)
+//! \param minIdleMSec Минимальное время простоя записи мсек (-1 - без фильтра)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXPending(const T &key, const QString &group, const QString &start, const QString &end, const int count, const QString &consumer, const qlonglong minIdleMSec)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (start.isEmpty() || end.isEmpty() || count <= 0)
+        return make_error("Invalid range or count!");
+
+    QtRedisCommand command("XPENDING");
+    command << key << group;
+    if (minIdleMSec >= 0)
+        command << "IDLE" << minIdleMSec;
+    command << start << end << count;
+    if (!consumer.isEmpty())
+        command << consumer;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Передать записи потока, ожидающие подтверждения, другому потребителю
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Новый потребитель
+//! \param minIdleMSec Минимальное время простоя записи мсек
+//! \param idList Список идентификаторов записей
+//! \param justId Вернуть только идентификаторы записей
+//! \return
+//!
+//! Redis command: XCLAIM
+//!
+//! Syntax
+//!
+//! XCLAIM key group consumer min-idle-time id [id ...] [IDLE ms] [TIME unix-time-milliseconds] [RETRYCOUNT count] [FORCE] [JUSTID] [LASTID lastid]
+//!
+//! Available since:
+//!     5.0.0
+//! Time complexity:
+//!     O(log N) with N being the number of messages in the PEL of the consumer group.
+//! ACL categories:
+//!     @write, @stream, @fast
+//!
+//! In the context of a stream consumer group, this command changes the ownership of a pending message,
+//! so that the new owner is the consumer specified as the command argument.
+//! The message is claimed only if its idle time is greater than the minimum idle time specified when calling XCLAIM.
+//!
+//! RESP2/RESP3 Reply
+//! Any of the following:
+//!     Array reply: when the JUSTID option is specified, an array of IDs of messages successfully claimed.
+//!     Array reply: an array of stream entries, each of which contains an array of two elements, the entry ID and the entry data itself.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXClaim(const QString &key, const QString &group, const QString &consumer, const qlonglong minIdleMSec, const QStringList &idList, const bool justId)
+{
+    return this->redisXClaim(key.toUtf8(), group, consumer, minIdleMSec, idList, justId);
+}
+
+//!
+//! \brief Передать записи потока, ожидающие подтверждения, другому потребителю
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Новый потребитель
+//! \param minIdleMSec Минимальное время простоя записи мсек
+//! \param idList Список идентификаторов записей
+//! \param justId Вернуть только идентификаторы записей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXClaim(const T &key, const QString &group, const QString &consumer, const qlonglong minIdleMSec, const QStringList &idList, const bool justId)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (consumer.isEmpty())
+        return make_error("Invalid consumer!");
+
+    if (idList.isEmpty())
+        return make_error("Invalid idList (Empty)!");
+
+    if (minIdleMSec < 0)
+        return make_error("Invalid minIdleMSec!");
+
+    QtRedisCommand command("XCLAIM");
+    command.reserve(idList.size() + 5);
+    command << key << group << consumer << minIdleMSec << idList;
+    if (justId)
+        command << "JUSTID";
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Передать другому потребителю записи потока, простаивающие дольше заданного времени
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Новый потребитель
+//! \param minIdleMSec Минимальное время простоя записи мсек
+//! \param start Начальный идентификатор (курсор, 0-0 - начало)
+//! \param count Максимальное количество записей (-1 - по умолчанию сервера, 100)
+//! \param justId Вернуть только идентификаторы записей
+//! \return
+//!
+//! Redis command: XAUTOCLAIM
+//!
+//! Syntax
+//!
+//! XAUTOCLAIM key group consumer min-idle-time start [COUNT count] [JUSTID]
+//!
+//! Available since:
+//!     6.2.0
+//! Time complexity:
+//!     O(1) if COUNT is small.
+//! ACL categories:
+//!     @write, @stream, @fast
+//!
+//! This command transfers ownership of pending stream entries that match the specified criteria.
+//! Conceptually, XAUTOCLAIM is equivalent to calling XPENDING and then XCLAIM, but provides a more
+//! straightforward way to deal with message delivery failures via SCAN-like semantics.
+//!
+//! The command returns the cursor to use as the start argument for the next call (0-0 when the scan of the PEL is complete).
+//!
+//! RESP2/RESP3 Reply
+//! Array reply, specifically, an array with three elements:
+//!     A stream ID to be used as the start argument for the next call to XAUTOCLAIM.
+//!     An Array reply containing all the successfully claimed messages in the same format as XRANGE.
+//!     An Array reply containing message IDs that no longer exist in the stream, and were deleted from the PEL in which they were found.
+//!
+//! History
+//!     Starting with Redis version 7.0.0: Added an element to the reply array, containing deleted entries the command cleared from the PEL
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAutoClaim(const QString &key, const QString &group, const QString &consumer, const qlonglong minIdleMSec, const QString &start, const int count, const bool justId)
+{
+    return this->redisXAutoClaim(key.toUtf8(), group, consumer, minIdleMSec, start, count, justId);
+}
+
+//!
+//! \brief Передать другому потребителю записи потока, простаивающие дольше заданного времени
+//! \param key Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Новый потребитель
+//! \param minIdleMSec Минимальное время простоя записи мсек
+//! \param start Начальный идентификатор (курсор, 0-0 - начало)
+//! \param count Максимальное количество записей (-1 - по умолчанию сервера, 100)
+//! \param justId Вернуть только идентификаторы записей
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisXAutoClaim(const T &key, const QString &group, const QString &consumer, const qlonglong minIdleMSec, const QString &start, const int count, const bool justId)
+{
+    if (key.isEmpty())
+        return make_error("Invalid key!");
+
+    if (group.isEmpty())
+        return make_error("Invalid group!");
+
+    if (consumer.isEmpty())
+        return make_error("Invalid consumer!");
+
+    if (minIdleMSec < 0 || start.isEmpty())
+        return make_error("Invalid minIdleMSec or start!");
+
+    QtRedisCommand command("XAUTOCLAIM");
+    command << key << group << consumer << minIdleMSec << start;
+    if (count > 0)
+        command << "COUNT" << count;
+    if (justId)
+        command << "JUSTID";
+    return this->redisExecCommand(command);
+}
+
+
+
+// ------------------------------------------------------------------------
+// -- SCRIPTING COMMANDS --------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Выполнить Lua-скрипт
+//! \param script Текст скрипта
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! Redis command: EVAL
+//!
+//! Syntax
+//!
+//! EVAL script numkeys [key [key ...]] [arg [arg ...]]
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     Depends on the script that is executed.
+//! ACL categories:
+//!     @slow, @scripting
+//!
+//! Invoke the execution of a server-side Lua script.
+//!
+//! The first argument is the script's source code. Scripts are written in Lua and executed by the embedded Lua 5.1 interpreter in Redis.
+//!
+//! The second argument is the number of input key name arguments, followed by all the keys accessed by the script.
+//! These names of input keys are available to the script as the KEYS global runtime variable.
+//! Any additional input arguments should not represent names of keys.
+//!
+//! Important: to ensure the correct execution of scripts, both in standalone and clustered deployments,
+//! all names of keys that a script accesses must be explicitly provided as input key arguments.
+//! The script should only access keys whose names are given as input arguments.
+//!
+//! Examples
+//!
+//! redis> EVAL "return ARGV[1]" 0 hello
+//! "hello"
+//!
+//! RESP2/RESP3 Reply
+//! The return value depends on the script that was executed.
+//!
+//! Note: The script body is sent with every call, use redisEvalScript() for the scripts called repeatedly.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEval(const QString &script, const QStringList &keyList, const QStringList &argList)
+{
+    return this->redisEval(script, toUtf8List(keyList), toUtf8List(argList));
+}
+
+//!
+//! \brief Выполнить Lua-скрипт из кэша сервера по SHA1-дайджесту
+//! \param sha1 SHA1-дайджест скрипта
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! Redis command: EVALSHA
+//!
+//! Syntax
+//!
+//! EVALSHA sha1 numkeys [key [key ...]] [arg [arg ...]]
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     Depends on the script that is executed.
+//! ACL categories:
+//!     @slow, @scripting
+//!
+//! Evaluate a script from the server's cache by its SHA1 digest.
+//!
+//! The server caches scripts by using the SCRIPT LOAD command. The command is otherwise identical to EVAL.
+//!
+//! RESP2/RESP3 Reply
+//! The return value depends on the script that was executed.
+//! If the script is not in the script cache, the error NOSCRIPT is returned.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEvalSha(const QString &sha1, const QStringList &keyList, const QStringList &argList)
+{
+    return this->redisEvalSha(sha1, toUtf8List(keyList), toUtf8List(argList));
+}
+
+//!
+//! \brief Выполнить Lua-скрипт с использованием кэша скриптов сервера
+//! \param script Скрипт
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! The script is always called by EVALSHA, the body is sent only when the server does not have it:
+//!     QtRedisClient - on the NOSCRIPT error the command is repeated by EVAL,
+//!                     the script is registered and loaded again after the reconnect (see QtRedisClient::redisRegisterScript());
+//!     QtRedisPipeline, QtRedisTransaction - the queued scripts are checked by SCRIPT EXISTS
+//!                     and loaded by SCRIPT LOAD before the commands are sent.
+//!
+//! Note: In QtRedisTransaction without the pipeline mode the command is queued by EVAL after MULTI is sent.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEvalScript(const QtRedisScript &script, const QStringList &keyList, const QStringList &argList)
+{
+    return this->redisEvalScript(script, toUtf8List(keyList), toUtf8List(argList));
+}
+
+//!
+//! \brief Загрузить Lua-скрипт в кэш скриптов сервера
+//! \param script Текст скрипта
+//! \return
+//!
+//! Redis command: SCRIPT LOAD
+//!
+//! Syntax
+//!
+//! SCRIPT LOAD script
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     O(N) with N being the length in bytes of the script body.
+//! ACL categories:
+//!     @slow, @scripting
+//!
+//! Load a script into the scripts cache, without executing it.
+//! After the specified command is loaded into the script cache it will be callable using EVALSHA with the correct SHA1 digest of the script,
+//! exactly like after the first successful invocation of EVAL.
+//!
+//! The script is guaranteed to stay in the script cache forever (unless SCRIPT FLUSH is called).
+//!
+//! The command works in the same way even if the script was already present in the script cache.
+//!
+//! RESP2/RESP3 Reply
+//! Bulk string reply: the SHA1 digest of the script added into the script cache.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisScriptLoad(const QString &script)
+{
+    if (script.isEmpty())
+        return make_error("Invalid script!");
+
+    return this->redisExecCommand(QtRedisCommand("SCRIPT") << "LOAD" << script);
+}
+
+//!
+//! \brief Проверить наличие Lua-скриптов в кэше скриптов сервера
+//! \param sha1List Список SHA1-дайджестов скриптов
+//! \return
+//!
+//! Redis command: SCRIPT EXISTS
+//!
+//! Syntax
+//!
+//! SCRIPT EXISTS sha1 [sha1 ...]
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     O(N) with N being the number of scripts to check (so checking a single script is an O(1) operation).
+//! ACL categories:
+//!     @slow, @scripting
+//!
+//! Returns information about the existence of the scripts in the script cache.
+//!
+//! This command accepts one or more SHA1 digests and returns a list of ones or zeros to signal
+//! if the scripts are already defined or not inside the script cache.
+//! This can be useful before a pipelining operation to ensure that scripts are loaded (and if not, to load them using SCRIPT LOAD)
+//! so that the pipelining operation can be performed solely using EVALSHA instead of EVAL to save bandwidth.
+//!
+//! RESP2/RESP3 Reply
+//! Array reply: an array of integers that correspond to the specified SHA1 digest arguments.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisScriptExists(const QStringList &sha1List)
+{
+    if (sha1List.isEmpty())
+        return make_error("Invalid sha1List (Empty)!");
+
+    return this->redisExecCommand(QtRedisCommand("SCRIPT") << "EXISTS" << sha1List);
+}
+
+//!
+//! \brief Очистить кэш скриптов сервера
+//! \param async Асинхронная очистка
+//! \return
+//!
+//! Redis command: SCRIPT FLUSH
+//!
+//! Syntax
+//!
+//! SCRIPT FLUSH [ASYNC | SYNC]
+//!
+//! Available since:
+//!     2.6.0
+//! Time complexity:
+//!     O(N) with N being the number of scripts in cache
+//! ACL categories:
+//!     @slow, @scripting
+//!
+//! Flush the Lua scripts cache.
+//!
+//! By default, SCRIPT FLUSH will synchronously flush the cache. Starting with Redis 6.2,
+//! setting the lazyfree-lazy-user-flush configuration directive to "yes" changes the default flush mode to asynchronous.
+//!
+//! RESP2/RESP3 Reply
+//! Simple string reply: OK.
+//!
+//! History
+//!     Starting with Redis version 6.2.0: Added the ASYNC and SYNC flushing mode modifiers.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisScriptFlush(const bool async)
+{
+    QtRedisCommand command("SCRIPT");
+    command << "FLUSH";
+    if (async)
+        command << "ASYNC";
+    return this->redisExecCommand(command);
+}
+
+
+// ------------------------------------------------------------------------
+// -- SCRIPTING COMMANDS (QByteArray) -------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Выполнить Lua-скрипт
+//! \param script Текст скрипта
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEval(const QString &script, const T &keyList, const QList<QByteArray> &argList)
+{
+    if (script.isEmpty())
+        return make_error("Invalid script!");
+
+    QtRedisCommand command("EVAL");
+    command.reserve(keyList.size() + argList.size() + 2);
+    command << script << keyList.size() << keyList << argList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Выполнить Lua-скрипт из кэша сервера по SHA1-дайджесту
+//! \param sha1 SHA1-дайджест скрипта
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEvalSha(const QString &sha1, const T &keyList, const QList<QByteArray> &argList)
+{
+    if (sha1.isEmpty())
+        return make_error("Invalid sha1!");
+
+    QtRedisCommand command("EVALSHA");
+    command.reserve(keyList.size() + argList.size() + 2);
+    command << sha1 << keyList.size() << keyList << argList;
+    return this->redisExecCommand(command);
+}
+
+//!
+//! \brief Выполнить Lua-скрипт с использованием кэша скриптов сервера
+//! \param script Скрипт
+//! \param keyList Список ключей (KEYS)
+//! \param argList Список аргументов (ARGV)
+//! \return
+//!
+//! Note: Binary-safe overload (keys and values are passed as is, without UTF-8 conversion).
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+template<typename T, typename>
+__RESULT_IMPL QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::redisEvalScript(const QtRedisScript &script, const T &keyList, const QList<QByteArray> &argList)
+{
+    QMutexLocker lock(&_mutex);
+    if (!script.isValid())
+        return make_error("Invalid script!");
+
+    return as_CLIENT_IMPL_ptr()->processScript(script, keyList, argList);
+}
+
+
+// --- protected ---
+
+//!
+//! \brief Установить последнюю ошибку
+//! \param error Ошибка
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+void QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::setLastError_safe(const QString &error)
+{
+    QMutexLocker lock(&_mutexErr);
+    if (!_isLastErrorPerThread) {
+        _lastError = error;
+        return;
+    }
+    if (error.isEmpty())
+        _lastErrorPerThread.remove(QThread::currentThreadId());
+    else
+        _lastErrorPerThread.insert(QThread::currentThreadId(), error);
+}
+
+//!
+//! \brief Очистить посленюю ошибку
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+void QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::clearLastError_safe()
+{
+    QMutexLocker lock(&_mutexErr);
+    if (_isLastErrorPerThread)
+        _lastErrorPerThread.remove(QThread::currentThreadId());
+    else
+        _lastError.clear();
+}
+
+//!
+//! \brief Хранить сообщение об ошибке отдельно для каждого потока
+//! \param enable Флаг
+//!
+//! Used when the commands of the concurrent callers are executed without the common lock
+//! (auto-pipelining): each thread sees the error of its own last command.
+//!
+//! Note: The stored errors are cleared when the mode is changed.
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+void QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::setLastErrorPerThread_safe(const bool enable)
+{
+    QMutexLocker lock(&_mutexErr);
+    if (_isLastErrorPerThread == enable)
+        return;
+
+    _isLastErrorPerThread = enable;
+    _lastError.clear();
+    _lastErrorPerThread.clear();
+}
+
+//!
+//! \brief Преобразовать список строк в список QByteArray (UTF-8)
+//! \param list Список строк
+//! \return
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+QList<QByteArray> QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::toUtf8List(const QStringList &list)
+{
+    QList<QByteArray> result;
+    result.reserve(list.size());
+    for (const QString &str : list)
+        result.append(str.toUtf8());
+    return result;
+}
+
+//!
+//! \brief Преобразовать словарь строк в словарь QByteArray (UTF-8)
+//! \param map Словарь строк
+//! \return
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+QMap<QByteArray, QByteArray> QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::toUtf8Map(const QMap<QString, QString> &map)
+{
+    QMap<QByteArray, QByteArray> result;
+    for (auto i = map.constBegin(); i != map.constEnd(); ++i)
+        result.insert(i.key().toUtf8(), i.value().toUtf8());
+    return result;
+}
+
+//!
+//! \brief Преобразовать значения словаря в QByteArray (UTF-8)
+//! \param map Словарь строк
+//! \return
+//!
+template<typename __CLIENT_IMPL, typename __RESULT_IMPL>
+QMultiMap<QString, QByteArray> QtRedisBase<__CLIENT_IMPL, __RESULT_IMPL>::toUtf8MultiMap(const QMultiMap<QString, QString> &map)
+{
+    QMultiMap<QString, QByteArray> result;
+    for (auto i = map.constBegin(); i != map.constEnd(); ++i)
+        result.insert(i.key(), i.value().toUtf8());
+    return result;
 }
 
 // --- private ---
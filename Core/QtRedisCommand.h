@@ -1,16 +1,25 @@
 #ifndef QTREDISCOMMAND_H
 #define QTREDISCOMMAND_H
 
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 #include <QByteArray>
 #include <QString>
 #include <QList>
 #include <QStringList>
+#include <QLocale>
 
 //!
 //! \file QtRedisCommand.h
 //! \class QtRedisCommand
 //! \brief Класс, описывающий команду для Redis-a
 //!
+//! Arguments are appended as is (binary-safe), without formatting and splitting the string:
+//!
+//!     QtRedisCommand("SET") << key << value << "EX" << 60;
+//!
 class QtRedisCommand
 {
 public:
@@ -49,6 +58,19 @@ public:
         return *this;
     }
 
+    QtRedisCommand(QtRedisCommand &&object) noexcept
+        : _command(std::move(object._command))
+        , _commandArgv(std::move(object._commandArgv))
+    {}
+
+    QtRedisCommand& operator=(QtRedisCommand &&object) noexcept {
+        if (this == &object)
+            return *this;
+        _command = std::move(object._command);
+        _commandArgv = std::move(object._commandArgv);
+        return *this;
+    }
+
     //!
     //! \brief Команда
     //! \return
@@ -83,6 +105,108 @@ public:
         return _commandArgv.size() + 1;
     }
 
+    //!
+    //! \brief Зарезервировать место под аргументы команды
+    //! \param size Количество аргументов
+    //!
+    void reserve(const int size) {
+        _commandArgv.reserve(size);
+    }
+
+    //!
+    //! \brief Добавить аргумент команды
+    //! \param arg Аргумент
+    //! \return
+    //!
+    QtRedisCommand &operator<<(const QByteArray &arg) {
+        _commandArgv.append(arg);
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить аргумент команды
+    //! \param arg Аргумент (перемещается)
+    //! \return
+    //!
+    QtRedisCommand &operator<<(QByteArray &&arg) {
+        _commandArgv.append(std::move(arg));
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить аргумент команды
+    //! \param arg Аргумент (строка в кодировке UTF-8)
+    //! \return
+    //!
+    QtRedisCommand &operator<<(const char *arg) {
+        _commandArgv.append(QByteArray(arg));
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить аргумент команды
+    //! \param arg Аргумент (кодируется в UTF-8)
+    //! \return
+    //!
+    QtRedisCommand &operator<<(const QString &arg) {
+        _commandArgv.append(arg.toUtf8());
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить аргументы команды
+    //! \param argList Список аргументов
+    //! \return
+    //!
+    QtRedisCommand &operator<<(const QList<QByteArray> &argList) {
+        _commandArgv.append(argList);
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить аргументы команды
+    //! \param argList Список аргументов (кодируются в UTF-8)
+    //! \return
+    //!
+    QtRedisCommand &operator<<(const QStringList &argList) {
+        _commandArgv.reserve(_commandArgv.size() + argList.size());
+        for (const QString &arg : argList)
+            _commandArgv.append(arg.toUtf8());
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить целочисленный аргумент команды
+    //! \param arg Аргумент
+    //! \return
+    //!
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value
+                            && !std::is_same<T, char>::value, QtRedisCommand&>::type
+    operator<<(const T arg) {
+        if (std::is_signed<T>::value)
+            _commandArgv.append(QByteArray::number(static_cast<qlonglong>(arg)));
+        else
+            _commandArgv.append(QByteArray::number(static_cast<qulonglong>(arg)));
+        return *this;
+    }
+
+    //!
+    //! \brief Добавить вещественный аргумент команды
+    //! \param arg Аргумент
+    //! \return
+    //!
+    //! Note: double is written in the shortest form that restores the value exactly,
+    //! float - with std::numeric_limits<float>::digits10 significant digits (0.1f is written as "0.1").
+    //!
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, QtRedisCommand&>::type
+    operator<<(const T arg) {
+        const int precision = std::is_same<T, float>::value ? std::numeric_limits<float>::digits10
+                                                            : static_cast<int>(QLocale::FloatingPointShortest);
+        _commandArgv.append(QByteArray::number(static_cast<double>(arg), 'g', precision));
+        return *this;
+    }
 
     // ------------------------------------------------------------------------
     // -- TOOLS COMMANDS ------------------------------------------------------
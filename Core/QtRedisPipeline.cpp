@@ -1,6 +1,8 @@
 #include "QtRedisPipeline.h"
 #include <utility>
 
+#include "NetworkLayer/QtRedisParser.h"
+
 //!
 //! \brief Конструктор класса
 //! \param transporter Класс транспорта для работы с Redis
@@ -18,15 +20,194 @@ QtRedisPipeline::~QtRedisPipeline()
 {
 }
 
+//!
+//! \brief Включить (выключить) потоковый режим
+//! \param handler Функция обработки ответов (пустая функция выключает режим)
+//! \param flushCommands Количество команд, после которого они отправляются
+//! \param flushBytes Размер команд (байт), после которого они отправляются
+//! \param maxInFlight Максимальное количество команд, ожидающих ответа
+//!
+//! In the streaming mode the queued commands are sent every flushCommands commands or flushBytes bytes,
+//! the replies are read and passed to the handler while the next commands are queued.
+//! If more than maxInFlight commands wait for the reply, the queueing command waits for the replies.
+//! exec() sends the rest of the commands and waits for all replies (use execToBool()).
+//!
+//! Note: The handler is called with the pipeline locked, it must not use this pipeline.
+//! Warn: The commands already sent can not be discarded by discard()!
+//!
+void QtRedisPipeline::setStreaming(const ReplyHandler &handler,
+                                   const int flushCommands,
+                                   const int flushBytes,
+                                   const int maxInFlight)
+{
+    QMutexLocker lock(&_mutex);
+    if (_streamRequest)
+        this->flushStream_unsafe(0);
+    _streamHandler = handler;
+    _streamFlushCommands = qMax(flushCommands, 1);
+    _streamFlushBytes = qMax(flushBytes, 1);
+    _streamMaxInFlight = qMax(maxInFlight, 0);
+    this->resetStream_unsafe();
+    _streamDataSize = 0;
+    _commandData.resize(0);
+    for (const QtRedisCommand &command : _commandList) {
+        if (_streamHandler)
+            _streamDataSize += QtRedisParser::rawDataSize(command);
+        else
+            QtRedisParser::appendRawData(_commandData, command);
+    }
+}
+
+//!
+//! \brief Зарезервировать место под команды
+//! \param commandCount Количество команд
+//! \param dataSize Размер закодированных команд (байт)
+//!
+//! The reserved memory is kept by exec() and discard(), so the pipeline that is filled again
+//! in a loop does not allocate memory for the queue and the encoded commands.
+//!
+void QtRedisPipeline::reserve(const int commandCount, const int dataSize)
+{
+    QMutexLocker lock(&_mutex);
+    _commandList.reserve(commandCount);
+    if (dataSize > 0)
+        _commandData.reserve(dataSize);
+}
+
+//!
+//! \brief Включен ли потоковый режим
+//! \return
+//!
+bool QtRedisPipeline::isStreaming()
+{
+    QMutexLocker lock(&_mutex);
+    return static_cast<bool>(_streamHandler);
+}
+
 //!
 //! \brief Отправить все команды одним пакетом
 //! \return
 //!
 //! Send all commands to Redis for execution.
+//! In the streaming mode the rest of the commands is sent, the replies are passed to the handler
+//! and the empty reply is returned.
+//!
+//! Note: The scripts of the queued commands missing in the script cache of the server are loaded first (see QtRedisTransporter::loadScripts()).
 //!
 QtRedisReply QtRedisPipeline::exec()
 {
     QMutexLocker lock(&_mutex);
+    return this->exec_unsafe();
+}
+
+//!
+//! \brief Отправить все команды одним пакетом
+//! \return
+//!
+//! Send all commands to Redis for execution.
+//!
+//! Note: This is a wrapper over function QtRedisPipeline::exec()
+//!
+bool QtRedisPipeline::execToBool()
+{
+    this->exec();
+    return !this->hasLastError();
+}
+
+//!
+//! \brief Отправить все команды одним пакетом и получить результат по каждой команде
+//! \return
+//!
+//! Send all commands to Redis for execution.
+//! The replies are indexed like the queued commands, the failed commands are listed by QtRedisPipelineResult::failedIndices()
+//! and can be queued again by QtRedisPipelineResult::failedCommands().
+//! The last error is set to the connection error or to the error of the first failed command.
+//!
+//! Note: In the streaming mode the replies are passed to the handler and the empty result is returned.
+//!
+QtRedisPipelineResult QtRedisPipeline::execToResult()
+{
+    QMutexLocker lock(&_mutex);
+    if (_streamHandler) {
+        this->exec_unsafe();
+        return QtRedisPipelineResult();
+    }
+    const QList<QtRedisCommand> commandList = _commandList;
+    bool isOk = false;
+    const QtRedisReply reply = this->exec_unsafe(&isOk);
+    QVector<QtRedisReply> replyList;
+    if (isOk) {
+        if (commandList.size() == 1)
+            replyList.append(reply);
+        else
+            replyList = reply.arrayValue_ref();
+    }
+    const QtRedisPipelineResult result(commandList, replyList, (isOk ? QString() : this->lastError()));
+    if (isOk && !result.failedIndices().isEmpty())
+        this->setLastError_safe(result.error(result.failedIndices().first()));
+    return result;
+}
+
+//!
+//! \brief Отменить все внесенные изменения
+//!
+//! Note: This method clears the entire command queue.
+//! In the streaming mode the replies of the commands already sent are still passed to the handler.
+//!
+void QtRedisPipeline::discard()
+{
+    QMutexLocker lock(&_mutex);
+    this->clearCommands_unsafe();
+    _scriptList.clear();
+    _streamDataSize = 0;
+    if (_streamRequest)
+        this->flushStream_unsafe(0); // the replies of the commands already sent are skipped
+    this->resetStream_unsafe();
+}
+
+//!
+//! \brief Выполнить команду
+//! \param command Команда
+//! \return
+//!
+//! The command is encoded when it is queued, so exec() does not encode the commands.
+//!
+bool QtRedisPipeline::processCommand(const QtRedisCommand &command)
+{
+    if (!_streamHandler) {
+        QtRedisParser::appendRawData(_commandData, command); // encoded once, exec() sends the data as is
+        _commandList.append(command);
+        return true;
+    }
+    _streamDataSize += QtRedisParser::rawDataSize(command);
+    _commandList.append(command);
+    if (_commandList.size() < _streamFlushCommands
+        && _streamDataSize < _streamFlushBytes)
+        return true;
+    return this->flushStream_unsafe(_streamMaxInFlight);
+}
+
+//!
+//! \brief Отправить все команды одним пакетом
+//! \param ok Получены ли ответы на все команды
+//! \return
+//!
+//! Note: The scripts of the queued commands missing in the script cache of the server are loaded first (see QtRedisTransporter::loadScripts()).
+//!
+QtRedisReply QtRedisPipeline::exec_unsafe(bool *ok)
+{
+    if (ok)
+        *ok = false;
+    if (_streamHandler) {
+        if (_commandList.isEmpty() && !_streamRequest) {
+            this->setLastError_safe("Commands list is Empty!");
+            return QtRedisReply();
+        }
+        this->clearLastError_safe();
+        this->flushStream_unsafe(0);
+        this->resetStream_unsafe();
+        return QtRedisReply();
+    }
     if (_commandList.isEmpty()) {
         this->setLastError_safe("Commands list is Empty!");
         return QtRedisReply();
@@ -41,47 +222,103 @@ QtRedisReply QtRedisPipeline::exec()
     }
     this->clearLastError_safe();
     QString error;
-    bool isOk = false;
-    const QtRedisReply reply = _transporter->sendCommands(_commandList, error, &isOk);
+    if (!_transporter->loadScripts(_scriptList, error)) {
+        this->setLastError_safe(error);
+        this->clearCommands_unsafe();
+        _scriptList.clear();
+        return QtRedisReply();
+    }
+    const QtRedisReply reply = _transporter->sendCommandsEncoded(_commandList, _commandData, error, ok);
     if (!error.isEmpty())
         this->setLastError_safe(error);
-    _commandList.clear();
+    this->clearCommands_unsafe();
+    _scriptList.clear();
     return reply;
 }
 
 //!
-//! \brief Отправить все команды одним пакетом
+//! \brief Выполнить скрипт
+//! \param script Скрипт
+//! \param keyList Список ключей
+//! \param argList Список аргументов
 //! \return
 //!
-//! Send all commands to Redis for execution.
+//! The command is queued by EVALSHA, the script is loaded by exec() before the commands are sent.
 //!
-//! Note: This is a wrapper over function QtRedisPipeline::exec()
-//!
-bool QtRedisPipeline::execToBool()
+bool QtRedisPipeline::processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList)
 {
-    this->exec();
-    return !this->hasLastError();
+    if (!_scriptList.contains(script))
+        _scriptList.append(script);
+    return this->processCommand(script.evalShaCommand(keyList, argList));
 }
 
 //!
-//! \brief Отменить все внесенные изменения
+//! \brief Очистить список команд
 //!
-//! Note: This method clears the entire command queue.
+//! Note: The reserved memory is kept if the list and the data are not shared (see reserve()).
 //!
-void QtRedisPipeline::discard()
+void QtRedisPipeline::clearCommands_unsafe()
 {
-    QMutexLocker lock(&_mutex);
-    _commandList.clear();
+    if (_commandList.isDetached())
+        _commandList.erase(_commandList.begin(), _commandList.end());
+    else
+        _commandList.clear(); // the copy is kept by the caller, erase() would detach it
+    _commandData.resize(0);
 }
 
 //!
-//! \brief Выполнить команду
-//! \param command Команда
+//! \brief Отправить накопленные команды потоковой отправки и передать полученные ответы
+//! \param maxInFlight Максимальное количество команд, ожидающих ответа, после возврата
 //! \return
 //!
-bool QtRedisPipeline::processCommand(const QtRedisCommand &command)
+bool QtRedisPipeline::flushStream_unsafe(const int maxInFlight)
 {
-    _commandList.append(std::move(command));
+    QList<QtRedisCommand> commandList;
+    commandList.swap(_commandList);
+    _streamDataSize = 0;
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        _scriptList.clear();
+        return false;
+    }
+    QString error;
+    if (!commandList.isEmpty()) {
+        if (!_transporter->isConnected()) {
+            this->setLastError_safe("Client is not connected!");
+            _scriptList.clear();
+            return false;
+        }
+        if (!_transporter->loadScripts(_scriptList, error)) {
+            this->setLastError_safe(error);
+            _scriptList.clear();
+            return false;
+        }
+        _scriptList.clear();
+    }
+    if (!_streamRequest)
+        _streamRequest = std::make_shared<QtRedisTransporter::StreamingState>();
+    QList<QtRedisReply> replyList;
+    const bool isOk = _transporter->sendCommandsStreamed(_streamRequest, commandList, maxInFlight, replyList, error);
+    for (const QtRedisReply &reply : replyList) {
+        if (_streamHandler)
+            _streamHandler(_streamIndex, reply);
+        _streamIndex++;
+    }
+    if (!isOk) {
+        this->setLastError_safe(error);
+        this->resetStream_unsafe();
+        return false;
+    }
     return true;
 }
 
+//!
+//! \brief Завершить текущую потоковую отправку
+//!
+//! Note: The replies of the commands still in flight are dropped by the transporter.
+//!
+void QtRedisPipeline::resetStream_unsafe()
+{
+    _streamRequest.reset();
+    _streamIndex = 0;
+}
@@ -2,8 +2,10 @@
 #define QTREDISPIPELINE_H
 
 #include <memory>
+#include <functional>
 
 #include "QtRedisBase.h"
+#include "QtRedisPipelineResult.h"
 #include "NetworkLayer/QtRedisTransporter.h"
 
 //!
@@ -13,17 +15,33 @@
 //!
 //! Документация по командам: https://redis.io/docs/latest/commands/
 //!
+//! Note: In the streaming mode (see setStreaming()) the commands are sent by chunks while they are queued
+//! and the replies are passed to the handler, so the memory does not grow with the number of the commands.
+//!
 class QtRedisPipeline : public QtRedisBase<QtRedisPipeline, bool>
 {
     friend class QtRedisBase<QtRedisPipeline, bool>;
 
 public:
+    //!
+    //! \brief Функция обработки ответа команды в потоковом режиме
+    //! \param index Порядковый номер команды (с 0, с момента включения режима или последнего exec())
+    //! \param reply Ответ от сервера
+    //!
+    typedef std::function<void(const int index, const QtRedisReply &reply)> ReplyHandler;
+
     QtRedisPipeline(std::shared_ptr<QtRedisTransporter> transporter);
     ~QtRedisPipeline();
 
     QtRedisPipeline(const QtRedisPipeline &object)
         : _transporter(object._transporter)
         , _commandList(object._commandList)
+        , _commandData(object._commandData)
+        , _scriptList(object._scriptList)
+        , _streamHandler(object._streamHandler)
+        , _streamFlushCommands(object._streamFlushCommands)
+        , _streamFlushBytes(object._streamFlushBytes)
+        , _streamMaxInFlight(object._streamMaxInFlight)
     {}
 
     QtRedisPipeline& operator=(const QtRedisPipeline &object) {
@@ -31,19 +49,85 @@ public:
             return *this;
         _transporter = object._transporter;
         _commandList = object._commandList;
+        _commandData = object._commandData;
+        _scriptList = object._scriptList;
+        _streamHandler = object._streamHandler;
+        _streamFlushCommands = object._streamFlushCommands;
+        _streamFlushBytes = object._streamFlushBytes;
+        _streamMaxInFlight = object._streamMaxInFlight;
+        _streamRequest.reset();
+        _streamDataSize = 0;
+        _streamIndex = 0;
+        return *this;
+    }
+
+    QtRedisPipeline(QtRedisPipeline &&object) noexcept
+        : _transporter(std::move(object._transporter))
+        , _commandList(std::move(object._commandList))
+        , _commandData(std::move(object._commandData))
+        , _scriptList(std::move(object._scriptList))
+        , _streamHandler(std::move(object._streamHandler))
+        , _streamFlushCommands(object._streamFlushCommands)
+        , _streamFlushBytes(object._streamFlushBytes)
+        , _streamMaxInFlight(object._streamMaxInFlight)
+        , _streamRequest(std::move(object._streamRequest))
+        , _streamDataSize(object._streamDataSize)
+        , _streamIndex(object._streamIndex)
+    {}
+
+    QtRedisPipeline& operator=(QtRedisPipeline &&object) noexcept {
+        if (this == &object)
+            return *this;
+        _transporter = std::move(object._transporter);
+        _commandList = std::move(object._commandList);
+        _commandData = std::move(object._commandData);
+        _scriptList = std::move(object._scriptList);
+        _streamHandler = std::move(object._streamHandler);
+        _streamFlushCommands = object._streamFlushCommands;
+        _streamFlushBytes = object._streamFlushBytes;
+        _streamMaxInFlight = object._streamMaxInFlight;
+        _streamRequest = std::move(object._streamRequest);
+        _streamDataSize = object._streamDataSize;
+        _streamIndex = object._streamIndex;
         return *this;
     }
 
+    void reserve(const int commandCount, const int dataSize = 0);
+
+    void setStreaming(const ReplyHandler &handler,
+                      const int flushCommands = 1000,
+                      const int flushBytes = 1048576,
+                      const int maxInFlight = 10000);
+    bool isStreaming();
+
     QtRedisReply exec();
     bool execToBool();
+    QtRedisPipelineResult execToResult();
 
     void discard();
 
 protected:
     std::shared_ptr<QtRedisTransporter> _transporter {nullptr}; //!< слой взаимодействия с redis
     QList<QtRedisCommand> _commandList; //!< список команд
+    QByteArray _commandData;            //!< закодированные команды (кроме потокового режима)
+    QList<QtRedisScript> _scriptList;   //!< список скриптов команд (загружаются перед отправкой)
+
+    ReplyHandler _streamHandler;        //!< функция обработки ответов (потоковый режим, если задана)
+    int _streamFlushCommands {1000};    //!< количество команд, после которого они отправляются
+    int _streamFlushBytes {1048576};    //!< размер команд (байт), после которого они отправляются
+    int _streamMaxInFlight {10000};     //!< максимальное количество команд, ожидающих ответа
+    QtRedisTransporter::StreamingRequest _streamRequest;    //!< текущая потоковая отправка
+    int _streamDataSize {0};            //!< размер неотправленных команд (байт)
+    int _streamIndex {0};               //!< порядковый номер следующего ответа
+
+    QtRedisReply exec_unsafe(bool *ok = 0);
 
     bool processCommand(const QtRedisCommand &command);
+    bool processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList);
+
+    void clearCommands_unsafe();
+    bool flushStream_unsafe(const int maxInFlight);
+    void resetStream_unsafe();
 };
 
 #endif // QTREDISPIPELINE_H
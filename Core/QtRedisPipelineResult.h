@@ -0,0 +1,178 @@
+#ifndef QTREDISPIPELINERESULT_H
+#define QTREDISPIPELINERESULT_H
+
+#include <QString>
+#include <QList>
+#include <QVector>
+
+#include "QtRedisCommand.h"
+#include "QtRedisReply.h"
+
+//!
+//! \file QtRedisPipelineResult.h
+//! \class QtRedisPipelineResult
+//! \brief Класс, описывающий результат выполнения команд конвейера (по каждой команде)
+//!
+//! The replies are indexed like the queued commands, the indices of the failed commands are computed once,
+//! so only the failed commands can be sent again (see failedCommands()).
+//!
+//! Note: See QtRedisPipeline::execToResult().
+//!
+class QtRedisPipelineResult
+{
+public:
+    //!
+    //! \brief Состояние выполнения команды
+    //!
+    enum class Status {
+        Ok = 0,     //!< команда выполнена
+        Error,      //!< сервер вернул ошибку
+        NotSent     //!< ответ не получен (ошибка соединения, команда могла быть не выполнена)
+    };
+
+    QtRedisPipelineResult() = default;
+    ~QtRedisPipelineResult() = default;
+
+    //!
+    //! \brief Конструктор класса
+    //! \param commands Список команд
+    //! \param replies Ответы от сервера (в порядке команд, пустой список при ошибке соединения)
+    //! \param error Сообщение об ошибке соединения
+    //!
+    QtRedisPipelineResult(const QList<QtRedisCommand> &commands,
+                          const QVector<QtRedisReply> &replies,
+                          const QString &error)
+        : _commands(commands)
+        , _replies(replies)
+        , _error(error) {
+        _statuses.reserve(_commands.size());
+        for (int index = 0; index < _commands.size(); ++index) {
+            Status status = Status::NotSent;
+            if (index < _replies.size())
+                status = (_replies.at(index).isError() ? Status::Error : Status::Ok);
+            if (status != Status::Ok)
+                _failedIndices.append(index);
+            _statuses.append(status);
+        }
+        _replies.resize(_commands.size());
+    }
+
+    //!
+    //! \brief Количество команд
+    //! \return
+    //!
+    int size() const {
+        return _commands.size();
+    }
+
+    //!
+    //! \brief Пуст ли результат
+    //! \return
+    //!
+    bool isEmpty() const {
+        return _commands.isEmpty();
+    }
+
+    //!
+    //! \brief Выполнены ли все команды
+    //! \return
+    //!
+    bool isOk() const {
+        return _error.isEmpty() && _failedIndices.isEmpty();
+    }
+
+    //!
+    //! \brief Сообщение об ошибке соединения
+    //! \return
+    //!
+    const QString &error() const {
+        return _error;
+    }
+
+    //!
+    //! \brief Список команд
+    //! \return
+    //!
+    const QList<QtRedisCommand> &commands() const {
+        return _commands;
+    }
+
+    //!
+    //! \brief Ответы от сервера (в порядке команд)
+    //! \return
+    //!
+    //! Note: The replies of the commands with status NotSent are Nil.
+    //!
+    const QVector<QtRedisReply> &replies() const {
+        return _replies;
+    }
+
+    //!
+    //! \brief Ответ от сервера на команду
+    //! \param index Номер команды
+    //! \return
+    //!
+    //! Warn: index must be a valid index position (i.e., 0 <= index < size())!
+    //!
+    const QtRedisReply &reply(const int index) const {
+        return _replies.at(index);
+    }
+
+    //!
+    //! \brief Состояние выполнения команды
+    //! \param index Номер команды
+    //! \return
+    //!
+    //! Warn: index must be a valid index position (i.e., 0 <= index < size())!
+    //!
+    Status status(const int index) const {
+        return _statuses.at(index);
+    }
+
+    //!
+    //! \brief Сообщение об ошибке команды
+    //! \param index Номер команды
+    //! \return
+    //!
+    //! Warn: index must be a valid index position (i.e., 0 <= index < size())!
+    //!
+    QString error(const int index) const {
+        switch (_statuses.at(index)) {
+        case Status::Error:
+            return _replies.at(index).strValue();
+        case Status::NotSent:
+            return _error;
+        default:
+            return QString();
+        }
+    }
+
+    //!
+    //! \brief Номера невыполненных команд (по возрастанию)
+    //! \return
+    //!
+    const QVector<int> &failedIndices() const {
+        return _failedIndices;
+    }
+
+    //!
+    //! \brief Невыполненные команды (в порядке failedIndices())
+    //! \return
+    //!
+    QList<QtRedisCommand> failedCommands() const {
+        QList<QtRedisCommand> commands;
+        commands.reserve(_failedIndices.size());
+        for (const int index : _failedIndices)
+            commands.append(_commands.at(index));
+        return commands;
+    }
+
+protected:
+    QList<QtRedisCommand>   _commands;      //!< список команд
+    QVector<QtRedisReply>   _replies;       //!< ответы от сервера
+    QVector<Status>         _statuses;      //!< состояния выполнения команд
+    QVector<int>            _failedIndices; //!< номера невыполненных команд
+    QString                 _error;         //!< сообщение об ошибке соединения
+};
+
+#endif // QTREDISPIPELINERESULT_H
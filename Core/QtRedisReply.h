@@ -2,10 +2,12 @@
 #define QTREDISREPLY_H
 
 #include <utility>
+#include <limits>
 #include <QByteArray>
 #include <QString>
 #include <QVector>
 #include <QList>
+#include <QHash>
 #include <QStringList>
 #include <QDebug>
 
@@ -17,6 +19,9 @@
 class QtRedisReply
 {
     friend class QtRedisParser;
+    friend class QtRedisStreamParser;
+    friend class QtRedisReplyTree;
+    friend class QtRedisTransporter;
 
 public:
     //!
@@ -28,7 +33,15 @@ public:
         Integer,      //!< число (Integer object - use QtRedisReply.intValue())
         Nil,          //!< нулевой объект (Nil object - nothing)
         Status,       //!< состояние (Status object - use QtRedisReply.strValue())
-        Error         //!< ошибка (Error object - use QtRedisReply.strValue())
+        Error,        //!< ошибка (Error object - use QtRedisReply.strValue())
+        Double,       //!< число с плавающей точкой (RESP3 Double object - use QtRedisReply.doubleValue())
+        Boolean,      //!< логическое значение (RESP3 Boolean object - use QtRedisReply.boolValue())
+        BigNumber,    //!< большое число (RESP3 Big number object - use QtRedisReply.strValue())
+        Verbatim,     //!< строка с форматом (RESP3 Verbatim string object - use QtRedisReply.strValue())
+        Map,          //!< словарь (RESP3 Map object - use QtRedisReply.arrayValue(), keys and values alternate)
+        Set,          //!< множество (RESP3 Set object - use QtRedisReply.arrayValue())
+        Push,         //!< внеочередное сообщение (RESP3 Push object - use QtRedisReply.arrayValue())
+        Attribute     //!< атрибуты (RESP3 Attribute object - use QtRedisReply.attributeValue())
     };
 
     //!
@@ -44,7 +57,9 @@ public:
     //!
     ~QtRedisReply() {
         _rawValue.clear();
+        _rawBuffer.clear();
         _arrayValue.clear();
+        _attributeValue.clear();
     }
 
     //!
@@ -53,8 +68,10 @@ public:
     //!
     QtRedisReply(const QtRedisReply &object)
         : _type (object.type())
-        , _rawValue (object.rawValue_ref())
-        , _arrayValue (object.arrayValue_ref()) {
+        , _rawValue (object._rawValue)
+        , _rawBuffer (object._rawBuffer)
+        , _arrayValue (object.arrayValue_ref())
+        , _attributeValue (object.attributeValue_ref()) {
     }
 
     //!
@@ -66,21 +83,61 @@ public:
         if (this == &object)
             return *this;
         _type = object.type();
-        _rawValue = object.rawValue_ref();
+        _rawValue = object._rawValue;
+        _rawBuffer = object._rawBuffer;
         _arrayValue = object.arrayValue_ref();
+        _attributeValue = object.attributeValue_ref();
         return *this;
     }
 
+    //!
+    //! \brief Отвязать значения от общего буфера принятых данных
+    //!
+    //! Note: String values reference a slice of the shared receive buffer (the buffer is kept alive while the object exists).
+    //! Note: Call this method to hold values long-term: each value gets its own copy and the shared buffer is released.
+    //!
+    void detach() {
+        if (!_rawBuffer.isNull()) {
+            _rawValue = QByteArray(_rawValue.constData(), _rawValue.size());
+            _rawBuffer.clear();
+        }
+        for (QtRedisReply &object : _arrayValue)
+            object.detach();
+        for (QtRedisReply &object : _attributeValue)
+            object.detach();
+    }
+
+    //!
+    //! \brief Ссылается ли значение на общий буфер принятых данных
+    //! \return
+    //!
+    //! Note: For Array objects checks all nested values.
+    //!
+    bool isShared() const {
+        if (!_rawBuffer.isNull())
+            return true;
+        for (const QtRedisReply &object : _arrayValue) {
+            if (object.isShared())
+                return true;
+        }
+        for (const QtRedisReply &object : _attributeValue) {
+            if (object.isShared())
+                return true;
+        }
+        return false;
+    }
+
     //!
     //! \brief Содержит ли значение результата
     //! \return
     //!
-    //! Checks that _type == ReplyType::String || _type == ReplyType::Array || _type == ReplyType::Integer
+    //! Checks that _type != ReplyType::Nil && _type != ReplyType::Status && _type != ReplyType::Error && _type != ReplyType::Attribute
     //!
     bool isValue() const {
-        return (_type == ReplyType::String
-                || _type == ReplyType::Array
-                || _type == ReplyType::Integer);
+        return (_type != ReplyType::Nil
+                && _type != ReplyType::Status
+                && _type != ReplyType::Error
+                && _type != ReplyType::Attribute);
     }
 
     //!
@@ -131,13 +188,90 @@ public:
         return (_type == ReplyType::Error);
     }
 
+    //!
+    //! \brief Является ли типом ReplyType::Double
+    //! \return
+    //!
+    bool isDouble() const {
+        return (_type == ReplyType::Double);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Boolean
+    //! \return
+    //!
+    bool isBoolean() const {
+        return (_type == ReplyType::Boolean);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::BigNumber
+    //! \return
+    //!
+    bool isBigNumber() const {
+        return (_type == ReplyType::BigNumber);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Verbatim
+    //! \return
+    //!
+    bool isVerbatim() const {
+        return (_type == ReplyType::Verbatim);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Map
+    //! \return
+    //!
+    bool isMap() const {
+        return (_type == ReplyType::Map);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Set
+    //! \return
+    //!
+    bool isSet() const {
+        return (_type == ReplyType::Set);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Push
+    //! \return
+    //!
+    bool isPush() const {
+        return (_type == ReplyType::Push);
+    }
+
+    //!
+    //! \brief Является ли типом ReplyType::Attribute
+    //! \return
+    //!
+    bool isAttribute() const {
+        return (_type == ReplyType::Attribute);
+    }
+
+    //!
+    //! \brief Является ли агрегатным типом (содержит массив значений)
+    //! \return
+    //!
+    //! Checks that _type == ReplyType::Array || _type == ReplyType::Map || _type == ReplyType::Set || _type == ReplyType::Push || _type == ReplyType::Attribute
+    //!
+    bool isAggregate() const {
+        return QtRedisReply::isAggregateType(_type);
+    }
+
     //!
     //! \brief Является ли пустым объектом
     //! \return
     //!
-    //! Checks that _type != ReplyType::Nil && _rawValue.isEmpty()
+    //! Checks that _type != ReplyType::Nil && _rawValue.isEmpty() (for aggregate types - _arrayValue.isEmpty())
     //!
     bool isEmpty() const {
+        if (this->isAggregate())
+            return _arrayValue.isEmpty();
+
         return (_type != ReplyType::Nil
                 && _rawValue.isEmpty());
     }
@@ -152,27 +286,63 @@ public:
     //! \brief "Сырое" значение
     //! \return
     //!
-    //! Note: Return copy of value!
+    //! Note: Return copy of value (never references the shared receive buffer, stays valid after the object is destroyed)!
+    //! Note: Array objects don't keep a raw copy of their payload (the value is empty)!
+    //! Note: The data is copied only if the value references the shared receive buffer, use rawValueView() to avoid the copy.
+    //! Note: For Verbatim objects the value includes the format prefix (e.g. "txt:")!
     //!
-    QByteArray rawValue() const { return _rawValue; }
+    QByteArray rawValue() const {
+        if (_rawBuffer.isNull())
+            return _rawValue;
+
+        return QByteArray(_rawValue.constData(), _rawValue.size());
+    }
 
     //!
     //! \brief "Сырое" значение
     //! \return
     //!
+    //! Note: Return reference value (owns its data, copies of it stay valid after the object is destroyed)!
+    //! Note: Array objects don't keep a raw copy of their payload (the value is empty)!
+    //! Note: The value referencing the shared receive buffer is copied by the first call (see detach()), use rawValueView() to avoid the copy.
+    //! Note: For Verbatim objects the value includes the format prefix (e.g. "txt:")!
+    //! Warn: Because of the copy on the first call, don't call it for the same object from several threads at once!
+    //!
+    const QByteArray &rawValue_ref() const {
+        if (!_rawBuffer.isNull()) {
+            _rawValue = QByteArray(_rawValue.constData(), _rawValue.size());
+            _rawBuffer.clear();
+        }
+        return _rawValue;
+    }
+
+    //!
+    //! \brief "Сырое" значение без копирования данных
+    //! \return
+    //!
     //! Note: Return reference value!
+    //! Note: Array objects don't keep a raw copy of their payload (the value is empty)!
+    //! Note: For Verbatim objects the value includes the format prefix (e.g. "txt:")!
+    //! Warn: The value of the String object may reference the shared receive buffer and is not '\0'-terminated,
+    //! the copies of the value are valid only while the object exists (see detach())!
     //!
-    const QByteArray &rawValue_ref() const { return _rawValue; }
+    const QByteArray &rawValueView() const { return _rawValue; }
 
     //!
     //! \brief Строковое значение
     //! \return
     //!
+    //! Note: For Verbatim objects returns the value without the format prefix.
+    //!
     QString strValue() const {
         if (_type == ReplyType::Error
             || _type == ReplyType::Status
-            || _type == ReplyType::String)
-            return QString::fromUtf8(_rawValue.constData());
+            || _type == ReplyType::String
+            || _type == ReplyType::Double
+            || _type == ReplyType::BigNumber)
+            return QString::fromUtf8(_rawValue);
+        else if (_type == ReplyType::Verbatim)
+            return QString::fromUtf8(this->verbatimValue());
 
         return QString();
     }
@@ -188,12 +358,80 @@ public:
         return 0;
     }
 
+    //!
+    //! \brief Числовое значение с плавающей точкой
+    //! \return
+    //!
+    //! Note: Also converts ReplyType::Integer and ReplyType::String objects (e.g. RESP2 reply of ZSCORE).
+    //! Note: Values "inf", "-inf" and "nan" are converted to the corresponding special values.
+    //!
+    double doubleValue() const {
+        if (_type != ReplyType::Double
+            && _type != ReplyType::Integer
+            && _type != ReplyType::String)
+            return 0.0;
+        if (_rawValue == "inf" || _rawValue == "+inf")
+            return std::numeric_limits<double>::infinity();
+        if (_rawValue == "-inf")
+            return -std::numeric_limits<double>::infinity();
+        if (_rawValue == "nan" || _rawValue == "-nan")
+            return std::numeric_limits<double>::quiet_NaN();
+
+        return _rawValue.toDouble();
+    }
+
+    //!
+    //! \brief Логическое значение
+    //! \return
+    //!
+    //! Note: Also converts ReplyType::Integer objects (value != 0).
+    //!
+    bool boolValue() const {
+        if (_type == ReplyType::Boolean)
+            return (_rawValue == "t");
+        else if (_type == ReplyType::Integer)
+            return (this->intValue() != 0);
+
+        return false;
+    }
+
+    //!
+    //! \brief Формат строки ReplyType::Verbatim
+    //! \return
+    //!
+    //! Note: For example "txt" or "mkd". For other types returns an empty value.
+    //!
+    QByteArray verbatimFormat() const {
+        if (_type != ReplyType::Verbatim
+            || _rawValue.size() < 4
+            || _rawValue.at(3) != ':')
+            return QByteArray();
+
+        return _rawValue.left(3);
+    }
+
+    //!
+    //! \brief Значение строки ReplyType::Verbatim без формата
+    //! \return
+    //!
+    QByteArray verbatimValue() const {
+        if (_type != ReplyType::Verbatim)
+            return QByteArray();
+        if (_rawValue.size() < 4
+            || _rawValue.at(3) != ':')
+            return _rawValue;
+
+        return _rawValue.mid(4);
+    }
+
     //!
     //! \brief Размер массива значений
     //! \return
     //!
+    //! Note: For ReplyType::Map objects returns the number of keys and values (keys and values alternate).
+    //!
     int arrayValueSize() const {
-        if (_type == ReplyType::Array)
+        if (this->isAggregate())
             return _arrayValue.size();
 
         return -1;
@@ -214,7 +452,7 @@ public:
     //! Note: Return copy of value!
     //!
     QVector<QtRedisReply> arrayValue() const {
-        if (_type == ReplyType::Array)
+        if (this->isAggregate())
             return _arrayValue;
 
         return QVector<QtRedisReply>();
@@ -239,7 +477,7 @@ public:
     //!
     QtRedisReply arrayValueAt(const int index) const {
         if (index < 0
-            || _type != ReplyType::Array
+            || !this->isAggregate()
             || _arrayValue.size() <= index)
             return QtRedisReply();
 
@@ -265,7 +503,7 @@ public:
     //! Note: Return copy of value!
     //!
     QtRedisReply arrayValueFirst() const {
-        if (_type != ReplyType::Array
+        if (!this->isAggregate()
             || _arrayValue.isEmpty())
             return QtRedisReply();
 
@@ -290,7 +528,7 @@ public:
     //! Note: Return copy of value!
     //!
     QtRedisReply arrayValueLast() const {
-        if (_type != ReplyType::Array
+        if (!this->isAggregate()
             || _arrayValue.isEmpty())
             return QtRedisReply();
 
@@ -308,6 +546,34 @@ public:
         return _arrayValue.constLast();
     }
 
+    //!
+    //! \brief Есть ли атрибуты ответа
+    //! \return
+    //!
+    bool hasAttributeValue() const {
+        return !_attributeValue.isEmpty();
+    }
+
+    //!
+    //! \brief Атрибуты ответа (RESP3)
+    //! \return
+    //!
+    //! Note: Keys and values alternate. Return copy of value!
+    //!
+    QVector<QtRedisReply> attributeValue() const {
+        return _attributeValue;
+    }
+
+    //!
+    //! \brief Атрибуты ответа (RESP3)
+    //! \return
+    //!
+    //! Note: Keys and values alternate. Return reference value!
+    //!
+    const QVector<QtRedisReply> &attributeValue_ref() const {
+        return _attributeValue;
+    }
+
     //!
     //! \brief operator <<
     //! \param dbg QDebug
@@ -318,7 +584,7 @@ public:
         dbg.nospace() << "QtRedisReply[ type: "
                       << QtRedisReply::typeToStr(object.type())
                       << "; raw: \""
-                      << object.rawValue_ref().constData()
+                      << object.rawValueView().toStdString().c_str()
                       << "\"; to-str: \""
                       << object.strValue().toStdString().c_str()
                       << "\"; to-int: "
@@ -353,12 +619,41 @@ public:
                 return QString("Status");
             case ReplyType::Error:
                 return QString("Error");
+            case ReplyType::Double:
+                return QString("Double");
+            case ReplyType::Boolean:
+                return QString("Boolean");
+            case ReplyType::BigNumber:
+                return QString("BigNumber");
+            case ReplyType::Verbatim:
+                return QString("Verbatim");
+            case ReplyType::Map:
+                return QString("Map");
+            case ReplyType::Set:
+                return QString("Set");
+            case ReplyType::Push:
+                return QString("Push");
+            case ReplyType::Attribute:
+                return QString("Attribute");
             default:
                 break;
         }
         return QString();
     }
 
+    //!
+    //! \brief Является ли тип объекта агрегатным (содержит массив значений)
+    //! \param type Тип объекта
+    //! \return
+    //!
+    static bool isAggregateType(const ReplyType &type) {
+        return (type == ReplyType::Array
+                || type == ReplyType::Map
+                || type == ReplyType::Set
+                || type == ReplyType::Push
+                || type == ReplyType::Attribute);
+    }
+
     //!
     //! \brief Проверить результат на корректность
     //! \param reply
@@ -378,7 +673,7 @@ public:
                  && reply.strValue() != "OK"
                  && reply.strValue() != "QUEUED")
             return false;
-        else if (reply.type() == QtRedisReply::ReplyType::Array) {
+        else if (reply.isAggregate()) {
             for (const QtRedisReply &rpl : reply.arrayValue_ref()) {
                 if (!QtRedisReply::isReplySuccess(rpl))
                     return false;
@@ -399,7 +694,7 @@ public:
     {
         if (reply.type() == QtRedisReply::ReplyType::Integer)
             return reply.intValue();
-        else if (reply.type() == QtRedisReply::ReplyType::Array && !reply.isArrayValueEmpty())
+        else if (reply.isAggregate() && !reply.isArrayValueEmpty())
             return QtRedisReply::replyToLong(reply.arrayValueFirst_ref());
 
         return -1;
@@ -411,14 +706,15 @@ public:
     //! \return
     //!
     //! Note: Если объект является массивом, для преобразования используется первый элемент массива.
-    //! Warn: Проверяется тип ReplyType::String или ReplyType::Status! Если тип объекта отличается, возвращается пустая строка!
+    //! Warn: Проверяется тип ReplyType::String, ReplyType::Status или ReplyType::Verbatim! Если тип объекта отличается, возвращается пустая строка!
     //!
     static QString replyToString(const QtRedisReply &reply)
     {
         if (reply.type() == QtRedisReply::ReplyType::String
-            || reply.type() == QtRedisReply::ReplyType::Status)
+            || reply.type() == QtRedisReply::ReplyType::Status
+            || reply.type() == QtRedisReply::ReplyType::Verbatim)
             return reply.strValue();
-        else if (reply.type() == QtRedisReply::ReplyType::Array && !reply.isArrayValueEmpty())
+        else if (reply.isAggregate() && !reply.isArrayValueEmpty())
             return QtRedisReply::replyToString(reply.arrayValueFirst_ref());
 
         return QString();
@@ -430,14 +726,17 @@ public:
     //! \return
     //!
     //! Note: Если объект является массивом, для преобразования используется первый элемент массива.
-    //! Warn: Проверяется тип ReplyType::String или ReplyType::Status! Если тип объекта отличается, возвращается пустой массив байт!
+    //! Warn: Проверяется тип ReplyType::String, ReplyType::Status или ReplyType::Verbatim! Если тип объекта отличается, возвращается пустой массив байт!
     //!
     static QByteArray replyToByteArray(const QtRedisReply &reply)
     {
         if (reply.type() == QtRedisReply::ReplyType::String
             || reply.type() == QtRedisReply::ReplyType::Status)
-            return reply.rawValue_ref();
-        else if (reply.type() == QtRedisReply::ReplyType::Array && !reply.isArrayValueEmpty())
+            return reply.rawValue();
+        else if (reply.type() == QtRedisReply::ReplyType::Verbatim) {
+            const QByteArray value = reply.verbatimValue();
+            return QByteArray(value.constData(), value.size());
+        } else if (reply.isAggregate() && !reply.isArrayValueEmpty())
             return QtRedisReply::replyToByteArray(reply.arrayValueFirst_ref());
 
         return QByteArray();
@@ -454,7 +753,7 @@ public:
     //!
     static QStringList replyToStringList(const QtRedisReply &reply, const bool singleValueForNonArray = false)
     {
-        if (reply.type() != QtRedisReply::ReplyType::Array) {
+        if (!reply.isAggregate()) {
             if (singleValueForNonArray)
                 return QStringList({reply.strValue()});
 
@@ -465,8 +764,8 @@ public:
         for (const QtRedisReply &replyObj : reply.arrayValue_ref()) {
             if (replyObj.type() == QtRedisReply::ReplyType::String) {
                 array.append(replyObj.strValue());
-            } else if (reply.type() == QtRedisReply::ReplyType::Array) {
-                const QStringList tmpLst = QtRedisReply::replyToStringList(reply, singleValueForNonArray);
+            } else if (replyObj.isAggregate()) {
+                const QStringList tmpLst = QtRedisReply::replyToStringList(replyObj, singleValueForNonArray);
                 if (!tmpLst.isEmpty())
                     array.append(tmpLst);
             }
@@ -485,9 +784,9 @@ public:
     //!
     static QList<QByteArray> replyToByteArrayList(const QtRedisReply &reply, const bool singleValueForNonArray = false)
     {
-        if (reply.type() != QtRedisReply::ReplyType::Array) {
+        if (!reply.isAggregate()) {
             if (singleValueForNonArray)
-                return QList<QByteArray>({reply.rawValue_ref()});
+                return QList<QByteArray>({reply.rawValue()});
 
             return QList<QByteArray>();
         }
@@ -495,9 +794,9 @@ public:
         QList<QByteArray> array;
         for (const QtRedisReply &replyObj : reply.arrayValue_ref()) {
             if (replyObj.type() == QtRedisReply::ReplyType::String) {
-                array.append(replyObj.rawValue_ref());
-            } else if (reply.type() == QtRedisReply::ReplyType::Array) {
-                const QList<QByteArray> tmpLst = QtRedisReply::replyToByteArrayList(reply, singleValueForNonArray);
+                array.append(replyObj.rawValue());
+            } else if (replyObj.isAggregate()) {
+                const QList<QByteArray> tmpLst = QtRedisReply::replyToByteArrayList(replyObj, singleValueForNonArray);
                 if (!tmpLst.isEmpty())
                     array.append(tmpLst);
             }
@@ -505,19 +804,51 @@ public:
         return array;
     }
 
+    //!
+    //! \brief Преобразовать ответ от сервера (поле-значение) в хэш
+    //! \param reply Ответ от сервера
+    //! \return
+    //!
+    //! Note: Supports the RESP3 Map reply and the RESP2 Array reply with alternating fields and values (HGETALL, CONFIG GET...).
+    //! Note: Each value in the hash is a copy (the hash is valid after the reply object is destroyed).
+    //! Warn: Pairs with aggregate or Nil fields or values are skipped!
+    //!
+    static QHash<QByteArray, QByteArray> replyToByteArrayHash(const QtRedisReply &reply)
+    {
+        if (reply.type() != QtRedisReply::ReplyType::Map
+            && reply.type() != QtRedisReply::ReplyType::Array)
+            return QHash<QByteArray, QByteArray>();
+
+        const QVector<QtRedisReply> &array = reply.arrayValue_ref();
+        QHash<QByteArray, QByteArray> hash;
+        hash.reserve(array.size() / 2);
+        for (int i = 0; i + 1 < array.size(); i += 2) {
+            const QtRedisReply &field = array.at(i);
+            const QtRedisReply &value = array.at(i + 1);
+            if (field.isAggregate() || field.isNil()
+                || value.isAggregate() || value.isNil())
+                continue;
+
+            hash.insert(field.rawValue(), value.rawValue());
+        }
+        return hash;
+    }
+
     //!
     //! \brief Преобразовать ответ от сервера (replyType_Integer) в bool
     //! \param reply Ответ от сервера
     //! \return
     //!
     //! Note: Если объект является массивом, для преобразования используется первый элемент массива.
-    //! Warn: Проверяется ReplyType::Integer! Если тип объекта отличается, возвращается false!
+    //! Warn: Проверяется ReplyType::Integer или ReplyType::Boolean! Если тип объекта отличается, возвращается false!
     //!
     static bool replyIntToBool(const QtRedisReply &reply)
     {
         if (reply.type() == QtRedisReply::ReplyType::Integer)
             return (reply.intValue() == 0) ? false : true;
-        else if (reply.type() == QtRedisReply::ReplyType::Array && !reply.isArrayValueEmpty())
+        else if (reply.type() == QtRedisReply::ReplyType::Boolean)
+            return reply.boolValue();
+        else if (reply.isAggregate() && !reply.isArrayValueEmpty())
             return QtRedisReply::replyIntToBool(reply.arrayValueFirst_ref());
 
         return false;
@@ -537,7 +868,7 @@ public:
         if (reply.type() == QtRedisReply::ReplyType::Status
             || reply.type() == QtRedisReply::ReplyType::String)
             return (reply.strValue() == "OK" || reply.strValue() == "QUEUED");
-        else if (reply.type() == QtRedisReply::ReplyType::Array && !reply.isArrayValueEmpty())
+        else if (reply.isAggregate() && !reply.isArrayValueEmpty())
             return QtRedisReply::replySimpleStringToBool(reply.arrayValueFirst_ref());
 
         return false;
@@ -545,8 +876,10 @@ public:
 
 protected:
     ReplyType               _type {ReplyType::Nil}; //!< тип объекта
-    QByteArray              _rawValue;              //!< "сырое" значение
+    mutable QByteArray      _rawValue;              //!< "сырое" значение
+    mutable QByteArray      _rawBuffer;             //!< общий буфер принятых данных (на который ссылается _rawValue, см. rawValue_ref())
     QVector<QtRedisReply>   _arrayValue;            //!< массив значений
+    QVector<QtRedisReply>   _attributeValue;        //!< атрибуты ответа (RESP3)
 
     //!
     //! \brief Задать тип объекта
@@ -558,7 +891,20 @@ protected:
     //! \brief Задать "сырое" значение
     //! \param value "Сырое" значение
     //!
-    void setRawValue(const QByteArray &value) { _rawValue = value; }
+    void setRawValue(const QByteArray &value) { _rawValue = value; _rawBuffer.clear(); }
+
+    //!
+    //! \brief Задать "сырое" значение (без копирования данных)
+    //! \param buffer Общий буфер принятых данных
+    //! \param index Индекс начала значения в буфере
+    //! \param size Размер значения
+    //!
+    //! Note: The value references the slice of the buffer, the buffer is kept alive by the implicit sharing.
+    //!
+    void setRawValue(const QByteArray &buffer, const int index, const int size) {
+        _rawBuffer = buffer;
+        _rawValue = QByteArray::fromRawData(_rawBuffer.constData() + index, size);
+    }
 
     //!
     //! \brief Добавить элемент в массив
@@ -0,0 +1,264 @@
+#ifndef QTREDISREPLYTREE_H
+#define QTREDISREPLYTREE_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+#include <QList>
+
+#include "QtRedisReply.h"
+
+//!
+//! \file QtRedisReplyTree.h
+//! \class QtRedisReplyTree
+//! \brief Класс, описывающий ответ от сервера Redis в компактном виде
+//!
+//! The reply is stored as a flat array of nodes with offsets into one payload buffer
+//! (the shared receive buffer). Node 0 is the root of the reply, elements of the array
+//! nodes are accessed by arrayItem().
+//!
+//! Note: Use toReply() to get the QtRedisReply object (the conversion is performed on demand).
+//!
+class QtRedisReplyTree
+{
+    friend class QtRedisStreamParser;
+
+public:
+    QtRedisReplyTree() = default;
+    ~QtRedisReplyTree() = default;
+
+    //!
+    //! \brief Содержит ли объект разобранный ответ
+    //! \return
+    //!
+    bool isValid() const {
+        return !_nodes.isEmpty();
+    }
+
+    //!
+    //! \brief Количество узлов
+    //! \return
+    //!
+    int nodeCount() const {
+        return _nodes.size();
+    }
+
+    //!
+    //! \brief Тип узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    //! Note: If the node index is incorrect, returns ReplyType::Nil.
+    //!
+    QtRedisReply::ReplyType type(const int node = 0) const {
+        if (!this->isNodeValid(node))
+            return QtRedisReply::ReplyType::Nil;
+
+        return _nodes.at(node).type;
+    }
+
+    //!
+    //! \brief "Сырое" значение узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    //! Note: For aggregate and Nil nodes returns an empty value.
+    //! Warn: The value references the payload buffer of the object (without copying) and is valid while the object exists!
+    //!
+    QByteArray value(const int node = 0) const {
+        if (!this->isNodeValid(node)
+            || QtRedisReply::isAggregateType(_nodes.at(node).type)
+            || _nodes.at(node).type == QtRedisReply::ReplyType::Nil)
+            return QByteArray();
+
+        const Node &buffNode = _nodes.at(node);
+        return QByteArray::fromRawData(_data.constData() + _dataIndex + buffNode.index, buffNode.size);
+    }
+
+    //!
+    //! \brief Строковое значение узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    QString strValue(const int node = 0) const {
+        const QtRedisReply::ReplyType buffType = this->type(node);
+        if (buffType == QtRedisReply::ReplyType::Error
+            || buffType == QtRedisReply::ReplyType::Status
+            || buffType == QtRedisReply::ReplyType::String
+            || buffType == QtRedisReply::ReplyType::Double
+            || buffType == QtRedisReply::ReplyType::BigNumber)
+            return QString::fromUtf8(this->value(node));
+        else if (buffType == QtRedisReply::ReplyType::Verbatim)
+            return this->toReply(node).strValue();
+
+        return QString();
+    }
+
+    //!
+    //! \brief Числовое значение узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    qlonglong intValue(const int node = 0) const {
+        if (this->type(node) == QtRedisReply::ReplyType::Integer)
+            return this->value(node).toLongLong();
+
+        return 0;
+    }
+
+    //!
+    //! \brief Размер массива значений узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    //! Note: If the node is not an aggregate (Array, Map, Set, Push), returns -1.
+    //! Note: For Map nodes returns the number of keys and values (keys and values alternate).
+    //!
+    int arraySize(const int node = 0) const {
+        if (!QtRedisReply::isAggregateType(this->type(node)))
+            return -1;
+
+        return _nodes.at(node).size;
+    }
+
+    //!
+    //! \brief Индекс узла элемента массива
+    //! \param node Индекс узла массива
+    //! \param index Индекс элемента
+    //! \return
+    //!
+    //! Note: If the node is not an array or the element index is incorrect, returns -1.
+    //!
+    int arrayItem(const int node, const int index) const {
+        if (index < 0
+            || index >= this->arraySize(node))
+            return -1;
+
+        return _items.at(_nodes.at(node).index + index);
+    }
+
+    //!
+    //! \brief Преобразовать узел в объект QtRedisReply
+    //! \param node Индекс узла
+    //! \return
+    //!
+    //! Note: String values of the result reference the payload buffer (see QtRedisReply::detach()).
+    //!
+    QtRedisReply toReply(const int node = 0) const {
+        if (!this->isNodeValid(node))
+            return QtRedisReply();
+
+        const Node &buffNode = _nodes.at(node);
+        QtRedisReply reply(buffNode.type);
+        switch (buffNode.type) {
+            case QtRedisReply::ReplyType::Array:
+            case QtRedisReply::ReplyType::Map:
+            case QtRedisReply::ReplyType::Set:
+            case QtRedisReply::ReplyType::Push:
+            case QtRedisReply::ReplyType::Attribute:
+                reply._arrayValue.reserve(buffNode.size);
+                for (int i = 0; i < buffNode.size; i++)
+                    reply.appendArrayValue(this->toReply(_items.at(buffNode.index + i)));
+                break;
+            case QtRedisReply::ReplyType::String:
+                reply.setRawValue(_data, _dataIndex + buffNode.index, buffNode.size);
+                break;
+            case QtRedisReply::ReplyType::Nil:
+                break;
+            default:
+                reply.setRawValue(_data.mid(_dataIndex + buffNode.index, buffNode.size));
+                break;
+        }
+        return reply;
+    }
+
+    //!
+    //! \brief Преобразовать массив значений узла в список
+    //! \param node Индекс узла массива
+    //! \return
+    //!
+    //! Note: Each value in the list is a copy (the list is valid after the object is destroyed).
+    //! Warn: Only ReplyType::String elements are added to the list!
+    //!
+    QList<QByteArray> toByteArrayList(const int node = 0) const {
+        const int buffSize = this->arraySize(node);
+        if (buffSize <= 0)
+            return QList<QByteArray>();
+
+        QList<QByteArray> array;
+        array.reserve(buffSize);
+        for (int i = 0; i < buffSize; i++) {
+            const int buffItem = this->arrayItem(node, i);
+            if (_nodes.at(buffItem).type == QtRedisReply::ReplyType::String)
+                array.append(QByteArray(this->value(buffItem).constData(), _nodes.at(buffItem).size));
+        }
+        return array;
+    }
+
+protected:
+    //!
+    //! \brief Узел ответа
+    //!
+    struct Node {
+        QtRedisReply::ReplyType type {QtRedisReply::ReplyType::Nil}; //!< тип узла
+        int                     index {0};                           //!< индекс значения в буфере (для массива - индекс первого элемента в _items)
+        int                     size {0};                            //!< размер значения (для массива - количество элементов)
+    };
+
+    QByteArray      _data;          //!< общий буфер принятых данных
+    int             _dataIndex {0}; //!< индекс начала ответа в буфере
+    QVector<Node>   _nodes;         //!< массив узлов
+    QVector<int>    _items;         //!< индексы узлов элементов массивов
+
+    //!
+    //! \brief Корректен ли индекс узла
+    //! \param node Индекс узла
+    //! \return
+    //!
+    bool isNodeValid(const int node) const {
+        return (node >= 0 && node < _nodes.size());
+    }
+
+    //!
+    //! \brief Добавить узел
+    //! \param type Тип узла
+    //! \param index Индекс значения относительно начала ответа
+    //! \param size Размер значения
+    //! \return
+    //!
+    int appendNode(const QtRedisReply::ReplyType &type, const int index, const int size) {
+        Node node;
+        node.type = type;
+        node.index = index;
+        node.size = size;
+        _nodes.append(node);
+        return _nodes.size() - 1;
+    }
+
+    //!
+    //! \brief Добавить узел массива
+    //! \param type Тип массива (Array, Map, Set, Push, Attribute)
+    //! \param size Количество элементов
+    //! \return
+    //!
+    //! Note: The indices of the elements are set by setArrayItems() when all elements are parsed,
+    //! so no space is allocated for the declared number of elements.
+    //!
+    int appendArrayNode(const QtRedisReply::ReplyType &type, const int size) {
+        return this->appendNode(type, _items.size(), size);
+    }
+
+    //!
+    //! \brief Задать узлы элементов массива
+    //! \param node Индекс узла массива
+    //! \param items Индексы узлов элементов
+    //!
+    void setArrayItems(const int node, const QVector<int> &items) {
+        Node &buffNode = _nodes[node];
+        buffNode.index = _items.size();
+        buffNode.size = items.size();
+        _items += items;
+    }
+};
+
+#endif // QTREDISREPLYTREE_H
@@ -0,0 +1,137 @@
+#ifndef QTREDISSCRIPT_H
+#define QTREDISSCRIPT_H
+
+#include <QByteArray>
+#include <QString>
+#include <QList>
+#include <QCryptographicHash>
+
+#include "QtRedisCommand.h"
+#include "QtRedisReply.h"
+
+//!
+//! \file QtRedisScript.h
+//! \class QtRedisScript
+//! \brief Класс, описывающий Lua-скрипт Redis-a (EVAL, EVALSHA)
+//!
+//! The SHA1 digest of the script is computed locally once, so the script is called by EVALSHA
+//! and the body is sent to the server only when the script is not in the script cache (NOSCRIPT).
+//!
+//! Note: See QtRedisBase::redisEvalScript().
+//!
+class QtRedisScript
+{
+public:
+    QtRedisScript() = default;
+    ~QtRedisScript() = default;
+
+    //!
+    //! \brief Конструктор класса
+    //! \param source Текст скрипта
+    //!
+    explicit QtRedisScript(const QByteArray &source)
+        : _source(source)
+        , _sha1(QCryptographicHash::hash(source, QCryptographicHash::Sha1).toHex()) {
+    }
+
+    //!
+    //! \brief Конструктор класса
+    //! \param source Текст скрипта
+    //!
+    explicit QtRedisScript(const QString &source)
+        : QtRedisScript(source.toUtf8()) {
+    }
+
+    //!
+    //! \brief Является ли объект корректным
+    //! \return
+    //!
+    bool isValid() const {
+        return !_source.isEmpty();
+    }
+
+    //!
+    //! \brief Текст скрипта
+    //! \return
+    //!
+    const QByteArray &source() const {
+        return _source;
+    }
+
+    //!
+    //! \brief SHA1-дайджест скрипта (в нижнем регистре)
+    //! \return
+    //!
+    const QByteArray &sha1() const {
+        return _sha1;
+    }
+
+    //!
+    //! \brief Сформировать команду EVALSHA
+    //! \param keyList Список ключей
+    //! \param argList Список аргументов
+    //! \return
+    //!
+    QtRedisCommand evalShaCommand(const QList<QByteArray> &keyList, const QList<QByteArray> &argList) const {
+        return QtRedisScript::makeCommand("EVALSHA", _sha1, keyList, argList);
+    }
+
+    //!
+    //! \brief Сформировать команду EVAL
+    //! \param keyList Список ключей
+    //! \param argList Список аргументов
+    //! \return
+    //!
+    QtRedisCommand evalCommand(const QList<QByteArray> &keyList, const QList<QByteArray> &argList) const {
+        return QtRedisScript::makeCommand("EVAL", _source, keyList, argList);
+    }
+
+    //!
+    //! \brief Сформировать команду SCRIPT LOAD
+    //! \return
+    //!
+    QtRedisCommand loadCommand() const {
+        return QtRedisCommand("SCRIPT") << "LOAD" << _source;
+    }
+
+    //!
+    //! \brief Является ли ответ ошибкой отсутствия скрипта в кэше сервера
+    //! \param reply Ответ от сервера
+    //! \return
+    //!
+    static bool isNoScriptError(const QtRedisReply &reply) {
+        return reply.isError() && reply.rawValueView().startsWith("NOSCRIPT");
+    }
+
+    bool operator==(const QtRedisScript &object) const {
+        return _sha1 == object._sha1;
+    }
+
+    bool operator!=(const QtRedisScript &object) const {
+        return _sha1 != object._sha1;
+    }
+
+protected:
+    QByteArray  _source;    //!< текст скрипта
+    QByteArray  _sha1;      //!< SHA1-дайджест скрипта
+
+    //!
+    //! \brief Сформировать команду вызова скрипта
+    //! \param name Команда
+    //! \param script Текст или SHA1-дайджест скрипта
+    //! \param keyList Список ключей
+    //! \param argList Список аргументов
+    //! \return
+    //!
+    static QtRedisCommand makeCommand(const QByteArray &name,
+                                      const QByteArray &script,
+                                      const QList<QByteArray> &keyList,
+                                      const QList<QByteArray> &argList) {
+        QtRedisCommand command(name);
+        command.reserve(keyList.size() + argList.size() + 2);
+        command << script << keyList.size() << keyList << argList;
+        return command;
+    }
+};
+
+#endif // QTREDISSCRIPT_H
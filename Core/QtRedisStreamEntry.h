@@ -0,0 +1,210 @@
+#ifndef QTREDISSTREAMENTRY_H
+#define QTREDISSTREAMENTRY_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+#include <QPair>
+#include <QMap>
+
+#include "QtRedisReply.h"
+#include "QtRedisReplyTree.h"
+
+//!
+//! \file QtRedisStreamEntry.h
+//! \class QtRedisStreamEntry
+//! \brief Класс, описывающий запись потока Redis-a (XRANGE, XREAD, XREADGROUP, XCLAIM...)
+//!
+//! The entry keeps the ID and the flat list of field-value pairs (own copies of the data),
+//! so it can be passed to other threads after the reply is destroyed.
+//!
+//! Note: fromReplyTree() builds the entries directly from the compact reply, without intermediate QtRedisReply objects.
+//!
+class QtRedisStreamEntry
+{
+public:
+    typedef QPair<QByteArray, QByteArray> Field;
+
+    QtRedisStreamEntry() = default;
+    ~QtRedisStreamEntry() = default;
+
+    //!
+    //! \brief Конструктор класса
+    //! \param id Идентификатор записи
+    //! \param fields Список поле-значение
+    //!
+    QtRedisStreamEntry(const QByteArray &id, const QVector<Field> &fields)
+        : _id(id)
+        , _fields(fields) {
+    }
+
+    //!
+    //! \brief Идентификатор записи
+    //! \return
+    //!
+    const QByteArray &id() const {
+        return _id;
+    }
+
+    //!
+    //! \brief Список поле-значение (в порядке добавления записи)
+    //! \return
+    //!
+    const QVector<Field> &fields() const {
+        return _fields;
+    }
+
+    //!
+    //! \brief Значение поля
+    //! \param field Поле
+    //! \param defaultValue Значение по умолчанию
+    //! \return
+    //!
+    QByteArray value(const QByteArray &field, const QByteArray &defaultValue = QByteArray()) const {
+        for (const Field &buffField : _fields) {
+            if (buffField.first == field)
+                return buffField.second;
+        }
+        return defaultValue;
+    }
+
+    //!
+    //! \brief Удалена ли запись из потока
+    //! \return
+    //!
+    //! Note: Pending entries deleted by XDEL are returned by XREADGROUP (XCLAIM) without fields.
+    //!
+    bool isDeleted() const {
+        return _fields.isEmpty();
+    }
+
+    //!
+    //! \brief Преобразовать список записей (XRANGE, XREVRANGE, XCLAIM) в массив записей
+    //! \param reply Ответ от сервера
+    //! \return
+    //!
+    //! Note: For XAUTOCLAIM pass the second element of the reply.
+    //!
+    static QVector<QtRedisStreamEntry> fromReply(const QtRedisReply &reply) {
+        if (!reply.isAggregate())
+            return QVector<QtRedisStreamEntry>();
+
+        QVector<QtRedisStreamEntry> entries;
+        entries.reserve(reply.arrayValueSize());
+        for (const QtRedisReply &entryReply : reply.arrayValue_ref()) {
+            if (!entryReply.isAggregate()
+                || entryReply.arrayValueSize() != 2
+                || !entryReply.arrayValueFirst_ref().isString())
+                continue;
+
+            QtRedisStreamEntry entry;
+            entry._id = entryReply.arrayValueFirst_ref().rawValue();
+            const QVector<QtRedisReply> &fieldList = entryReply.arrayValueLast_ref().arrayValue_ref();
+            entry._fields.reserve(fieldList.size() / 2);
+            for (int i = 0; i + 1 < fieldList.size(); i += 2)
+                entry._fields.append(Field(fieldList.at(i).rawValue(), fieldList.at(i + 1).rawValue()));
+            entries.append(entry);
+        }
+        return entries;
+    }
+
+    //!
+    //! \brief Преобразовать ответ XREAD (XREADGROUP) в массивы записей потоков
+    //! \param reply Ответ от сервера
+    //! \return Массивы записей по ключам потоков
+    //!
+    //! Note: Supports the RESP2 Array reply and the RESP3 Map reply. For Nil reply (timeout) returns an empty map.
+    //!
+    static QMap<QByteArray, QVector<QtRedisStreamEntry>> fromStreamsReply(const QtRedisReply &reply) {
+        QMap<QByteArray, QVector<QtRedisStreamEntry>> streams;
+        const QVector<QtRedisReply> &array = reply.arrayValue_ref();
+        if (reply.type() == QtRedisReply::ReplyType::Map) {
+            for (int i = 0; i + 1 < array.size(); i += 2)
+                streams.insert(array.at(i).rawValue(), QtRedisStreamEntry::fromReply(array.at(i + 1)));
+        } else if (reply.type() == QtRedisReply::ReplyType::Array) {
+            for (const QtRedisReply &streamReply : array) {
+                if (streamReply.isAggregate() && streamReply.arrayValueSize() == 2)
+                    streams.insert(streamReply.arrayValueFirst_ref().rawValue(),
+                                   QtRedisStreamEntry::fromReply(streamReply.arrayValueLast_ref()));
+            }
+        }
+        return streams;
+    }
+
+    //!
+    //! \brief Преобразовать узел списка записей компактного ответа в массив записей
+    //! \param tree Компактный ответ от сервера
+    //! \param node Индекс узла списка записей
+    //! \return
+    //!
+    static QVector<QtRedisStreamEntry> fromReplyTree(const QtRedisReplyTree &tree, const int node = 0) {
+        const int buffSize = tree.arraySize(node);
+        if (buffSize <= 0)
+            return QVector<QtRedisStreamEntry>();
+
+        QVector<QtRedisStreamEntry> entries;
+        entries.reserve(buffSize);
+        for (int i = 0; i < buffSize; i++) {
+            const int entryNode = tree.arrayItem(node, i);
+            if (tree.arraySize(entryNode) != 2)
+                continue;
+
+            const int idNode = tree.arrayItem(entryNode, 0);
+            const int fieldsNode = tree.arrayItem(entryNode, 1);
+            if (tree.type(idNode) != QtRedisReply::ReplyType::String)
+                continue;
+
+            QtRedisStreamEntry entry;
+            entry._id = copyValue(tree, idNode);
+            const int fieldsSize = tree.arraySize(fieldsNode);
+            if (fieldsSize > 0) {
+                entry._fields.reserve(fieldsSize / 2);
+                for (int j = 0; j + 1 < fieldsSize; j += 2)
+                    entry._fields.append(Field(copyValue(tree, tree.arrayItem(fieldsNode, j)),
+                                               copyValue(tree, tree.arrayItem(fieldsNode, j + 1))));
+            }
+            entries.append(entry);
+        }
+        return entries;
+    }
+
+    //!
+    //! \brief Преобразовать компактный ответ XREAD (XREADGROUP) в массивы записей потоков
+    //! \param tree Компактный ответ от сервера
+    //! \return Массивы записей по ключам потоков
+    //!
+    static QMap<QByteArray, QVector<QtRedisStreamEntry>> fromStreamsReplyTree(const QtRedisReplyTree &tree) {
+        QMap<QByteArray, QVector<QtRedisStreamEntry>> streams;
+        const int buffSize = tree.arraySize(0);
+        if (tree.type(0) == QtRedisReply::ReplyType::Map) {
+            for (int i = 0; i + 1 < buffSize; i += 2)
+                streams.insert(copyValue(tree, tree.arrayItem(0, i)),
+                               QtRedisStreamEntry::fromReplyTree(tree, tree.arrayItem(0, i + 1)));
+        } else if (tree.type(0) == QtRedisReply::ReplyType::Array) {
+            for (int i = 0; i < buffSize; i++) {
+                const int streamNode = tree.arrayItem(0, i);
+                if (tree.arraySize(streamNode) == 2)
+                    streams.insert(copyValue(tree, tree.arrayItem(streamNode, 0)),
+                                   QtRedisStreamEntry::fromReplyTree(tree, tree.arrayItem(streamNode, 1)));
+            }
+        }
+        return streams;
+    }
+
+protected:
+    QByteArray      _id;        //!< идентификатор записи
+    QVector<Field>  _fields;    //!< список поле-значение
+
+    //!
+    //! \brief Копия значения узла компактного ответа
+    //! \param tree Компактный ответ
+    //! \param node Индекс узла
+    //! \return
+    //!
+    static QByteArray copyValue(const QtRedisReplyTree &tree, const int node) {
+        const QByteArray value = tree.value(node);
+        return QByteArray(value.constData(), value.size());
+    }
+};
+
+#endif // QTREDISSTREAMENTRY_H
@@ -64,7 +64,7 @@ bool QtRedisTransaction::watch(const QString &key)
     this->clearLastError_safe();
     QString error;
     bool isOk = false;
-    const QtRedisReply reply = _transporter->sendCommand(QtRedisCommand::fromString(QString("WATCH %1").arg(key).trimmed()), error, &isOk);
+    const QtRedisReply reply = _transporter->sendCommand(QtRedisCommand("WATCH") << key.trimmed(), error, &isOk);
     if (!error.isEmpty())
         this->setLastError_safe(error);
 
@@ -109,10 +109,6 @@ bool QtRedisTransaction::watch(const QStringList &keys)
     }
     QStringList tmpKeys;
     for (const QString &key : keys) {
-        if (key.indexOf(" ") != -1) {
-            this->setLastError_safe(QString("Invalid key (%1)!").arg(key));
-            return false;
-        }
         if (!_watchList.contains(key.trimmed()))
             tmpKeys.append(key.trimmed());
     }
@@ -130,7 +126,7 @@ bool QtRedisTransaction::watch(const QStringList &keys)
     this->clearLastError_safe();
     QString error;
     bool isOk = false;
-    const QtRedisReply reply = _transporter->sendCommand(QtRedisCommand::fromString(QString("WATCH %1").arg(tmpKeys.join(" ")).trimmed()), error, &isOk);
+    const QtRedisReply reply = _transporter->sendCommand(QtRedisCommand("WATCH") << tmpKeys, error, &isOk);
     if (!error.isEmpty())
         this->setLastError_safe(error);
 
@@ -246,6 +242,17 @@ QtRedisReply QtRedisTransaction::exec()
         this->setLastError_safe("Client is not connected!");
         return QtRedisReply();
     }
+    // load scripts of queued commands
+    if (_piped && !_scriptList.isEmpty()) {
+        QString error;
+        const bool isLoaded = _transporter->loadScripts(_scriptList, error);
+        _scriptList.clear();
+        if (!isLoaded) {
+            this->setLastError_safe(error);
+            _commandList.clear();
+            return QtRedisReply();
+        }
+    }
     // open transaction
     if (!this->openTransaction_unsafe())
         return QtRedisReply();
@@ -313,6 +320,7 @@ void QtRedisTransaction::discard()
 {
     QMutexLocker lock(&_mutex);
     _commandList.clear();
+    _scriptList.clear();
     _watchList.clear();
     if (!_piped)
         this->discardTransaction_unsafe();
@@ -350,6 +358,39 @@ bool QtRedisTransaction::processCommand(const QtRedisCommand &command)
     return true;
 }
 
+//!
+//! \brief Выполнить скрипт
+//! \param script Скрипт
+//! \param keyList Список ключей
+//! \param argList Список аргументов
+//! \return
+//!
+//! If piped == true, the command is queued by EVALSHA, the script is loaded by exec() before MULTI.
+//! If piped == false, the script is loaded before MULTI (the first command), inside the transaction
+//! the command is queued by EVAL (SCRIPT LOAD would be queued too).
+//!
+bool QtRedisTransaction::processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList)
+{
+    if (_piped) {
+        if (!_scriptList.contains(script))
+            _scriptList.append(script);
+        return this->processCommand(script.evalShaCommand(keyList, argList));
+    }
+    if (_inTransaction)
+        return this->processCommand(script.evalCommand(keyList, argList));
+
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return false;
+    }
+    QString error;
+    if (!_transporter->loadScripts(QList<QtRedisScript>() << script, error)) {
+        this->setLastError_safe(error);
+        return false;
+    }
+    return this->processCommand(script.evalShaCommand(keyList, argList));
+}
+
 //!
 //! \brief Проверка успешного добавления команды в очередь Redis
 //! \param reply Ответ от сервера Redis
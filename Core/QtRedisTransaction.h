@@ -26,6 +26,7 @@ public:
     QtRedisTransaction(const QtRedisTransaction &object)
         : _transporter(object._transporter)
         , _commandList(object._commandList)
+        , _scriptList(object._scriptList)
         , _inTransaction(object._inTransaction)
         , _piped(object._piped)
     {}
@@ -35,6 +36,7 @@ public:
             return *this;
         _transporter = object._transporter;
         _commandList = object._commandList;
+        _scriptList = object._scriptList;
         _inTransaction = object._inTransaction;
         _piped = object._piped;
         return *this;
@@ -52,12 +54,14 @@ public:
 protected:
     std::shared_ptr<QtRedisTransporter> _transporter {nullptr}; //!< слой взаимодействия с redis
     QList<QtRedisCommand> _commandList; //!< список команд
+    QList<QtRedisScript> _scriptList;   //!< список скриптов команд (загружаются перед открытием транзакции)
     QStringList _watchList;             //!< список отслеживаемых ключей
 
     bool _inTransaction {false};        //!< находится ли объект в режиме транзакции
     bool _piped {false};                //!< находится ли объект в режиме Pipeline (накомпления команд для отправки одним пакетом)
 
     bool processCommand(const QtRedisCommand &command);
+    bool processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList);
 
     bool isReplyQueued(const QtRedisReply &reply);
     bool openTransaction_unsafe();
@@ -98,35 +98,9 @@ bool QtRedisClient::redisConnect(const QString &host,
         && _transporter->isConnected())
         return true;
 
-    if (!_transporter) {
-        _transporter = std::make_shared<QtRedisTransporter>(contextChannelMode);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextConnected,
-                         this, &QtRedisClient::contextConnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextDisconnected,
-                         this, &QtRedisClient::contextDisconnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelMessage,
-                         this, &QtRedisClient::incomingChannelMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelShardMessage,
-                         this, &QtRedisClient::incomingChannelShardMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelPatternMessage,
-                         this, &QtRedisClient::incomingChannelPatternMessage,
-                         Qt::QueuedConnection);
-    } else {
-        _transporter->clearTransporter();
-    }
-    QString error;
-    if (!_transporter->initTransporter(QtRedisTransporter::Type::Tcp, host, port, error)) {
-        this->setLastError_safe(error);
+    if (!this->setupTransporter_unsafe(QtRedisTransporter::Type::Tcp, host, port, contextChannelMode))
         return false;
-    }
-    const bool isOk = _transporter->connectToServer(error, timeOutMsec);
-    if (!isOk)
-        this->setLastError_safe(error);
-    return isOk;
+    return this->connectToServer_unsafe(timeOutMsec);
 }
 
 //!
@@ -157,36 +131,10 @@ bool QtRedisClient::redisConnectEncrypted(const QString &host,
         && _transporter->isConnected())
         return true;
 
-    if (!_transporter) {
-        _transporter = std::make_shared<QtRedisTransporter>(contextChannelMode);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextConnected,
-                         this, &QtRedisClient::contextConnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextDisconnected,
-                         this, &QtRedisClient::contextDisconnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelMessage,
-                         this, &QtRedisClient::incomingChannelMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelShardMessage,
-                         this, &QtRedisClient::incomingChannelShardMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelPatternMessage,
-                         this, &QtRedisClient::incomingChannelPatternMessage,
-                         Qt::QueuedConnection);
-    } else {
-        _transporter->clearTransporter();
-    }
-    QString error;
-    if (!_transporter->initTransporter(QtRedisTransporter::Type::Ssl, host, port, error)) {
-        this->setLastError_safe(error);
+    if (!this->setupTransporter_unsafe(QtRedisTransporter::Type::Ssl, host, port, contextChannelMode))
         return false;
-    }
     _transporter->setSslConfig(sslConfig);
-    const bool isOk = _transporter->connectToServer(error, timeOutMsec);
-    if (!isOk)
-        this->setLastError_safe(error);
-    return isOk;
+    return this->connectToServer_unsafe(timeOutMsec);
 }
 
 #if defined(Q_OS_LINUX)
@@ -213,35 +161,9 @@ bool QtRedisClient::redisConnectUnix(const QString &sockPath,
         && _transporter->isConnected())
         return true;
 
-    if (!_transporter) {
-        _transporter = std::make_shared<QtRedisTransporter>(contextChannelMode);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextConnected,
-                         this, &QtRedisClient::contextConnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::contextDisconnected,
-                         this, &QtRedisClient::contextDisconnected,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelMessage,
-                         this, &QtRedisClient::incomingChannelMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelShardMessage,
-                         this, &QtRedisClient::incomingChannelShardMessage,
-                         Qt::QueuedConnection);
-        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelPatternMessage,
-                         this, &QtRedisClient::incomingChannelPatternMessage,
-                         Qt::QueuedConnection);
-    } else {
-        _transporter->clearTransporter();
-    }
-    QString error;
-    if (!_transporter->initTransporter(QtRedisTransporter::Type::Unix, sockPath, -1, error)) {
-        this->setLastError_safe(error);
+    if (!this->setupTransporter_unsafe(QtRedisTransporter::Type::Unix, sockPath, -1, contextChannelMode))
         return false;
-    }
-    const bool isOk = _transporter->connectToServer(error, timeOutMsec);
-    if (!isOk)
-        this->setLastError_safe(error);
-    return isOk;
+    return this->connectToServer_unsafe(timeOutMsec);
 }
 #endif
 
@@ -250,6 +172,9 @@ bool QtRedisClient::redisConnectUnix(const QString &sockPath,
 //! \param timeOutMsec Время ожидания в мсек
 //! \return
 //!
+//! The state of the session (AUTH, HELLO, CLIENT SETNAME, SELECT, the scripts and the subscriptions)
+//! is restored by one pipeline (see QtRedisTransporter::restoreSession()).
+//!
 bool QtRedisClient::redisReconnect(const int timeOutMsec)
 {
     QMutexLocker lock(&_mutex);
@@ -258,12 +183,83 @@ bool QtRedisClient::redisReconnect(const int timeOutMsec)
         return false;
     }
     QString error;
-    const bool isOk = _transporter->reconnectToServer(error, timeOutMsec);
+    const bool isOk = _transporter->reconnectToServer(error, timeOutMsec)
+                      && _transporter->restoreSession(error);
     if (!isOk)
         this->setLastError_safe(error);
     return isOk;
 }
 
+//!
+//! \brief Включить (выключить) автоматическое переподключение
+//! \param enable Включить режим
+//! \param minDelayMsec Задержка первой попытки в мсек
+//! \param maxDelayMsec Максимальная задержка в мсек
+//!
+//! When the connection is lost, the client reconnects with the exponential backoff (the delay is doubled
+//! from minDelayMsec up to maxDelayMsec, with the random jitter) and restores the state of the session
+//! by one pipeline, then the signal contextRestored is emitted.
+//!
+//! Note: Disabled by default.
+//! Note: The attempts are made in the thread of the client, it requires the event loop.
+//! Note: The connection closed by redisDisconnect() is not restored.
+//!
+void QtRedisClient::redisSetAutoReconnect(const bool enable, const int minDelayMsec, const int maxDelayMsec)
+{
+    QMutexLocker lock(&_mutex);
+    _isAutoReconnect = enable;
+    _reconnectMinDelayMsec = minDelayMsec;
+    _reconnectMaxDelayMsec = maxDelayMsec;
+    if (_transporter)
+        _transporter->setAutoReconnect(_isAutoReconnect, _reconnectMinDelayMsec, _reconnectMaxDelayMsec);
+}
+
+//!
+//! \brief Включено ли автоматическое переподключение
+//! \return
+//!
+bool QtRedisClient::redisIsAutoReconnect()
+{
+    QMutexLocker lock(&_mutex);
+    return _isAutoReconnect;
+}
+
+//!
+//! \brief Задать параметры подключения
+//! \param options Параметры подключения
+//! \return
+//!
+//! The options (AUTH, HELLO, CLIENT SETNAME, SELECT) are sent in one pipeline right after the connect
+//! and all replies are checked together, instead of the round trip of each redisAuth(), redisHello(),
+//! redisClientSetName() and redisSelect() call. If any command fails, the connect fails and the connection is closed.
+//!
+//! Note: Applied on the next connect (redisConnect(), redisConnectEncrypted(), redisConnectUnix()).
+//!
+bool QtRedisClient::redisSetConnectionOptions(const QtRedisTransporter::ConnectionOptions &options)
+{
+    QMutexLocker lock(&_mutex);
+    if (options.protocolVersion != 2 && options.protocolVersion != 3) {
+        this->setLastError_safe("Invalid protocol version!");
+        return false;
+    }
+    if (options.dbIndex < 0) {
+        this->setLastError_safe("Invalid db index!");
+        return false;
+    }
+    _connectionOptions = options;
+    return true;
+}
+
+//!
+//! \brief Параметры подключения
+//! \return
+//!
+QtRedisTransporter::ConnectionOptions QtRedisClient::redisConnectionOptions()
+{
+    QMutexLocker lock(&_mutex);
+    return _connectionOptions;
+}
+
 //!
 //! \brief Отключиться от сервера Redis
 //!
@@ -342,9 +338,62 @@ void QtRedisClient::redisDisconnect()
 //!
 bool QtRedisClient::redisAuth(const QString &password)
 {
-    QStringList argv;
-    argv << "AUTH" << password;
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(argv));
+    const bool isOk = QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("AUTH") << password));
+    if (isOk) {
+        QMutexLocker lock(&_mutex);
+        this->loadScripts_unsafe(); // the scripts are not loaded before the authentication
+    }
+    return isOk;
+}
+
+//!
+//! \brief Выполнить команду HELLO (выбор версии протокола)
+//! \param protocolVersion Версия протокола (2 или 3)
+//! \return
+//!
+//! Redis command: HELLO
+//!
+//! Syntax
+//!
+//! HELLO [protover [AUTH username password] [SETNAME clientname]]
+//!
+//! Available since:
+//!     6.0.0
+//! Time complexity:
+//!     O(1)
+//! ACL categories:
+//!     @fast, @connection
+//!
+//! Switch to a different protocol, optionally authenticating and setting the connection's name,
+//! or provide a contextual client report.
+//!
+//! Redis version 6 and above supports two protocols: the old protocol, RESP2, and a new one introduced with Redis 6, RESP3.
+//! RESP3 has certain advantages since when the connection is in this mode, Redis is able to reply with more semantical replies:
+//! for instance, HGETALL will return a map type, so a client library implementation no longer requires
+//! to know in advance to translate the array into a hash before returning it to the caller.
+//!
+//! RESP2/RESP3 Reply
+//! Map reply: a list of server properties. Simple error reply: if the protover requested does not exist.
+//!
+//! Note: Push messages of the subscribed channels are emitted by the incomingChannel* signals in both protocols.
+//!
+bool QtRedisClient::redisHello(const int protocolVersion)
+{
+    if (protocolVersion != 2 && protocolVersion != 3) {
+        this->setLastError_safe("Invalid protocol version!");
+        return false;
+    }
+    const QtRedisReply reply = this->redisExecCommand(QtRedisCommand("HELLO") << protocolVersion);
+    if (!reply.isMap() && !reply.isArray())
+        return false;
+
+    QMutexLocker lock(&_mutex);
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return false;
+    }
+    _transporter->setProtocolVersion(protocolVersion);
+    return true;
 }
 
 //!
@@ -391,12 +440,11 @@ bool QtRedisClient::redisAuth(const QString &password)
 //!
 bool QtRedisClient::redisPing(const QString &msg)
 {
-    QStringList argv;
-    argv << "PING";
+    QtRedisCommand command("PING");
     if (!msg.isEmpty())
-        argv << msg;
+        command << msg;
 
-    const QtRedisReply buffReply = this->redisExecCommand(argv);
+    const QtRedisReply buffReply = this->redisExecCommand(command);
     if (msg.isEmpty()) {
         if (buffReply.type() != QtRedisReply::ReplyType::Status) {
             this->setLastError_safe("Invalid reply type!");
@@ -448,9 +496,7 @@ bool QtRedisClient::redisPing(const QString &msg)
 //!
 QtRedisReply QtRedisClient::redisEcho(const QString &msg)
 {
-    QStringList argv;
-    argv << "ECHO" << msg;
-    return this->redisExecCommand(argv);
+    return this->redisExecCommand(QtRedisCommand("ECHO") << msg);
 }
 
 //!
@@ -932,11 +978,11 @@ QMap<QString, QVariant> QtRedisClient::redisInfo(const QString &section)
         return QMap<QString, QVariant>();
     }
 
-    QString command("INFO");
+    QtRedisCommand command("INFO");
     if (!section.isEmpty())
-        command += QString(" %1").arg(section.toLower());
+        command << section.toLower();
 
-    const QtRedisReply buffReply = this->redisExecCommand(command.trimmed());
+    const QtRedisReply buffReply = this->redisExecCommand(command);
     if (buffReply.type() != QtRedisReply::ReplyType::String) {
         this->setLastError_safe("Invalid reply type!");
         return QMap<QString, QVariant>();
@@ -977,7 +1023,7 @@ QMap<QString, QVariant> QtRedisClient::redisInfo(const QString &section)
 //!
 QtRedisReply QtRedisClient::redisTime()
 {
-    return this->redisExecCommand(QString("TIME"));
+    return this->redisExecCommand(QtRedisCommand("TIME"));
 }
 
 //!
@@ -1022,7 +1068,7 @@ bool QtRedisClient::redisSelect(const int dbIndex)
         this->setLastError_safe("Invalid db index!");
         return false;
     }
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QString("SELECT %1").arg(dbIndex)));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("SELECT") << dbIndex));
 }
 
 //!
@@ -1045,6 +1091,26 @@ int QtRedisClient::redisSelectedDb()
     return _transporter->currentDbIndex();
 }
 
+//!
+//! \brief Версия протокола RESP текущего соединения
+//! \return
+//!
+//! New connections always use RESP2, use redisHello() to switch the protocol.
+//!
+int QtRedisClient::redisProtocolVersion()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return -1;
+    }
+    if (!_transporter->isConnected()) {
+        this->setLastError_safe("Client is not connected!");
+        return -1;
+    }
+    return _transporter->protocolVersion();
+}
+
 //!
 //! \brief Количество ключей в текущей БД
 //! \return
@@ -1069,7 +1135,7 @@ int QtRedisClient::redisSelectedDb()
 //!
 qlonglong QtRedisClient::redisDbSize()
 {
-    const QtRedisReply buffReply = this->redisExecCommand(QString("DBSIZE"));
+    const QtRedisReply buffReply = this->redisExecCommand(QtRedisCommand("DBSIZE"));
     if (buffReply.type() != QtRedisReply::ReplyType::Integer) {
         this->setLastError_safe("Invalid reply type!");
         return -1;
@@ -1121,9 +1187,9 @@ qlonglong QtRedisClient::redisDbSize()
 bool QtRedisClient::redisFlushAll(const bool async)
 {
     // TODO add flag SYNC!
-    QString command("FLUSHALL");
+    QtRedisCommand command("FLUSHALL");
     if (async)
-        command += QString(" ASYNC");
+        command << "ASYNC";
     return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(command));
 }
 
@@ -1171,9 +1237,9 @@ bool QtRedisClient::redisFlushAll(const bool async)
 bool QtRedisClient::redisFlushDb(const bool async)
 {
     // TODO add flag SYNC!
-    QString command("FLUSHDB");
+    QtRedisCommand command("FLUSHDB");
     if (async)
-        command += QString(" ASYNC");
+        command << "ASYNC";
     return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(command));
 }
 
@@ -1210,7 +1276,7 @@ bool QtRedisClient::redisFlushDb(const bool async)
 //!
 bool QtRedisClient::redisSave()
 {
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QString("SAVE")));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("SAVE")));
 }
 
 //!
@@ -1254,7 +1320,7 @@ bool QtRedisClient::redisSave()
 QtRedisReply QtRedisClient::redisBgSave()
 {
     // TODO add flag SCHEDULE
-    return this->redisExecCommand(QString("BGSAVE"));
+    return this->redisExecCommand(QtRedisCommand("BGSAVE"));
 }
 
 //!
@@ -1282,7 +1348,7 @@ QtRedisReply QtRedisClient::redisBgSave()
 //!
 uint QtRedisClient::redisLastSave()
 {
-    const QtRedisReply buffReply = this->redisExecCommand(QString("LASTSAVE"));
+    const QtRedisReply buffReply = this->redisExecCommand(QtRedisCommand("LASTSAVE"));
     if (buffReply.type() != QtRedisReply::ReplyType::Integer) {
         this->setLastError_safe("Invalid reply type!");
         return 0;
@@ -1356,7 +1422,7 @@ QtRedisReply QtRedisClient::redisConfigGet(const QString &param)
         this->setLastError_safe("Invalid param!");
         return QtRedisReply();
     }
-    return this->redisExecCommand(QString("CONFIG GET %1").arg(param));
+    return this->redisExecCommand(QtRedisCommand("CONFIG") << "GET" << param);
 }
 
 //!
@@ -1412,9 +1478,7 @@ bool QtRedisClient::redisConfigSet(const QString &param, const QString &value)
         this->setLastError_safe("Invalid param!");
         return false;
     }
-    QStringList argv;
-    argv << "CONFIG SET" << param << value;
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(argv));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("CONFIG") << "SET" << param << value));
 }
 
 //!
@@ -1462,7 +1526,7 @@ bool QtRedisClient::redisConfigSet(const QString &param, const QString &value)
 //!
 bool QtRedisClient::redisConfigReWrite()
 {
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QString("CONFIG REWRITE")));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("CONFIG") << "REWRITE"));
 }
 
 //!
@@ -1498,7 +1562,7 @@ bool QtRedisClient::redisConfigReWrite()
 //!
 bool QtRedisClient::redisConfigResetStat()
 {
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QString("CONFIG RESETSTAT")));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("CONFIG") << "RESETSTAT"));
 }
 
 
@@ -1604,12 +1668,12 @@ bool QtRedisClient::redisConfigResetStat()
 //!
 QList<QtRedisClientInfo> QtRedisClient::redisClientList()
 {
-    const QtRedisReply buffReply = this->redisExecCommand(QString("CLIENT LIST"));
+    const QtRedisReply buffReply = this->redisExecCommand(QtRedisCommand("CLIENT") << "LIST");
     if (buffReply.type() != QtRedisReply::ReplyType::String) {
         this->setLastError_safe("Invalid reply type!");
         return QList<QtRedisClientInfo>();
     }
-    return QtRedisClientInfo::fromRawData(buffReply.rawValue_ref());
+    return QtRedisClientInfo::fromRawData(buffReply.rawValue());
 }
 
 //!
@@ -1656,7 +1720,7 @@ bool QtRedisClient::redisClientSetName(const QString &connectionName)
         this->setLastError_safe("Invalid connection name!");
         return false;
     }
-    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QString("CLIENT SETNAME %1").arg(connectionName)));
+    return QtRedisReply::replySimpleStringToBool(this->redisExecCommand(QtRedisCommand("CLIENT") << "SETNAME" << connectionName));
 }
 
 //!
@@ -1693,7 +1757,7 @@ bool QtRedisClient::redisClientSetName(const QString &connectionName)
 //!
 QString QtRedisClient::redisClientGetName()
 {
-    return QtRedisReply::replyToString(this->redisExecCommand(QString("CLIENT GETNAME")));
+    return QtRedisReply::replyToString(this->redisExecCommand(QtRedisCommand("CLIENT") << "GETNAME"));
 }
 
 //!
@@ -1783,9 +1847,9 @@ bool QtRedisClient::redisClientKill(const QString &ip, const uint port)
         this->setLastError_safe("Invalid port!");
         return false;
     }
-    QStringList argv;
-    argv << "CLIENT" << "KILL" << "ADDR" << QString("%1:%2").arg(ip).arg(port);
-    return QtRedisReply::replyIntToBool(this->redisExecCommand(argv));
+    QtRedisCommand command("CLIENT");
+    command << "KILL" << "ADDR" << QString("%1:%2").arg(ip).arg(port);
+    return QtRedisReply::replyIntToBool(this->redisExecCommand(command));
 }
 
 //!
@@ -1870,7 +1934,7 @@ bool QtRedisClient::redisClientKill(const QString &id)
         this->setLastError_safe("Invalid ID!");
         return false;
     }
-    return QtRedisReply::replyIntToBool(this->redisExecCommand(QString("CLIENT KILL ID %1").arg(id)));
+    return QtRedisReply::replyIntToBool(this->redisExecCommand(QtRedisCommand("CLIENT") << "KILL" << "ID" << id));
 }
 
 
@@ -1911,11 +1975,11 @@ bool QtRedisClient::redisClientKill(const QString &id)
 //!
 QStringList QtRedisClient::redisPubSubChannels(const QString &pattern)
 {
-    QStringList argv;
-    argv << "PUBSUB" << "CHANNELS";
+    QtRedisCommand command("PUBSUB");
+    command << "CHANNELS";
     if (!pattern.trimmed().isEmpty())
-        argv << pattern.trimmed();
-    return QtRedisReply::replyToStringList(this->redisExecCommand(argv));
+        command << pattern.trimmed();
+    return QtRedisReply::replyToStringList(this->redisExecCommand(command));
 }
 
 //!
@@ -1948,9 +2012,7 @@ QStringList QtRedisClient::redisPubSubChannels(const QString &pattern)
 //!
 qlonglong QtRedisClient::redisPubSubNumPat()
 {
-    QStringList argv;
-    argv << "PUBSUB" << "NUMPAT";
-    return QtRedisReply::replyToLong(this->redisExecCommand(argv));
+    return QtRedisReply::replyToLong(this->redisExecCommand(QtRedisCommand("PUBSUB") << "NUMPAT"));
 }
 
 //!
@@ -2022,11 +2084,9 @@ QMap<QString, qlonglong> QtRedisClient::redisPubSubNumSub(const QStringList &cha
     QStringList tmpChannels = channels;
     tmpChannels.removeAll(QString());
     // make args
-    QStringList argv;
-    argv << "PUBSUB" << "NUMSUB";
-    if (!tmpChannels.isEmpty())
-        argv << tmpChannels;
-    const QtRedisReply reply = this->redisExecCommand(argv);
+    QtRedisCommand command("PUBSUB");
+    command << "NUMSUB" << tmpChannels;
+    const QtRedisReply reply = this->redisExecCommand(command);
     if (reply.arrayValueSize() != tmpChannels.size() * 2)
         return QMap<QString, qlonglong>();
     // parse result
@@ -2078,11 +2138,11 @@ QMap<QString, qlonglong> QtRedisClient::redisPubSubNumSub(const QStringList &cha
 //!
 QStringList QtRedisClient::redisPubSubShardChannels(const QString &pattern)
 {
-    QStringList argv;
-    argv << "PUBSUB" << "SHARDCHANNELS";
+    QtRedisCommand command("PUBSUB");
+    command << "SHARDCHANNELS";
     if (!pattern.trimmed().isEmpty())
-        argv << pattern;
-    return QtRedisReply::replyToStringList(this->redisExecCommand(argv));
+        command << pattern;
+    return QtRedisReply::replyToStringList(this->redisExecCommand(command));
 }
 
 //!
@@ -2164,11 +2224,9 @@ QMap<QString, qlonglong> QtRedisClient::redisPubSubShardNumSub(const QStringList
     QStringList tmpChannels = shardChannels;
     tmpChannels.removeAll(QString());
     // make args
-    QStringList argv;
-    argv << "PUBSUB" << "SHARDNUMSUB";
-    if (!tmpChannels.isEmpty())
-        argv << tmpChannels;
-    const QtRedisReply reply = this->redisExecCommand(argv);
+    QtRedisCommand command("PUBSUB");
+    command << "SHARDNUMSUB" << tmpChannels;
+    const QtRedisReply reply = this->redisExecCommand(command);
     if (reply.arrayValueSize() != tmpChannels.size() * 2)
         return QMap<QString, qlonglong>();
     // parse result
@@ -2249,9 +2307,7 @@ qlonglong QtRedisClient::redisPublish(const QString &channel, const QByteArray &
         this->setLastError_safe("Invalid input arguments!");
         return -1;
     }
-    QList<QByteArray> argv;
-    argv << "PUBLISH" << channel.trimmed().toUtf8() << message;
-    return QtRedisReply::replyToLong(this->redisExecCommand(argv));
+    return QtRedisReply::replyToLong(this->redisExecCommand(QtRedisCommand("PUBLISH") << channel.trimmed() << message));
 }
 
 //!
@@ -2343,9 +2399,7 @@ qlonglong QtRedisClient::redisSPublish(const QString &shardChannel, const QByteA
         this->setLastError_safe("Invalid input arguments!");
         return -1;
     }
-    QList<QByteArray> argv;
-    argv << "SPUBLISH" << shardChannel.trimmed().toUtf8() << message;
-    return QtRedisReply::replyToLong(this->redisExecCommand(argv));
+    return QtRedisReply::replyToLong(this->redisExecCommand(QtRedisCommand("SPUBLISH") << shardChannel.trimmed() << message));
 }
 
 //!
@@ -2822,6 +2876,138 @@ bool QtRedisClient::redisSUnsubscribe(const QStringList &shardChannels)
     return this->redisUnsubscribe_safe("SUNSUBSCRIBE", shardChannels);
 }
 
+//!
+//! \brief Задать функцию обработки сообщений канала
+//! \param channel Канал (шаблон для redisPSubscribe())
+//! \param handler Функция обработки (пустая функция удаляет обработчик)
+//!
+//! Fast path for high message rates: the channel and the payload are passed as QByteArray
+//! directly by the thread that reads the connection, the signal incomingChannelMessage (incomingChannelShardMessage,
+//! incomingChannelPatternMessage) is not emitted for the channel.
+//!
+//! Note: The handler may be set before the connect. The channel must be subscribed by redisSubscribe() (redisSSubscribe(), redisPSubscribe()).
+//! Warn: The handler is called in the thread of the transporter (not the thread of the receiver), it must not block!
+//!
+void QtRedisClient::redisSetChannelHandler(const QString &channel, const QtRedisTransporter::MessageHandler &handler)
+{
+    QMutexLocker lock(&_mutex);
+    if (handler)
+        _channelHandlers.insert(channel.toUtf8(), handler);
+    else
+        _channelHandlers.remove(channel.toUtf8());
+    if (_transporter)
+        _transporter->setChannelHandler(channel.toUtf8(), handler);
+}
+
+//!
+//! \brief Задать функцию обработки пакета сообщений каналов
+//! \param handler Функция обработки (пустая функция выключает пакетную обработку)
+//!
+//! The messages of the channels without the handler (see redisSetChannelHandler()) received by one read
+//! of the connection are passed to the handler by one call instead of the signals.
+//!
+//! Warn: The handler is called in the thread of the transporter (not the thread of the receiver), it must not block!
+//!
+void QtRedisClient::redisSetChannelBatchHandler(const QtRedisTransporter::MessageBatchHandler &handler)
+{
+    QMutexLocker lock(&_mutex);
+    _channelBatchHandler = handler;
+    if (_transporter)
+        _transporter->setChannelBatchHandler(handler);
+}
+
+//!
+//! \brief Задать ограниченную очередь сообщений каналов
+//! \param limit Размер очереди (0 - без очереди)
+//! \param policy Политика переполнения очереди
+//!
+//! The signals incomingChannelMessage (incomingChannelShardMessage, incomingChannelPatternMessage)
+//! are emitted from the queue in the thread of the client, at most one event is waiting in its event loop.
+//! So the slow receiver does not accumulate the queued signals, the messages beyond the limit are handled
+//! by the policy (see QtRedisTransporter::setChannelQueue()).
+//!
+//! Note: Disabled by default (the messages are delivered by the queued signals without limit).
+//! Note: The receivers in other threads still get the signals by their own event loops.
+//!
+void QtRedisClient::redisSetChannelQueue(const int limit, const QtRedisTransporter::ChannelQueuePolicy policy)
+{
+    QMutexLocker lock(&_mutex);
+    _channelQueueLimit = qMax(limit, 0);
+    _channelQueuePolicy = policy;
+    if (_transporter)
+        _transporter->setChannelQueue(_channelQueueLimit, _channelQueuePolicy);
+}
+
+//!
+//! \brief Количество сообщений в очереди сообщений каналов
+//! \return
+//!
+int QtRedisClient::redisChannelQueueSize()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_transporter)
+        return 0;
+    return _transporter->channelQueueSize();
+}
+
+//!
+//! \brief Количество сообщений каналов, отброшенных по политике переполнения очереди
+//! \return
+//!
+qint64 QtRedisClient::redisChannelMessagesDropped()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_transporter)
+        return 0;
+    return _transporter->channelMessagesDropped();
+}
+
+
+// ------------------------------------------------------------------------
+// -- SCRIPTING COMMANDS --------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Зарегистрировать скрипт
+//! \param script Скрипт
+//! \return
+//!
+//! The registered scripts are loaded into the script cache of the server (SCRIPT LOAD) after the connect,
+//! the reconnect and the authentication, so the first call of redisEvalScript() does not send the body.
+//! If the client is connected, the script is loaded at once.
+//!
+//! Note: The scripts called by redisEvalScript() are registered automatically.
+//!
+bool QtRedisClient::redisRegisterScript(const QtRedisScript &script)
+{
+    QMutexLocker lock(&_mutex);
+    if (!script.isValid()) {
+        this->setLastError_safe("Invalid script!");
+        return false;
+    }
+    if (!_scripts.contains(script))
+        _scripts.append(script);
+    if (!_transporter || !_transporter->isConnected())
+        return true; // loaded after the connect
+    this->clearLastError_safe();
+    QString error;
+    if (!_transporter->loadScripts(QList<QtRedisScript>() << script, error)) {
+        this->setLastError_safe(error);
+        return false;
+    }
+    return true;
+}
+
+//!
+//! \brief Список зарегистрированных скриптов
+//! \return
+//!
+QList<QtRedisScript> QtRedisClient::redisRegisteredScripts()
+{
+    QMutexLocker lock(&_mutex);
+    return _scripts;
+}
+
 
 // ------------------------------------------------------------------------
 // -- Pipeline & Transaction COMMANDS -------------------------------------
@@ -2866,6 +3052,220 @@ QtRedisTransaction QtRedisClient::createTransaction(const bool piped)
     return QtRedisTransaction(_transporter, piped);
 }
 
+//!
+//! \brief Включить (выключить) режим автоматической конвейеризации команд
+//! \param enable Включить режим
+//!
+//! In this mode the commands of the concurrent callers (threads) are not serialized by the round trip:
+//! commands submitted while another caller waits for the reply are coalesced into one write,
+//! and the replies are matched back to the callers in FIFO order.
+//!
+//! Note: Disabled by default.
+//! Note: In this mode lastError() and hasLastError() return the error of the calling thread.
+//!
+void QtRedisClient::redisSetAutoPipelining(const bool enable)
+{
+    QMutexLocker lock(&_mutex);
+    _isAutoPipelining = enable;
+    this->setLastErrorPerThread_safe(enable);
+}
+
+//!
+//! \brief Включен ли режим автоматической конвейеризации команд
+//! \return
+//!
+bool QtRedisClient::redisIsAutoPipelining()
+{
+    QMutexLocker lock(&_mutex);
+    return _isAutoPipelining;
+}
+
+//!
+//! \brief Включить (выключить) режим потока ввода-вывода
+//! \param enable Включить режим
+//!
+//! In this mode the sockets live in the dedicated I/O thread with its own event loop: the socket
+//! keeps the thread affinity of Qt, the commands are written by the I/O thread (the data of the concurrent
+//! callers is coalesced through the lock-free queue), and the callers wait for the received data
+//! without touching the socket (see QtRedisContextIo).
+//!
+//! Note: Disabled by default. Applied on the next connect (redisConnect(), redisConnectEncrypted(), redisConnectUnix()).
+//! Note: The replies are still returned to the caller (synchronous commands, redisExecCommandDeferred())
+//! or to the callback (redisExecCommandAsync()).
+//!
+void QtRedisClient::redisSetIoThreadMode(const bool enable)
+{
+    QMutexLocker lock(&_mutex);
+    _isIoThreadMode = enable;
+}
+
+//!
+//! \brief Включен ли режим потока ввода-вывода
+//! \return
+//!
+bool QtRedisClient::redisIsIoThreadMode()
+{
+    QMutexLocker lock(&_mutex);
+    return _isIoThreadMode;
+}
+
+
+// ------------------------------------------------------------------------
+// -- COMPACT REPLY COMMANDS ----------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Выполнить команду и получить ответ в компактном виде
+//! \param command Команда
+//! \return
+//!
+//! Note: Recommended for commands with large aggregate replies (HGETALL, ZRANGE WITHSCORES, etc.).
+//! Note: Use QtRedisReplyTree::toReply() to get the QtRedisReply object.
+//!
+QtRedisReplyTree QtRedisClient::redisExecCommandTree(const QtRedisCommand &command)
+{
+    QMutexLocker lock(&_mutex);
+    if (!command.isValid()) {
+        this->setLastError_safe("Command is Invalid!");
+        return QtRedisReplyTree();
+    }
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return QtRedisReplyTree();
+    }
+    if (!_transporter->isConnected()) {
+        this->setLastError_safe("Client is not connected!");
+        return QtRedisReplyTree();
+    }
+    this->clearLastError_safe();
+    QString error;
+    bool isOk = false;
+    const QtRedisReplyTree reply = _transporter->sendCommandTree(command, error, &isOk);
+    if (!error.isEmpty())
+        this->setLastError_safe(error);
+    return reply;
+}
+
+// ------------------------------------------------------------------------
+// -- ASYNC COMMANDS ------------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Выполнить команду без блокировки вызывающего потока
+//! \param command Команда
+//! \param callback Функция обработки ответа
+//! \return
+//!
+//! Returns true if the command is sent to the server. The reply (or the error message)
+//! is passed to the callback when it is received. Commands sent by this method can be
+//! in flight at the same time, the callbacks are called in the order of sending.
+//!
+//! Note: The callback is called in the thread that created the connection (requires the event loop).
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
+//!
+bool QtRedisClient::redisExecCommandAsync(const QtRedisCommand &command, const QtRedisTransporter::ReplyCallback &callback)
+{
+    QMutexLocker lock(&_mutex);
+    if (!command.isValid()) {
+        this->setLastError_safe("Command is Invalid!");
+        return false;
+    }
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return false;
+    }
+    if (!_transporter->isConnected()) {
+        this->setLastError_safe("Client is not connected!");
+        return false;
+    }
+    this->clearLastError_safe();
+    QString error;
+    if (!_transporter->sendCommandAsync(command, callback, error)) {
+        this->setLastError_safe(error);
+        return false;
+    }
+    return true;
+}
+
+//!
+//! \brief Количество асинхронных команд, ожидающих ответа
+//! \return
+//!
+int QtRedisClient::redisAsyncRequestsCount()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return -1;
+    }
+    return _transporter->asyncRequestsCount();
+}
+
+//!
+//! \brief Отправить команду, ответ на которую будет получен позже
+//! \param command Команда
+//! \return
+//!
+//! The command is sent at once, the reply is taken by redisWaitDeferred().
+//! Unlike redisExecCommandAsync(), the event loop is not required, so the caller can overlap
+//! its own work with the round trip (e.g. request the next page while processing the current one).
+//!
+//! Note: Returns nullptr on error (see lastError()).
+//! Warn: Commands with multiple replies (SUBSCRIBE, etc.) are not supported!
+//!
+QtRedisTransporter::DeferredRequest QtRedisClient::redisExecCommandDeferred(const QtRedisCommand &command)
+{
+    QMutexLocker lock(&_mutex);
+    if (!command.isValid()) {
+        this->setLastError_safe("Command is Invalid!");
+        return nullptr;
+    }
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return nullptr;
+    }
+    if (!_transporter->isConnected()) {
+        this->setLastError_safe("Client is not connected!");
+        return nullptr;
+    }
+    this->clearLastError_safe();
+    QString error;
+    const QtRedisTransporter::DeferredRequest request = _transporter->sendCommandDeferred(command, error);
+    if (!request)
+        this->setLastError_safe(error);
+    return request;
+}
+
+//!
+//! \brief Получить ответ на команду, отправленную методом redisExecCommandDeferred()
+//! \param request Отложенный запрос
+//! \return
+//!
+//! Note: The mutex of the client is released while waiting for the reply.
+//!
+QtRedisReply QtRedisClient::redisWaitDeferred(const QtRedisTransporter::DeferredRequest &request)
+{
+    QMutexLocker lock(&_mutex);
+    if (!request) {
+        this->setLastError_safe("Deferred request is NULL!");
+        return QtRedisReply();
+    }
+    if (!_transporter) {
+        this->setLastError_safe("QtRedisTransporter is NULL!");
+        return QtRedisReply();
+    }
+    this->clearLastError_safe();
+    const std::shared_ptr<QtRedisTransporter> transporter = _transporter;
+    QString error;
+    bool isOk = false;
+    lock.unlock();
+    const QtRedisReply reply = transporter->waitDeferredReply(request, error, &isOk);
+    lock.relock();
+    if (!error.isEmpty())
+        this->setLastError_safe(error);
+    return reply;
+}
+
 
 // ------------------------------------------------------------------------
 // -- TOOLS ---------------------------------------------------------------
@@ -2928,6 +3328,9 @@ QMap<QString, QVariant> QtRedisClient::redisInfoFromStringData(const QString &da
 //! \param command Команда
 //! \return
 //!
+//! Note: Called with the _mutex locked. In the auto-pipelining mode the mutex is released
+//! while waiting for the reply, so the commands of the concurrent callers are coalesced.
+//!
 QtRedisReply QtRedisClient::processCommand(const QtRedisCommand &command)
 {
     if (!_transporter) {
@@ -2941,12 +3344,135 @@ QtRedisReply QtRedisClient::processCommand(const QtRedisCommand &command)
     this->clearLastError_safe();
     QString error;
     bool isOk = false;
-    const QtRedisReply reply = _transporter->sendCommand(command, error, &isOk);
+    QtRedisReply reply;
+    if (_isAutoPipelining) {
+        const std::shared_ptr<QtRedisTransporter> transporter = _transporter;
+        _mutex.unlock();
+        reply = transporter->sendCommandPipelined(command, error, &isOk);
+        _mutex.lock();
+    } else {
+        reply = _transporter->sendCommand(command, error, &isOk);
+    }
     if (!error.isEmpty())
         this->setLastError_safe(error);
     return reply;
 }
 
+//!
+//! \brief Выполнить скрипт
+//! \param script Скрипт
+//! \param keyList Список ключей
+//! \param argList Список аргументов
+//! \return
+//!
+//! Note: Called with the _mutex locked. The body of the script is sent (EVAL) only on the NOSCRIPT error.
+//!
+QtRedisReply QtRedisClient::processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList)
+{
+    if (!_scripts.contains(script))
+        _scripts.append(script);
+    const QtRedisReply reply = this->processCommand(script.evalShaCommand(keyList, argList));
+    if (!QtRedisScript::isNoScriptError(reply))
+        return reply;
+
+    // the script cache of the server is empty (SCRIPT FLUSH, restart) -> EVAL caches the script again
+    return this->processCommand(script.evalCommand(keyList, argList));
+}
+
+//!
+//! \brief Создать (очистить) слой взаимодействия с redis перед подключением
+//! \param type Тип соединения
+//! \param host IP-адрес (полный путь до unix-сокета)
+//! \param port Порт
+//! \param contextChannelMode Тип работы в режиме подписки на каналы (применяется при создании)
+//! \return
+//!
+//! The new transporter is connected to the signals of the client and gets the channel handlers,
+//! the channel queue and the auto-reconnect settings. The existing transporter is cleared.
+//!
+bool QtRedisClient::setupTransporter_unsafe(const QtRedisTransporter::Type type,
+                                            const QString &host,
+                                            const int port,
+                                            const QtRedisTransporter::ChannelMode contextChannelMode)
+{
+    if (!_transporter) {
+        _transporter = std::make_shared<QtRedisTransporter>(contextChannelMode);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::contextConnected,
+                         this, &QtRedisClient::contextConnected,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::contextDisconnected,
+                         this, &QtRedisClient::contextDisconnected,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::contextRestored,
+                         this, &QtRedisClient::contextRestored,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelMessage,
+                         this, &QtRedisClient::incomingChannelMessage,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelShardMessage,
+                         this, &QtRedisClient::incomingChannelShardMessage,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::incomingChannelPatternMessage,
+                         this, &QtRedisClient::incomingChannelPatternMessage,
+                         Qt::QueuedConnection);
+        QObject::connect(_transporter.get(), &QtRedisTransporter::channelMessagesQueued,
+                         this, &QtRedisClient::onChannelMessagesQueued,
+                         Qt::QueuedConnection);
+        for (auto it = _channelHandlers.constBegin(); it != _channelHandlers.constEnd(); ++it)
+            _transporter->setChannelHandler(it.key(), it.value());
+        _transporter->setChannelBatchHandler(_channelBatchHandler);
+        _transporter->setChannelQueue(_channelQueueLimit, _channelQueuePolicy);
+        _transporter->setAutoReconnect(_isAutoReconnect, _reconnectMinDelayMsec, _reconnectMaxDelayMsec);
+    } else {
+        _transporter->clearTransporter();
+    }
+    QString error;
+    _transporter->setIoThreadMode(_isIoThreadMode);
+    if (!_transporter->initTransporter(type, host, port, error)) {
+        this->setLastError_safe(error);
+        return false;
+    }
+    return true;
+}
+
+//!
+//! \brief Подключиться к серверу и выполнить начальную настройку соединения
+//! \param timeOutMsec Время ожидания в мсек
+//! \return
+//!
+//! The connection options are sent in one pipeline (see redisSetConnectionOptions()),
+//! then the registered scripts are loaded.
+//!
+bool QtRedisClient::connectToServer_unsafe(const int timeOutMsec)
+{
+    QString error;
+    _transporter->setConnectionOptions(_connectionOptions);
+    if (!_transporter->connectToServer(error, timeOutMsec)) {
+        this->setLastError_safe(error);
+        return false;
+    }
+    if (!_transporter->restoreSession(error)) {
+        _transporter->disconnectFromServer(); // the connection is not configured
+        this->setLastError_safe(error);
+        return false;
+    }
+    this->loadScripts_unsafe();
+    return true;
+}
+
+//!
+//! \brief Загрузить зарегистрированные скрипты в кэш скриптов сервера
+//!
+//! Note: Errors are ignored (e.g. NOAUTH before the authentication), the script is loaded by EVAL on the first call.
+//!
+void QtRedisClient::loadScripts_unsafe()
+{
+    if (_scripts.isEmpty() || !_transporter)
+        return;
+    QString error;
+    _transporter->loadScripts(_scripts, error);
+}
+
 // --- private ---
 
 //!
@@ -2981,10 +3507,10 @@ bool QtRedisClient::redisSubscribe_safe(const QString &command, const QStringLis
         return false;
     }
     // make args
-    QStringList argv;
-    argv << command.trimmed().toUpper() << tmpChannels;
+    QtRedisCommand channelCommand(command.trimmed().toUtf8());
+    channelCommand << tmpChannels;
     bool isOk = false;
-    const QtRedisReply replyList = _transporter->sendChannelCommand(QtRedisCommand::fromString(argv.join(" ")), error, &isOk);
+    const QtRedisReply replyList = _transporter->sendChannelCommand(channelCommand, error, &isOk);
     if (!isOk) {
         this->setLastError_safe(error);
         return false;
@@ -2992,7 +3518,7 @@ bool QtRedisClient::redisSubscribe_safe(const QString &command, const QStringLis
 
     // if 1 channel - check reply
     if (tmpChannels.size() == 1
-        && replyList.type() == QtRedisReply::ReplyType::Array
+        && (replyList.isArray() || replyList.isPush())
         && replyList.arrayValueSize() == 3
         && replyList.arrayValue().at(0).strValue() == command.trimmed().toLower()
         && replyList.arrayValue().at(1).strValue() == tmpChannels.constFirst())
@@ -3012,7 +3538,7 @@ bool QtRedisClient::redisSubscribe_safe(const QString &command, const QStringLis
             this->setLastError_safe(reply.strValue());
 
         isOk = isOk
-               && reply.type() == QtRedisReply::ReplyType::Array
+               && (reply.isArray() || reply.isPush())
                && reply.arrayValueSize() == 3
                && reply.arrayValue().at(0).strValue() == command.trimmed().toLower()
                && reply.arrayValue().at(1).strValue() == channel;
@@ -3045,13 +3571,11 @@ bool QtRedisClient::redisUnsubscribe_safe(const QString &command, const QStringL
     QStringList tmpChannels = channels;
     tmpChannels.removeAll(QString());
     // make args
-    QStringList argv;
-    argv << command.trimmed().toUpper();
-    if (!tmpChannels.isEmpty())
-        argv << tmpChannels;
+    QtRedisCommand channelCommand(command.trimmed().toUtf8());
+    channelCommand << tmpChannels;
     QString error;
     bool isOk = false;
-    const QtRedisReply replyList = _transporter->sendChannelCommand(QtRedisCommand::fromString(argv.join(" ")), error, &isOk);
+    const QtRedisReply replyList = _transporter->sendChannelCommand(channelCommand, error, &isOk);
     if (!isOk) {
         this->setLastError_safe(error);
         return false;
@@ -3059,7 +3583,7 @@ bool QtRedisClient::redisUnsubscribe_safe(const QString &command, const QStringL
 
     // if 1 channel - check reply
     if (tmpChannels.size() == 1
-        && replyList.type() == QtRedisReply::ReplyType::Array
+        && (replyList.isArray() || replyList.isPush())
         && replyList.arrayValueSize() == 3
         && replyList.arrayValue().at(0).strValue() == command.trimmed().toLower()
         && replyList.arrayValue().at(1).strValue() == tmpChannels.constFirst())
@@ -3079,10 +3603,38 @@ bool QtRedisClient::redisUnsubscribe_safe(const QString &command, const QStringL
             this->setLastError_safe(reply.strValue());
 
         isOk = isOk
-               && reply.type() == QtRedisReply::ReplyType::Array
+               && (reply.isArray() || reply.isPush())
                && reply.arrayValueSize() == 3
                && reply.arrayValue().at(0).strValue() == command.trimmed().toLower()
                && reply.arrayValue().at(1).strValue() == channel;
     }
     return isOk;
 }
+
+// --- protected slots ---
+
+//!
+//! \brief Слот обработки сообщений каналов из очереди
+//!
+//! All queued messages are taken at once and the signals are emitted directly.
+//!
+void QtRedisClient::onChannelMessagesQueued()
+{
+    QMutexLocker lock(&_mutex);
+    const std::shared_ptr<QtRedisTransporter> transporter = _transporter;
+    lock.unlock();
+    if (!transporter)
+        return;
+    const QVector<QtRedisReply> replyList = transporter->takeChannelMessages();
+    for (const QtRedisReply &reply : replyList) {
+        const QVector<QtRedisReply> &values = reply.arrayValue_ref();
+        if (values.constFirst().rawValueView() == "message")
+            emit this->incomingChannelMessage(values.at(1).strValue(), values.at(2));
+
+        else if (values.constFirst().rawValueView() == "smessage")
+            emit this->incomingChannelShardMessage(values.at(1).strValue(), values.at(2));
+
+        else if (values.constFirst().rawValueView() == "pmessage")
+            emit this->incomingChannelPatternMessage(values.at(1).strValue(), values.at(2).strValue(), values.at(3));
+    }
+}
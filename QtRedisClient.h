@@ -4,6 +4,7 @@
 #include <QString>
 #include <QStringList>
 #include <QMap>
+#include <QHash>
 #include <QVariant>
 #include <QVector>
 #include <QMutex>
@@ -61,18 +62,26 @@ public:
 
     bool redisReconnect(const int timeOutMsec = -1);
 
+    bool redisSetConnectionOptions(const QtRedisTransporter::ConnectionOptions &options);
+    QtRedisTransporter::ConnectionOptions redisConnectionOptions();
+
+    void redisSetAutoReconnect(const bool enable, const int minDelayMsec = 100, const int maxDelayMsec = 30000);
+    bool redisIsAutoReconnect();
+
     void redisDisconnect();
 
     // ------------------------------------------------------------------------
     // -- SERVER COMMANDS -----------------------------------------------------
     // ------------------------------------------------------------------------
     bool redisAuth(const QString &password);
+    bool redisHello(const int protocolVersion = 3);
     bool redisPing(const QString &msg = QString());
     QtRedisReply redisEcho(const QString &msg);
     QMap<QString, QVariant> redisInfo(const QString &section = QString());
     QtRedisReply redisTime();
     bool redisSelect(const int dbIndex);
     int redisSelectedDb();
+    int redisProtocolVersion();
     qlonglong redisDbSize();
     bool redisFlushAll(const bool async = false);
     bool redisFlushDb(const bool async = false);
@@ -126,12 +135,47 @@ public:
     bool redisSUnsubscribe(const QString &shardChannel = QString());
     bool redisSUnsubscribe(const QStringList &shardChannels);
 
+    void redisSetChannelHandler(const QString &channel, const QtRedisTransporter::MessageHandler &handler);
+    void redisSetChannelBatchHandler(const QtRedisTransporter::MessageBatchHandler &handler);
+
+    void redisSetChannelQueue(const int limit,
+                              const QtRedisTransporter::ChannelQueuePolicy policy = QtRedisTransporter::ChannelQueuePolicy::DropOldest);
+    int redisChannelQueueSize();
+    qint64 redisChannelMessagesDropped();
+
+    // ------------------------------------------------------------------------
+    // -- SCRIPTING COMMANDS --------------------------------------------------
+    // ------------------------------------------------------------------------
+    bool redisRegisterScript(const QtRedisScript &script);
+    QList<QtRedisScript> redisRegisteredScripts();
+
     // ------------------------------------------------------------------------
     // -- Pipeline & Transaction COMMANDS -------------------------------------
     // ------------------------------------------------------------------------
     QtRedisPipeline createPipeline();
     QtRedisTransaction createTransaction(const bool piped = true);
 
+    void redisSetAutoPipelining(const bool enable);
+    bool redisIsAutoPipelining();
+
+    void redisSetIoThreadMode(const bool enable);
+    bool redisIsIoThreadMode();
+
+    // ------------------------------------------------------------------------
+    // -- COMPACT REPLY COMMANDS ----------------------------------------------
+    // ------------------------------------------------------------------------
+    QtRedisReplyTree redisExecCommandTree(const QtRedisCommand &command);
+
+    // ------------------------------------------------------------------------
+    // -- ASYNC COMMANDS ------------------------------------------------------
+    // ------------------------------------------------------------------------
+    bool redisExecCommandAsync(const QtRedisCommand &command,
+                               const QtRedisTransporter::ReplyCallback &callback = QtRedisTransporter::ReplyCallback());
+    int redisAsyncRequestsCount();
+
+    QtRedisTransporter::DeferredRequest redisExecCommandDeferred(const QtRedisCommand &command);
+    QtRedisReply redisWaitDeferred(const QtRedisTransporter::DeferredRequest &request);
+
     // ------------------------------------------------------------------------
     // -- TOOLS ---------------------------------------------------------------
     // ------------------------------------------------------------------------
@@ -140,16 +184,39 @@ public:
 
 protected:
     std::shared_ptr<QtRedisTransporter> _transporter {nullptr}; //!< слой взаимодействия с redis
+    bool _isAutoPipelining {false};                             //!< режим автоматической конвейеризации команд
+    bool _isIoThreadMode {false};                               //!< режим потока ввода-вывода (применяется при подключении)
+    bool _isAutoReconnect {false};                              //!< режим автоматического переподключения
+    int _reconnectMinDelayMsec {100};                           //!< задержка первой попытки переподключения мсек
+    int _reconnectMaxDelayMsec {30000};                         //!< максимальная задержка переподключения мсек
+    QtRedisTransporter::ConnectionOptions _connectionOptions;   //!< параметры подключения (применяются при подключении)
+    QList<QtRedisScript> _scripts;                              //!< зарегистрированные скрипты (загружаются после подключения)
+    QHash<QByteArray, QtRedisTransporter::MessageHandler> _channelHandlers;    //!< функции обработки сообщений каналов
+    QtRedisTransporter::MessageBatchHandler _channelBatchHandler;               //!< функция обработки пакета сообщений каналов
+    int _channelQueueLimit {0};                                                 //!< размер очереди сообщений каналов (0 - без очереди)
+    QtRedisTransporter::ChannelQueuePolicy _channelQueuePolicy {QtRedisTransporter::ChannelQueuePolicy::DropOldest}; //!< политика переполнения очереди
 
     QtRedisReply processCommand(const QtRedisCommand &command);
+    QtRedisReply processScript(const QtRedisScript &script, const QList<QByteArray> &keyList, const QList<QByteArray> &argList);
+    bool connectToServer_unsafe(const int timeOutMsec);
+    void loadScripts_unsafe();
+
+protected slots:
+    void onChannelMessagesQueued();
 
 private:
+    bool setupTransporter_unsafe(const QtRedisTransporter::Type type,
+                                 const QString &host,
+                                 const int port,
+                                 const QtRedisTransporter::ChannelMode contextChannelMode);
+
     bool redisSubscribe_safe(const QString &command, const QStringList &channels);
     bool redisUnsubscribe_safe(const QString &command, const QStringList &channels);
 
 signals:
     void contextConnected(QString contextUid, QString host, int port, int dbIndex);
     void contextDisconnected(QString contextUid, QString host, int port, int dbIndex);
+    void contextRestored(QString contextUid, QString host, int port, int dbIndex);
 
     void incomingChannelMessage(QString channel, QtRedisReply data);
     void incomingChannelShardMessage(QString shardChannel, QtRedisReply data);
@@ -0,0 +1,577 @@
+#include "QtRedisClientPool.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+
+//!
+//! \brief Конструктор класса
+//! \param mode Режим выдачи клиентов
+//! \param minSize Минимальное количество клиентов
+//! \param maxSize Максимальное количество клиентов
+//!
+//! In the Mode::Checkout mode the pool keeps at least minSize connections and creates
+//! new ones on demand up to maxSize. In the Mode::RoundRobin mode the pool keeps maxSize connections.
+//!
+QtRedisClientPool::QtRedisClientPool(const Mode mode, const int minSize, const int maxSize)
+    : QObject()
+    , _mode(mode)
+    , _minSize(qMax(minSize, 0))
+    , _maxSize(qMax(maxSize, qMax(minSize, 1)))
+    , _data(std::make_shared<Data>())
+    , _timer(new QTimer(this))
+{
+    connect(_timer, &QTimer::timeout, this, &QtRedisClientPool::onMaintenance);
+    _timer->start(1000);
+}
+
+//!
+//! \brief Деструктор класса
+//!
+//! Note: Checked out clients stay valid until they are released (they are disconnected on release).
+//!
+QtRedisClientPool::~QtRedisClientPool()
+{
+    _timer->stop();
+    this->redisDisconnect();
+}
+
+//!
+//! \brief Режим выдачи клиентов
+//! \return
+//!
+QtRedisClientPool::Mode QtRedisClientPool::mode() const
+{
+    return _mode;
+}
+
+//!
+//! \brief Минимальное количество клиентов
+//! \return
+//!
+int QtRedisClientPool::minSize() const
+{
+    return _minSize;
+}
+
+//!
+//! \brief Максимальное количество клиентов
+//! \return
+//!
+int QtRedisClientPool::maxSize() const
+{
+    return _maxSize;
+}
+
+//!
+//! \brief Задать время простоя клиента до отключения
+//! \param msec Время мсек (0 - не отключать)
+//!
+//! Note: Only for the Mode::Checkout mode. The pool keeps at least minSize clients.
+//!
+void QtRedisClientPool::setIdleTimeout(const int msec)
+{
+    QMutexLocker lock(&_data->mutex);
+    _idleTimeoutMSec = qMax(msec, 0);
+}
+
+//!
+//! \brief Время простоя клиента до отключения
+//! \return
+//!
+int QtRedisClientPool::idleTimeout() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _idleTimeoutMSec;
+}
+
+//!
+//! \brief Задать параметры соединения клиентов
+//! \param options Параметры соединения
+//!
+//! Each client of the pool sends the options in one pipeline right after the connect
+//! (see QtRedisClient::redisSetConnectionOptions()).
+//!
+//! Note: Applied on the next connect of the pool.
+//!
+void QtRedisClientPool::setConnectionOptions(const QtRedisTransporter::ConnectionOptions &options)
+{
+    QMutexLocker lock(&_data->mutex);
+    _connectionOptions = options;
+}
+
+//!
+//! \brief Параметры соединения клиентов
+//! \return
+//!
+QtRedisTransporter::ConnectionOptions QtRedisClientPool::connectionOptions() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _connectionOptions;
+}
+
+//!
+//! \brief Задать интервал проверки соединений
+//! \param msec Интервал мсек (0 - не проверять)
+//!
+//! Free clients are checked by the PING command, failed clients are reconnected or removed from the pool.
+//!
+void QtRedisClientPool::setHealthCheckInterval(const int msec)
+{
+    QMutexLocker lock(&_data->mutex);
+    _healthCheckMSec = qMax(msec, 0);
+}
+
+//!
+//! \brief Интервал проверки соединений
+//! \return
+//!
+int QtRedisClientPool::healthCheckInterval() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _healthCheckMSec;
+}
+
+//!
+//! \brief Есть ли ошибка
+//! \return
+//!
+bool QtRedisClientPool::hasLastError() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return !_data->lastError.isEmpty();
+}
+
+//!
+//! \brief Последняя ошибка
+//! \return
+//!
+QString QtRedisClientPool::lastError() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _data->lastError;
+}
+
+
+// ------------------------------------------------------------------------
+// -- CONNECT/DISCONNECT FUNCTIONS ----------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Подключен ли пул
+//! \return
+//!
+bool QtRedisClientPool::redisIsConnected() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _data->isOpen;
+}
+
+//!
+//! \brief Подключить пул к серверу Redis
+//! \param host IP-адрес
+//! \param port Порт
+//! \param timeOutMsec Время ожидания подключения мсек
+//! \return
+//!
+//! Данный метод использует протокол TCP.
+//!
+bool QtRedisClientPool::redisConnect(const QString &host, const int port, const int timeOutMsec)
+{
+    Config config;
+    config.type = QtRedisTransporter::Type::Tcp;
+    config.host = host;
+    config.port = port;
+    config.timeOutMsec = timeOutMsec;
+    return this->connectPool(config);
+}
+
+//!
+//! \brief Подключить пул к серверу Redis с использованием SSL/TLS
+//! \param host IP-адрес
+//! \param port Порт
+//! \param sslConfig SSL Конфигурация
+//! \param timeOutMsec Время ожидания подключения мсек
+//! \return
+//!
+//! Данный метод использует протокол TCP + SSL/TLS.
+//!
+bool QtRedisClientPool::redisConnectEncrypted(const QString &host,
+                                              const int port,
+                                              const QSslConfiguration sslConfig,
+                                              const int timeOutMsec)
+{
+    Config config;
+    config.type = QtRedisTransporter::Type::Ssl;
+    config.host = host;
+    config.port = port;
+    config.sslConfig = sslConfig;
+    config.timeOutMsec = timeOutMsec;
+    return this->connectPool(config);
+}
+
+#if defined(Q_OS_LINUX)
+//!
+//! \brief Подключить пул к серверу Redis через unix-сокет
+//! \param sockPath Путь к сокету
+//! \param timeOutMsec Время ожидания подключения мсек
+//! \return
+//!
+//! Данный метод использует unix-сокеты.
+//!
+bool QtRedisClientPool::redisConnectUnix(const QString &sockPath, const int timeOutMsec)
+{
+    Config config;
+    config.type = QtRedisTransporter::Type::Unix;
+    config.host = sockPath;
+    config.timeOutMsec = timeOutMsec;
+    return this->connectPool(config);
+}
+#endif
+
+//!
+//! \brief Отключить пул от сервера Redis
+//!
+//! Free clients are disconnected immediately, checked out clients are disconnected on release.
+//!
+void QtRedisClientPool::redisDisconnect()
+{
+    QMutexLocker lock(&_data->mutex);
+    const QList<Item> items = _data->items;
+    _data->items.clear();
+    _data->size -= items.size();
+    _data->isOpen = false;
+    _data->generation++;
+    _data->condition.wakeAll();
+    lock.unlock();
+    for (const Item &item : items)
+        item.client->redisDisconnect();
+}
+
+
+// ------------------------------------------------------------------------
+// -- POOL FUNCTIONS ------------------------------------------------------
+// ------------------------------------------------------------------------
+
+//!
+//! \brief Получить клиента из пула
+//! \param timeOutMsec Время ожидания свободного клиента мсек (-1 - без ограничения)
+//! \return
+//!
+//! Mode::Checkout - returns the free client (or connects the new one, if the pool size is less than maxSize),
+//! if all clients are checked out, waits for the release of the client. The client is returned to the pool
+//! when the last copy of the returned pointer is destroyed.
+//!
+//! Mode::RoundRobin - returns the next client of the pool, the client is shared between the callers.
+//!
+//! Note: If the client is not received, returns nullptr (see lastError()).
+//!
+std::shared_ptr<QtRedisClient> QtRedisClientPool::acquire(const int timeOutMsec)
+{
+    QMutexLocker lock(&_data->mutex);
+    _data->lastError.clear();
+    if (!_data->isOpen) {
+        _data->lastError = QString("Pool is not connected!");
+        return nullptr;
+    }
+    if (_mode == Mode::RoundRobin) {
+        if (_data->items.isEmpty()) {
+            _data->lastError = QString("Pool is empty!");
+            return nullptr;
+        }
+        _roundRobinIndex = (_roundRobinIndex + 1) % _data->items.size();
+        return _data->items.at(_roundRobinIndex).client;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    while (true) {
+        if (!_data->isOpen) {
+            _data->lastError = QString("Pool is not connected!");
+            return nullptr;
+        }
+        // take the most recently used client (the rest of clients can be evicted by idle timeout)
+        if (!_data->items.isEmpty())
+            return this->makeHandle(_data->items.takeLast().client, _data->generation);
+
+        if (_data->size < _maxSize) {
+            _data->size++;
+            const Config config = _data->config;
+            const int generation = _data->generation;
+            lock.unlock();
+            QString error;
+            const std::shared_ptr<QtRedisClient> client = this->makeClient(config, error);
+            lock.relock();
+            if (!client || generation != _data->generation) {
+                if (generation == _data->generation)
+                    _data->size--;
+                _data->lastError = client ? QString("Pool is reconnected!") : error;
+                _data->condition.wakeOne();
+                return nullptr;
+            }
+            return this->makeHandle(client, generation);
+        }
+
+        // wait for the release of the client
+        if (timeOutMsec < 0) {
+            _data->condition.wait(&_data->mutex);
+            continue;
+        }
+        const qint64 remainMsec = timeOutMsec - timer.elapsed();
+        if (remainMsec <= 0
+            || !_data->condition.wait(&_data->mutex, static_cast<unsigned long>(remainMsec))) {
+            _data->lastError = QString("Timeout waiting for a free client!");
+            return nullptr;
+        }
+    }
+}
+
+//!
+//! \brief Количество клиентов (включая выданные)
+//! \return
+//!
+int QtRedisClientPool::size() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _data->size;
+}
+
+//!
+//! \brief Количество свободных клиентов
+//! \return
+//!
+//! Note: In the Mode::RoundRobin mode all clients are free.
+//!
+int QtRedisClientPool::idleCount() const
+{
+    QMutexLocker lock(&_data->mutex);
+    return _data->items.size();
+}
+
+// --- protected ---
+
+//!
+//! \brief Подключить пул
+//! \param config Параметры подключения
+//! \return
+//!
+bool QtRedisClientPool::connectPool(const Config &config)
+{
+    if (config.host.isEmpty()
+        || (config.type != QtRedisTransporter::Type::Unix && config.port == 0)) {
+        QMutexLocker lock(&_data->mutex);
+        _data->lastError = QString("Invalid host or port!");
+        return false;
+    }
+    this->redisDisconnect();
+    QMutexLocker lock(&_data->mutex);
+    _data->lastError.clear();
+    _data->config = config;
+    _data->config.options = _connectionOptions;
+    _data->isOpen = true;
+    lock.unlock();
+    this->fillPool();
+
+    lock.relock();
+    if (!_data->lastError.isEmpty()) {
+        lock.unlock();
+        this->redisDisconnect();
+        return false;
+    }
+    return true;
+}
+
+//!
+//! \brief Создать и подключить клиента
+//! \param config Параметры подключения
+//! \param error Сообщение об ошибке
+//! \return
+//!
+std::shared_ptr<QtRedisClient> QtRedisClientPool::makeClient(const Config &config, QString &error) const
+{
+    error.clear();
+    std::shared_ptr<QtRedisClient> client = std::make_shared<QtRedisClient>();
+    if (!client->redisSetConnectionOptions(config.options)) {
+        error = client->lastError();
+        return nullptr;
+    }
+    bool isOk = false;
+    switch (config.type) {
+        case QtRedisTransporter::Type::Tcp:
+            isOk = client->redisConnect(config.host, config.port, config.timeOutMsec);
+            break;
+        case QtRedisTransporter::Type::Ssl:
+            isOk = client->redisConnectEncrypted(config.host, config.port, config.sslConfig, config.timeOutMsec);
+            break;
+#if defined(Q_OS_LINUX)
+        case QtRedisTransporter::Type::Unix:
+            isOk = client->redisConnectUnix(config.host, config.timeOutMsec);
+            break;
+#endif
+        default:
+            error = QString("Invalid connection type!");
+            return nullptr;
+    }
+    if (!isOk) {
+        error = client->lastError();
+        return nullptr;
+    }
+    return client;
+}
+
+//!
+//! \brief Создать указатель на выданного клиента
+//! \param client Клиент
+//! \param generation Номер подключения пула
+//! \return
+//!
+//! The client is returned to the pool when the last copy of the pointer is destroyed.
+//!
+std::shared_ptr<QtRedisClient> QtRedisClientPool::makeHandle(const std::shared_ptr<QtRedisClient> &client, const int generation) const
+{
+    const std::weak_ptr<Data> weakData = _data;
+    return std::shared_ptr<QtRedisClient>(client.get(), [weakData, client, generation](QtRedisClient *) {
+        QtRedisClientPool::releaseClient(weakData.lock(), client, generation);
+    });
+}
+
+//!
+//! \brief Дополнить пул до минимального количества клиентов
+//!
+//! Mode::RoundRobin - up to maxSize clients.
+//!
+void QtRedisClientPool::fillPool()
+{
+    QMutexLocker lock(&_data->mutex);
+    const int fillSize = (_mode == Mode::RoundRobin) ? _maxSize : _minSize;
+    while (_data->isOpen && _data->size < fillSize) {
+        _data->size++;
+        const Config config = _data->config;
+        const int generation = _data->generation;
+        lock.unlock();
+        QString error;
+        const std::shared_ptr<QtRedisClient> client = this->makeClient(config, error);
+        lock.relock();
+        if (generation != _data->generation)
+            return;
+        if (!client) {
+            _data->size--;
+            _data->lastError = error;
+            return;
+        }
+        Item item;
+        item.client = client;
+        item.idleSinceMSec = QDateTime::currentMSecsSinceEpoch();
+        item.checkedMSec = item.idleSinceMSec;
+        _data->items.append(item);
+        _data->condition.wakeOne();
+    }
+}
+
+//!
+//! \brief Вернуть клиента в пул
+//! \param data Общие данные пула
+//! \param client Клиент
+//! \param generation Номер подключения пула
+//!
+//! Disconnected clients and clients of the previous connection of the pool are not returned.
+//!
+void QtRedisClientPool::releaseClient(const std::shared_ptr<Data> &data, const std::shared_ptr<QtRedisClient> &client, const int generation)
+{
+    if (!data) {
+        client->redisDisconnect();
+        return;
+    }
+    QMutexLocker lock(&data->mutex);
+    if (generation != data->generation) {
+        lock.unlock();
+        client->redisDisconnect();
+        return;
+    }
+    if (!data->isOpen || !client->redisIsConnected()) {
+        data->size--;
+        data->condition.wakeOne();
+        lock.unlock();
+        client->redisDisconnect();
+        return;
+    }
+    Item item;
+    item.client = client;
+    item.idleSinceMSec = QDateTime::currentMSecsSinceEpoch();
+    item.checkedMSec = item.idleSinceMSec;
+    data->items.append(item);
+    data->condition.wakeOne();
+}
+
+// --- protected slots ---
+
+//!
+//! \brief Слот обслуживания пула (отключение простаивающих клиентов и проверка соединений)
+//!
+void QtRedisClientPool::onMaintenance()
+{
+    QMutexLocker lock(&_data->mutex);
+    if (!_data->isOpen)
+        return;
+
+    const qint64 currentMSec = QDateTime::currentMSecsSinceEpoch();
+    const int generation = _data->generation;
+    QList<Item> evictItems;
+    QList<Item> checkItems;
+    for (int i = 0; i < _data->items.size(); ) {
+        const Item &item = _data->items.at(i);
+        if (_mode == Mode::Checkout
+            && _idleTimeoutMSec > 0
+            && _data->size > _minSize
+            && currentMSec - item.idleSinceMSec >= _idleTimeoutMSec) {
+            evictItems.append(_data->items.takeAt(i));
+            _data->size--;
+            continue;
+        }
+        if (_healthCheckMSec > 0
+            && currentMSec - item.checkedMSec >= _healthCheckMSec) {
+            // Mode::Checkout - the client is checked out while checking
+            if (_mode == Mode::Checkout) {
+                checkItems.append(_data->items.takeAt(i));
+                continue;
+            }
+            checkItems.append(item);
+            _data->items[i].checkedMSec = currentMSec;
+        }
+        i++;
+    }
+    lock.unlock();
+
+    for (const Item &item : evictItems)
+        item.client->redisDisconnect();
+
+    for (const Item &item : checkItems) {
+        const bool isOk = item.client->redisPing()
+                          || item.client->redisReconnect();
+        lock.relock();
+        if (generation != _data->generation) {
+            lock.unlock();
+            item.client->redisDisconnect();
+            continue;
+        }
+        if (_mode == Mode::Checkout) {
+            if (isOk) {
+                Item buffItem = item;
+                buffItem.checkedMSec = currentMSec;
+                _data->items.append(buffItem);
+            } else {
+                _data->size--;
+            }
+            _data->condition.wakeOne();
+        } else if (!isOk) {
+            for (int i = 0; i < _data->items.size(); i++) {
+                if (_data->items.at(i).client == item.client) {
+                    _data->items.removeAt(i);
+                    _data->size--;
+                    break;
+                }
+            }
+        }
+        lock.unlock();
+    }
+    this->fillPool();
+}
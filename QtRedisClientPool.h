@@ -0,0 +1,149 @@
+#ifndef QTREDISCLIENTPOOL_H
+#define QTREDISCLIENTPOOL_H
+
+#include <memory>
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QTimer>
+#include <QSslConfiguration>
+
+#include "QtRedisClient.h"
+
+//!
+//! \file QtRedisClientPool.h
+//! \class QtRedisClientPool
+//! \brief Класс пула соединений с NoSQL базой данных Redis
+//!
+//! The pool manages several QtRedisClient objects connected to the same server,
+//! so that concurrent workers use separate connections instead of waiting for one mutex.
+//!
+//! Note: Idle eviction and health checks are performed by the timer in the thread of the pool object (requires the event loop).
+//!
+class QtRedisClientPool : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(QtRedisClientPool)
+
+public:
+    //!
+    //! \brief Режимы выдачи клиентов
+    //!
+    enum class Mode {
+        Checkout = 0,   //!< монопольная выдача клиента (до возврата в пул)
+        RoundRobin      //!< поочередная выдача общих клиентов
+    };
+
+    explicit QtRedisClientPool(const Mode mode = Mode::Checkout,
+                               const int minSize = 1,
+                               const int maxSize = 8);
+    ~QtRedisClientPool();
+
+    Mode mode() const;
+    int minSize() const;
+    int maxSize() const;
+
+    void setIdleTimeout(const int msec);
+    int idleTimeout() const;
+
+    void setHealthCheckInterval(const int msec);
+    int healthCheckInterval() const;
+
+    void setConnectionOptions(const QtRedisTransporter::ConnectionOptions &options);
+    QtRedisTransporter::ConnectionOptions connectionOptions() const;
+
+    bool hasLastError() const;
+    QString lastError() const;
+
+    // ------------------------------------------------------------------------
+    // -- CONNECT/DISCONNECT FUNCTIONS ----------------------------------------
+    // ------------------------------------------------------------------------
+    bool redisIsConnected() const;
+
+    bool redisConnect(const QString &host,
+                      const int port = 6379,
+                      const int timeOutMsec = -1);
+
+    bool redisConnectEncrypted(const QString &host,
+                               const int port = 6379,
+                               const QSslConfiguration sslConfig = QSslConfiguration::defaultConfiguration(),
+                               const int timeOutMsec = -1);
+
+#if defined(Q_OS_LINUX)
+    bool redisConnectUnix(const QString &sockPath = QString("/tmp/redis.sock"),
+                          const int timeOutMsec = -1);
+#endif
+
+    void redisDisconnect();
+
+    // ------------------------------------------------------------------------
+    // -- POOL FUNCTIONS ------------------------------------------------------
+    // ------------------------------------------------------------------------
+    std::shared_ptr<QtRedisClient> acquire(const int timeOutMsec = -1);
+
+    int size() const;
+    int idleCount() const;
+
+protected:
+    //!
+    //! \brief Параметры подключения
+    //!
+    struct Config {
+        QtRedisTransporter::Type    type {QtRedisTransporter::Type::NoType};    //!< тип соединения
+        QString                     host;                                       //!< хост (путь к сокету для Unix)
+        int                         port {0};                                   //!< порт
+        QSslConfiguration           sslConfig;                                  //!< SSL Конфигурация
+        int                         timeOutMsec {-1};                           //!< время ожидания подключения мсек
+        QtRedisTransporter::ConnectionOptions options;                          //!< параметры соединения (AUTH, HELLO, CLIENT SETNAME, SELECT)
+    };
+
+    //!
+    //! \brief Клиент пула
+    //!
+    struct Item {
+        std::shared_ptr<QtRedisClient>  client;             //!< клиент
+        qint64                          idleSinceMSec {0};  //!< время возврата в пул (мсек от начала эпохи)
+        qint64                          checkedMSec {0};    //!< время последней проверки соединения (мсек от начала эпохи)
+    };
+
+    //!
+    //! \brief Общие данные пула
+    //!
+    //! Note: Shared with the handles of the checked out clients, which can outlive the pool object.
+    //!
+    struct Data {
+        QMutex          mutex;              //!< мьютекс
+        QWaitCondition  condition;          //!< условие возврата клиента в пул
+        QList<Item>     items;              //!< свободные клиенты (Mode::RoundRobin - все клиенты)
+        int             size {0};           //!< количество клиентов (включая выданные и подключаемые)
+        int             generation {0};     //!< номер подключения пула (клиенты прошлых подключений не возвращаются)
+        bool            isOpen {false};     //!< подключен ли пул
+        Config          config;             //!< параметры подключения
+        QString         lastError;          //!< последняя ошибка
+    };
+
+    const Mode              _mode;                      //!< режим выдачи клиентов
+    const int               _minSize;                   //!< минимальное количество клиентов
+    const int               _maxSize;                   //!< максимальное количество клиентов
+    int                     _idleTimeoutMSec {60000};   //!< время простоя клиента до отключения мсек
+    int                     _healthCheckMSec {30000};   //!< интервал проверки соединений мсек
+    QtRedisTransporter::ConnectionOptions _connectionOptions; //!< параметры соединения (применяются при подключении)
+    int                     _roundRobinIndex {0};       //!< индекс следующего клиента (Mode::RoundRobin)
+    std::shared_ptr<Data>   _data;                      //!< общие данные пула
+    QTimer                  *_timer {nullptr};          //!< таймер обслуживания пула
+
+    bool connectPool(const Config &config);
+    std::shared_ptr<QtRedisClient> makeClient(const Config &config, QString &error) const;
+    std::shared_ptr<QtRedisClient> makeHandle(const std::shared_ptr<QtRedisClient> &client, const int generation) const;
+    void fillPool();
+
+    static void releaseClient(const std::shared_ptr<Data> &data, const std::shared_ptr<QtRedisClient> &client, const int generation);
+
+protected slots:
+    void onMaintenance();
+};
+
+#endif // QTREDISCLIENTPOOL_H
@@ -0,0 +1,280 @@
+#include "QtRedisScanIterator.h"
+
+//!
+//! \brief Конструктор класса
+//! \param client Клиент
+//! \param command Команда итерации
+//! \param key Ключ коллекции (кроме Command::Scan)
+//!
+QtRedisScanIterator::QtRedisScanIterator(QtRedisClient *client, const Command command, const QByteArray &key)
+    : _client(client)
+    , _command(command)
+    , _key(key)
+{
+}
+
+//!
+//! \brief Команда итерации
+//! \return
+//!
+QtRedisScanIterator::Command QtRedisScanIterator::command() const
+{
+    return _command;
+}
+
+//!
+//! \brief Ключ коллекции
+//! \return
+//!
+QByteArray QtRedisScanIterator::key() const
+{
+    return _key;
+}
+
+//!
+//! \brief Задать шаблон элементов (MATCH)
+//! \param pattern Шаблон (пустой - все элементы)
+//!
+//! Note: The filter is applied by the server after the elements are retrieved, so batches can be empty or small.
+//!
+void QtRedisScanIterator::setMatch(const QByteArray &pattern)
+{
+    _match = pattern;
+}
+
+//!
+//! \brief Шаблон элементов
+//! \return
+//!
+QByteArray QtRedisScanIterator::match() const
+{
+    return _match;
+}
+
+//!
+//! \brief Задать рекомендуемое количество элементов за итерацию (COUNT)
+//! \param count Количество (0 - по умолчанию сервера)
+//!
+void QtRedisScanIterator::setCount(const int count)
+{
+    _count = qMax(count, 0);
+}
+
+//!
+//! \brief Рекомендуемое количество элементов за итерацию
+//! \return
+//!
+int QtRedisScanIterator::count() const
+{
+    return _count;
+}
+
+//!
+//! \brief Задать тип значений ключей (TYPE)
+//! \param type Тип (string, list, set, zset, hash, stream; пустой - все типы)
+//!
+//! Note: Only for Command::Scan (Redis 6.0.0 and above).
+//!
+void QtRedisScanIterator::setKeyType(const QString &type)
+{
+    _keyType = type;
+}
+
+//!
+//! \brief Тип значений ключей
+//! \return
+//!
+QString QtRedisScanIterator::keyType() const
+{
+    return _keyType;
+}
+
+//!
+//! \brief Включить (выключить) предварительный запрос следующей страницы
+//! \param enable Флаг
+//!
+//! The request of the next page is sent before next() returns the current batch
+//! (see QtRedisClient::redisExecCommandDeferred()).
+//!
+void QtRedisScanIterator::setPrefetch(const bool enable)
+{
+    _isPrefetch = enable;
+}
+
+//!
+//! \brief Включен ли предварительный запрос следующей страницы
+//! \return
+//!
+bool QtRedisScanIterator::isPrefetch() const
+{
+    return _isPrefetch;
+}
+
+//!
+//! \brief Есть ли еще элементы для итерации
+//! \return
+//!
+bool QtRedisScanIterator::hasNext() const
+{
+    return !_isFinished;
+}
+
+//!
+//! \brief Получить следующую порцию элементов
+//! \param ok Состояние об ошибке
+//! \return
+//!
+//! Pages with an empty batch are skipped, so the result is empty only if the iteration is finished or failed.
+//! On error the cursor is not changed, the next call repeats the request of the same page.
+//!
+QList<QByteArray> QtRedisScanIterator::next(bool *ok)
+{
+    if (ok)
+        *ok = false;
+    _lastError.clear();
+    if (!_client) {
+        _lastError = QString("QtRedisClient is NULL!");
+        return QList<QByteArray>();
+    }
+    if (_command != Command::Scan && _key.isEmpty()) {
+        _lastError = QString("Invalid key!");
+        return QList<QByteArray>();
+    }
+    while (!_isFinished) {
+        QtRedisReply reply;
+        if (_prefetchRequest) {
+            reply = _client->redisWaitDeferred(_prefetchRequest);
+            _prefetchRequest.reset();
+        } else {
+            reply = _client->redisExecCommand(this->makeCommand(_cursor));
+        }
+        if (_client->hasLastError()) {
+            _lastError = _client->lastError();
+            return QList<QByteArray>();
+        }
+        qulonglong nextCursor = 0;
+        QList<QByteArray> batch;
+        if (!this->parseReply(reply, nextCursor, batch)) {
+            _lastError = QString("Invalid reply of the scan command!");
+            return QList<QByteArray>();
+        }
+        _cursor = nextCursor;
+        _isFinished = (nextCursor == 0);
+        if (!_isFinished && _isPrefetch)
+            _prefetchRequest = _client->redisExecCommandDeferred(this->makeCommand(_cursor)); // on error the page is requested by the next call
+
+        if (!batch.isEmpty() || _isFinished) {
+            if (ok)
+                *ok = true;
+            return batch;
+        }
+    }
+    if (ok)
+        *ok = true;
+    return QList<QByteArray>();
+}
+
+//!
+//! \brief Курсор следующей страницы
+//! \return
+//!
+qulonglong QtRedisScanIterator::cursor() const
+{
+    return _cursor;
+}
+
+//!
+//! \brief Начать итерацию заново
+//!
+//! Note: The reply of the prefetched page is discarded.
+//!
+void QtRedisScanIterator::reset()
+{
+    _prefetchRequest.reset();
+    _cursor = 0;
+    _isFinished = false;
+    _lastError.clear();
+}
+
+//!
+//! \brief Есть ли ошибка
+//! \return
+//!
+bool QtRedisScanIterator::hasLastError() const
+{
+    return !_lastError.isEmpty();
+}
+
+//!
+//! \brief Последняя ошибка
+//! \return
+//!
+QString QtRedisScanIterator::lastError() const
+{
+    return _lastError;
+}
+
+// --- protected ---
+
+//!
+//! \brief Сформировать команду запроса страницы
+//! \param cursor Курсор
+//! \return
+//!
+QtRedisCommand QtRedisScanIterator::makeCommand(const qulonglong cursor) const
+{
+    QByteArray name;
+    switch (_command) {
+        case Command::Scan:
+            name = "SCAN";
+            break;
+        case Command::SScan:
+            name = "SSCAN";
+            break;
+        case Command::HScan:
+            name = "HSCAN";
+            break;
+        case Command::ZScan:
+            name = "ZSCAN";
+            break;
+    }
+    QtRedisCommand command(name);
+    if (_command != Command::Scan)
+        command << _key;
+    command << cursor;
+    if (!_match.isEmpty())
+        command << "MATCH" << _match;
+    if (_count > 0)
+        command << "COUNT" << _count;
+    if (_command == Command::Scan && !_keyType.isEmpty())
+        command << "TYPE" << _keyType;
+    return command;
+}
+
+//!
+//! \brief Разобрать ответ на запрос страницы
+//! \param reply Ответ сервера
+//! \param cursor Курсор следующей страницы
+//! \param batch Элементы страницы
+//! \return
+//!
+bool QtRedisScanIterator::parseReply(const QtRedisReply &reply, qulonglong &cursor, QList<QByteArray> &batch) const
+{
+    if (reply.type() != QtRedisReply::ReplyType::Array
+        || reply.arrayValueSize() != 2)
+        return false;
+
+    const QtRedisReply &cursorReply = reply.arrayValueAt_ref(0);
+    const QtRedisReply &itemsReply = reply.arrayValueAt_ref(1);
+    if (cursorReply.type() != QtRedisReply::ReplyType::String
+        || !itemsReply.isAggregate())
+        return false;
+
+    bool isOk = false;
+    cursor = cursorReply.rawValueView().toULongLong(&isOk);
+    if (!isOk)
+        return false;
+
+    batch = QtRedisReply::replyToByteArrayList(itemsReply);
+    return true;
+}
@@ -0,0 +1,81 @@
+#ifndef QTREDISSCANITERATOR_H
+#define QTREDISSCANITERATOR_H
+
+#include <QByteArray>
+#include <QString>
+#include <QList>
+
+#include "QtRedisClient.h"
+
+//!
+//! \file QtRedisScanIterator.h
+//! \class QtRedisScanIterator
+//! \brief Класс итерации по элементам коллекций Redis-а с помощью курсора (SCAN, SSCAN, HSCAN, ZSCAN)
+//!
+//! Each call of next() returns the next batch of elements, so the whole keyspace (collection)
+//! is never held in one reply. With the prefetch enabled the next page is requested before
+//! the current batch is returned, the round trip overlaps the processing of the batch by the caller.
+//!
+//! Note: For HSCAN and ZSCAN the batch contains pairs (field-value, member-score) in alternating order.
+//! Note: A given element may be returned multiple times (see the SCAN guarantees).
+//! Warn: The client must outlive the iterator. Other commands of the same client wait for the prefetched page first.
+//!
+class QtRedisScanIterator
+{
+public:
+    //!
+    //! \brief Команды итерации
+    //!
+    enum class Command {
+        Scan = 0,   //!< ключи текущей БД (SCAN)
+        SScan,      //!< элементы набора (SSCAN)
+        HScan,      //!< поля и значения хэша (HSCAN)
+        ZScan       //!< элементы и значения отсортированного набора (ZSCAN)
+    };
+
+    explicit QtRedisScanIterator(QtRedisClient *client,
+                                 const Command command = Command::Scan,
+                                 const QByteArray &key = QByteArray());
+    ~QtRedisScanIterator() = default;
+
+    Command command() const;
+    QByteArray key() const;
+
+    void setMatch(const QByteArray &pattern);
+    QByteArray match() const;
+
+    void setCount(const int count);
+    int count() const;
+
+    void setKeyType(const QString &type);
+    QString keyType() const;
+
+    void setPrefetch(const bool enable);
+    bool isPrefetch() const;
+
+    bool hasNext() const;
+    QList<QByteArray> next(bool *ok = 0);
+    qulonglong cursor() const;
+    void reset();
+
+    bool hasLastError() const;
+    QString lastError() const;
+
+protected:
+    QtRedisClient                       *_client {nullptr};     //!< клиент
+    const Command                       _command;               //!< команда итерации
+    const QByteArray                    _key;                   //!< ключ коллекции (кроме Command::Scan)
+    QByteArray                          _match;                 //!< шаблон элементов (MATCH)
+    int                                 _count {0};             //!< рекомендуемое количество элементов за итерацию (COUNT)
+    QString                             _keyType;               //!< тип значений ключей (TYPE, только Command::Scan)
+    bool                                _isPrefetch {false};    //!< запрашивать ли следующую страницу заранее
+    qulonglong                          _cursor {0};            //!< курсор следующей страницы
+    bool                                _isFinished {false};    //!< завершена ли итерация
+    QtRedisTransporter::DeferredRequest _prefetchRequest;       //!< запрос следующей страницы
+    QString                             _lastError;             //!< последняя ошибка
+
+    QtRedisCommand makeCommand(const qulonglong cursor) const;
+    bool parseReply(const QtRedisReply &reply, qulonglong &cursor, QList<QByteArray> &batch) const;
+};
+
+#endif // QTREDISSCANITERATOR_H
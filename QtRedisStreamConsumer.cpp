@@ -0,0 +1,658 @@
+#include "QtRedisStreamConsumer.h"
+
+#include <QRunnable>
+#include <QElapsedTimer>
+
+//!
+//! \class QtRedisStreamConsumerThread
+//! \brief Поток чтения записей
+//!
+class QtRedisStreamConsumerThread : public QThread
+{
+public:
+    explicit QtRedisStreamConsumerThread(const std::function<void()> &function)
+        : QThread()
+        , _function(function) {
+    }
+
+protected:
+    std::function<void()> _function; //!< функция потока
+
+    void run() override {
+        _function();
+    }
+};
+
+//!
+//! \class QtRedisStreamConsumerTask
+//! \brief Задача обработки порции записей
+//!
+class QtRedisStreamConsumerTask : public QRunnable
+{
+public:
+    explicit QtRedisStreamConsumerTask(const std::function<void()> &function)
+        : QRunnable()
+        , _function(function) {
+    }
+
+    void run() override {
+        _function();
+    }
+
+protected:
+    std::function<void()> _function; //!< функция задачи
+};
+
+//!
+//! \brief Конструктор класса
+//! \param stream Ключ потока
+//! \param group Группа потребителей
+//! \param consumer Потребитель (уникальное имя в группе)
+//!
+QtRedisStreamConsumer::QtRedisStreamConsumer(const QByteArray &stream,
+                                             const QString &group,
+                                             const QString &consumer)
+    : QObject()
+    , _stream(stream)
+    , _group(group)
+    , _consumer(consumer)
+    , _workers(new QThreadPool(this))
+{
+}
+
+//!
+//! \brief Деструктор класса
+//!
+QtRedisStreamConsumer::~QtRedisStreamConsumer()
+{
+    this->stop();
+}
+
+//!
+//! \brief Ключ потока
+//! \return
+//!
+QByteArray QtRedisStreamConsumer::stream() const
+{
+    return _stream;
+}
+
+//!
+//! \brief Группа потребителей
+//! \return
+//!
+QString QtRedisStreamConsumer::group() const
+{
+    return _group;
+}
+
+//!
+//! \brief Потребитель
+//! \return
+//!
+QString QtRedisStreamConsumer::consumer() const
+{
+    return _consumer;
+}
+
+//!
+//! \brief Задать функцию обработки порции записей
+//! \param handler Функция
+//!
+void QtRedisStreamConsumer::setBatchHandler(const BatchHandler &handler)
+{
+    QMutexLocker lock(&_mutex);
+    _handler = handler;
+}
+
+//!
+//! \brief Задать количество записей в порции
+//! \param size Количество
+//!
+void QtRedisStreamConsumer::setBatchSize(const int size)
+{
+    QMutexLocker lock(&_mutex);
+    _batchSize = qMax(size, 1);
+}
+
+//!
+//! \brief Количество записей в порции
+//! \return
+//!
+int QtRedisStreamConsumer::batchSize() const
+{
+    QMutexLocker lock(&_mutex);
+    return _batchSize;
+}
+
+//!
+//! \brief Задать время ожидания новых записей
+//! \param msec Время мсек
+//!
+//! Note: Defines the response time of stop(). Must be less than the read timeout of the connection (30 sec).
+//!
+void QtRedisStreamConsumer::setBlockTimeout(const int msec)
+{
+    QMutexLocker lock(&_mutex);
+    _blockTimeoutMSec = qBound(1, msec, 25000);
+}
+
+//!
+//! \brief Время ожидания новых записей
+//! \return
+//!
+int QtRedisStreamConsumer::blockTimeout() const
+{
+    QMutexLocker lock(&_mutex);
+    return _blockTimeoutMSec;
+}
+
+//!
+//! \brief Задать количество обработчиков
+//! \param count Количество
+//!
+//! Default: QThread::idealThreadCount().
+//!
+void QtRedisStreamConsumer::setWorkerCount(const int count)
+{
+    _workers->setMaxThreadCount(qMax(count, 1));
+}
+
+//!
+//! \brief Количество обработчиков
+//! \return
+//!
+int QtRedisStreamConsumer::workerCount() const
+{
+    return _workers->maxThreadCount();
+}
+
+//!
+//! \brief Задать максимальное количество порций в обработке
+//! \param count Количество (0 - удвоенное количество обработчиков)
+//!
+//! The reader stops reading new entries while the limit is reached.
+//!
+void QtRedisStreamConsumer::setMaxPendingBatches(const int count)
+{
+    QMutexLocker lock(&_mutex);
+    _maxPendingBatches = qMax(count, 0);
+}
+
+//!
+//! \brief Максимальное количество порций в обработке
+//! \return
+//!
+int QtRedisStreamConsumer::maxPendingBatches() const
+{
+    QMutexLocker lock(&_mutex);
+    return (_maxPendingBatches > 0 ? _maxPendingBatches : _workers->maxThreadCount() * 2);
+}
+
+//!
+//! \brief Задать интервал возврата зависших записей
+//! \param msec Время мсек (0 - не возвращать)
+//!
+void QtRedisStreamConsumer::setReclaimInterval(const int msec)
+{
+    QMutexLocker lock(&_mutex);
+    _reclaimIntervalMSec = qMax(msec, 0);
+}
+
+//!
+//! \brief Интервал возврата зависших записей
+//! \return
+//!
+int QtRedisStreamConsumer::reclaimInterval() const
+{
+    QMutexLocker lock(&_mutex);
+    return _reclaimIntervalMSec;
+}
+
+//!
+//! \brief Задать время простоя записи до возврата
+//! \param msec Время мсек
+//!
+//! Note: Must be greater than the processing time of a batch, otherwise the entries are processed twice.
+//!
+void QtRedisStreamConsumer::setMinIdleTime(const int msec)
+{
+    QMutexLocker lock(&_mutex);
+    _minIdleTimeMSec = qMax(msec, 0);
+}
+
+//!
+//! \brief Время простоя записи до возврата
+//! \return
+//!
+int QtRedisStreamConsumer::minIdleTime() const
+{
+    QMutexLocker lock(&_mutex);
+    return _minIdleTimeMSec;
+}
+
+//!
+//! \brief Включить (выключить) создание группы потребителей
+//! \param enable Флаг
+//!
+//! If the group does not exist, it is created by XGROUP CREATE with MKSTREAM (only the new entries are delivered).
+//!
+void QtRedisStreamConsumer::setCreateGroup(const bool enable)
+{
+    QMutexLocker lock(&_mutex);
+    _isCreateGroup = enable;
+}
+
+//!
+//! \brief Включено ли создание группы потребителей
+//! \return
+//!
+bool QtRedisStreamConsumer::isCreateGroup() const
+{
+    QMutexLocker lock(&_mutex);
+    return _isCreateGroup;
+}
+
+//!
+//! \brief Запустить потребителя
+//! \param host IP-адрес
+//! \param port Порт
+//! \param timeOutMsec Время ожидания подключения в мсек
+//! \return
+//!
+//! Данный метод использует протокол TCP.
+//!
+bool QtRedisStreamConsumer::start(const QString &host, const int port, const int timeOutMsec)
+{
+    return this->start([host, port, timeOutMsec](QtRedisClient &client, QString &error) {
+        if (client.redisConnect(host, port, timeOutMsec))
+            return true;
+        error = client.lastError();
+        return false;
+    });
+}
+
+//!
+//! \brief Запустить потребителя
+//! \param connectFunction Функция подключения клиента (SSL, Unix, AUTH, SELECT...)
+//! \return
+//!
+//! Returns true if the reader thread is connected to the server.
+//!
+bool QtRedisStreamConsumer::start(const ConnectFunction &connectFunction)
+{
+    if (_stream.isEmpty() || _group.isEmpty() || _consumer.isEmpty()) {
+        this->setLastError("Invalid stream, group or consumer!");
+        return false;
+    }
+    if (!connectFunction) {
+        this->setLastError("Invalid connect function!");
+        return false;
+    }
+    this->stop();
+
+    QMutexLocker lock(&_mutex);
+    _connectFunction = connectFunction;
+    _isStopping = false;
+    _isStarted = false;
+    _lastError.clear();
+    _thread = new QtRedisStreamConsumerThread([this]() { this->readLoop(); });
+    _thread->start();
+    while (!_isStarted)
+        _condition.wait(&_mutex);
+    if (_isStopping) {
+        lock.unlock();
+        this->stop();
+        return false;
+    }
+    return true;
+}
+
+//!
+//! \brief Остановить потребителя
+//!
+//! Waits for the current read (no longer than the block timeout) and the batches in processing,
+//! then acknowledges the processed entries.
+//!
+void QtRedisStreamConsumer::stop()
+{
+    QMutexLocker lock(&_mutex);
+    if (!_thread)
+        return;
+    _isStopping = true;
+    _condition.wakeAll();
+    QThread *thread = _thread;
+    lock.unlock();
+    thread->wait();
+    lock.relock();
+    delete _thread;
+    _thread = nullptr;
+}
+
+//!
+//! \brief Запущен ли потребитель
+//! \return
+//!
+bool QtRedisStreamConsumer::isRunning() const
+{
+    QMutexLocker lock(&_mutex);
+    return (_thread && !_isStopping);
+}
+
+//!
+//! \brief Количество обработанных записей
+//! \return
+//!
+qlonglong QtRedisStreamConsumer::processedCount() const
+{
+    QMutexLocker lock(&_mutex);
+    return _processedCount;
+}
+
+//!
+//! \brief Количество подтвержденных записей
+//! \return
+//!
+qlonglong QtRedisStreamConsumer::ackedCount() const
+{
+    QMutexLocker lock(&_mutex);
+    return _ackedCount;
+}
+
+//!
+//! \brief Количество возвращенных записей (XAUTOCLAIM)
+//! \return
+//!
+qlonglong QtRedisStreamConsumer::reclaimedCount() const
+{
+    QMutexLocker lock(&_mutex);
+    return _reclaimedCount;
+}
+
+//!
+//! \brief Есть ли ошибка
+//! \return
+//!
+bool QtRedisStreamConsumer::hasLastError() const
+{
+    QMutexLocker lock(&_mutex);
+    return !_lastError.isEmpty();
+}
+
+//!
+//! \brief Последняя ошибка
+//! \return
+//!
+QString QtRedisStreamConsumer::lastError() const
+{
+    QMutexLocker lock(&_mutex);
+    return _lastError;
+}
+
+// --- protected ---
+
+//!
+//! \brief Цикл чтения записей (поток чтения)
+//!
+//! The client is created in the reader thread, so its sockets belong to this thread.
+//!
+void QtRedisStreamConsumer::readLoop()
+{
+    QtRedisClient client;
+    QString error;
+    const bool isConnected = _connectFunction(client, error);
+
+    QMutexLocker lock(&_mutex);
+    _isStarted = true;
+    if (!isConnected) {
+        _isStopping = true;
+        _condition.wakeAll();
+        lock.unlock();
+        this->setLastError(error.isEmpty() ? QString("Connection to the server failed!") : error);
+        return;
+    }
+    _condition.wakeAll();
+    lock.unlock();
+
+    QByteArray readId("0"); // the pending entries of this consumer are read first
+    bool isReclaimEnabled = true;
+    QElapsedTimer reclaimTimer;
+    reclaimTimer.start();
+    while (this->waitForCapacity()) {
+        this->flushAcks(client);
+
+        lock.relock();
+        const int reclaimIntervalMSec = _reclaimIntervalMSec;
+        lock.unlock();
+        if (isReclaimEnabled
+            && reclaimIntervalMSec > 0
+            && reclaimTimer.elapsed() >= reclaimIntervalMSec) {
+            this->reclaimEntries(client, isReclaimEnabled);
+            reclaimTimer.restart();
+            continue;
+        }
+        if (!this->readEntries(client, readId)) {
+            lock.relock();
+            const int sleepMSec = qMin(_blockTimeoutMSec, 1000);
+            lock.unlock();
+            QThread::msleep(sleepMSec);
+        }
+    }
+    this->waitForWorkers();
+    this->flushAcks(client);
+    client.redisDisconnect();
+}
+
+//!
+//! \brief Прочитать порцию записей (XREADGROUP)
+//! \param client Клиент
+//! \param readId Идентификатор чтения (> - новые записи, иначе - ожидающие подтверждения записи потребителя)
+//! \return
+//!
+//! The reply is parsed from the compact form (QtRedisReplyTree) directly into the entries.
+//!
+bool QtRedisStreamConsumer::readEntries(QtRedisClient &client, QByteArray &readId)
+{
+    QMutexLocker lock(&_mutex);
+    const int batchSize = _batchSize;
+    const int blockTimeoutMSec = _blockTimeoutMSec;
+    lock.unlock();
+
+    QtRedisCommand command("XREADGROUP");
+    command << "GROUP" << _group << _consumer << "COUNT" << batchSize;
+    if (readId == ">")
+        command << "BLOCK" << blockTimeoutMSec;
+    command << "STREAMS" << _stream << readId;
+    const QtRedisReplyTree reply = client.redisExecCommandTree(command);
+    if (client.hasLastError())
+        return this->handleError(client, client.lastError());
+
+    const QVector<QtRedisStreamEntry> entries = QtRedisStreamEntry::fromStreamsReplyTree(reply).value(_stream);
+    if (readId != ">") {
+        if (entries.isEmpty()) {
+            readId = ">";
+            return true;
+        }
+        readId = entries.constLast().id();
+    }
+    if (!entries.isEmpty())
+        this->dispatchEntries(entries);
+    return true;
+}
+
+//!
+//! \brief Вернуть зависшие записи группы (XAUTOCLAIM)
+//! \param client Клиент
+//! \param isReclaimEnabled Включен ли возврат (сбрасывается, если команда не поддерживается сервером)
+//!
+void QtRedisStreamConsumer::reclaimEntries(QtRedisClient &client, bool &isReclaimEnabled)
+{
+    QMutexLocker lock(&_mutex);
+    const int batchSize = _batchSize;
+    const int minIdleTimeMSec = _minIdleTimeMSec;
+    lock.unlock();
+
+    QByteArray cursor("0-0");
+    do {
+        QtRedisCommand command("XAUTOCLAIM");
+        command << _stream << _group << _consumer << minIdleTimeMSec << cursor << "COUNT" << batchSize;
+        const QtRedisReplyTree reply = client.redisExecCommandTree(command);
+        if (client.hasLastError()) {
+            const QString error = client.lastError();
+            if (error.startsWith("ERR unknown command")) {
+                isReclaimEnabled = false;
+                this->setLastError(QString("XAUTOCLAIM is not supported by the server, reclaim is disabled!"));
+                return;
+            }
+            this->handleError(client, error);
+            return;
+        }
+        if (reply.arraySize(0) < 2)
+            return;
+
+        const QByteArray nextCursor = reply.value(reply.arrayItem(0, 0));
+        cursor = QByteArray(nextCursor.constData(), nextCursor.size());
+        QVector<QtRedisStreamEntry> entries = QtRedisStreamEntry::fromReplyTree(reply, reply.arrayItem(0, 1));
+        if (!entries.isEmpty()) {
+            lock.relock();
+            _reclaimedCount += entries.size();
+            lock.unlock();
+            this->dispatchEntries(entries);
+        }
+    } while (cursor != "0-0" && this->waitForCapacity());
+}
+
+//!
+//! \brief Подтвердить обработанные записи (XACK)
+//! \param client Клиент
+//!
+//! All identifiers are sent by the XACK commands (up to 1000 identifiers each) in one pipeline.
+//! If the pipeline fails, the entries stay pending and are reclaimed later.
+//!
+void QtRedisStreamConsumer::flushAcks(QtRedisClient &client)
+{
+    QMutexLocker lock(&_mutex);
+    if (_ackIds.isEmpty())
+        return;
+    const QList<QByteArray> ackIds = _ackIds;
+    _ackIds.clear();
+    lock.unlock();
+
+    const int chunkSize = 1000;
+    QtRedisPipeline pipeline = client.createPipeline();
+    for (int i = 0; i < ackIds.size(); i += chunkSize) {
+        const QList<QByteArray> chunk = ackIds.mid(i, chunkSize);
+        QtRedisCommand command("XACK");
+        command.reserve(chunk.size() + 2);
+        command << _stream << _group << chunk;
+        pipeline.redisExecCommand(command);
+    }
+    // the result has the reply of each command (exec() returns the single reply of one XACK unwrapped)
+    const QtRedisPipelineResult result = pipeline.execToResult();
+    if (pipeline.hasLastError()) {
+        this->handleError(client, pipeline.lastError());
+        return;
+    }
+    qlonglong ackedCount = 0;
+    for (const QtRedisReply &ackReply : result.replies())
+        ackedCount += ackReply.intValue();
+
+    lock.relock();
+    _ackedCount += ackedCount;
+}
+
+//!
+//! \brief Передать записи в пул обработчиков
+//! \param entries Записи
+//!
+void QtRedisStreamConsumer::dispatchEntries(const QVector<QtRedisStreamEntry> &entries)
+{
+    QMutexLocker lock(&_mutex);
+    _pendingBatches++;
+    lock.unlock();
+    _workers->start(new QtRedisStreamConsumerTask([this, entries]() { this->processBatch(entries); }));
+}
+
+//!
+//! \brief Обработать порцию записей (поток пула обработчиков)
+//! \param entries Записи
+//!
+void QtRedisStreamConsumer::processBatch(const QVector<QtRedisStreamEntry> &entries)
+{
+    QMutexLocker lock(&_mutex);
+    const BatchHandler handler = _handler;
+    lock.unlock();
+
+    const bool isProcessed = (handler && handler(entries));
+
+    lock.relock();
+    if (isProcessed) {
+        _ackIds.reserve(_ackIds.size() + entries.size());
+        for (const QtRedisStreamEntry &entry : entries)
+            _ackIds.append(entry.id());
+        _processedCount += entries.size();
+    }
+    _pendingBatches--;
+    _condition.wakeAll();
+}
+
+//!
+//! \brief Ожидать свободного места в пуле обработчиков
+//! \return false, если потребитель остановлен
+//!
+bool QtRedisStreamConsumer::waitForCapacity()
+{
+    QMutexLocker lock(&_mutex);
+    const int maxPendingBatches = (_maxPendingBatches > 0 ? _maxPendingBatches : _workers->maxThreadCount() * 2);
+    while (!_isStopping
+           && _pendingBatches >= maxPendingBatches)
+        _condition.wait(&_mutex);
+    return !_isStopping;
+}
+
+//!
+//! \brief Ожидать завершения обработки всех порций
+//!
+void QtRedisStreamConsumer::waitForWorkers()
+{
+    QMutexLocker lock(&_mutex);
+    while (_pendingBatches > 0)
+        _condition.wait(&_mutex);
+}
+
+//!
+//! \brief Обработать ошибку чтения
+//! \param client Клиент
+//! \param error Сообщение об ошибке
+//! \return true, если ошибка устранена
+//!
+bool QtRedisStreamConsumer::handleError(QtRedisClient &client, const QString &error)
+{
+    QMutexLocker lock(&_mutex);
+    const bool isCreateGroup = _isCreateGroup;
+    lock.unlock();
+
+    if (error.startsWith("NOGROUP") && isCreateGroup) {
+        client.redisXGroupCreate(_stream, _group, QString("$"), true);
+        if (!client.hasLastError() || client.lastError().startsWith("BUSYGROUP"))
+            return true;
+        this->setLastError(client.lastError());
+        return false;
+    }
+    this->setLastError(error);
+    if (!client.redisIsConnected())
+        client.redisReconnect();
+    return false;
+}
+
+//!
+//! \brief Задать последнюю ошибку
+//! \param error Сообщение об ошибке
+//!
+void QtRedisStreamConsumer::setLastError(const QString &error)
+{
+    QMutexLocker lock(&_mutex);
+    _lastError = error;
+    lock.unlock();
+    emit this->errorOccurred(error);
+}
@@ -0,0 +1,142 @@
+#ifndef QTREDISSTREAMCONSUMER_H
+#define QTREDISSTREAMCONSUMER_H
+
+#include <functional>
+
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+#include <QList>
+#include <QVector>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+#include <QThreadPool>
+
+#include "QtRedisClient.h"
+#include "Core/QtRedisStreamEntry.h"
+
+//!
+//! \file QtRedisStreamConsumer.h
+//! \class QtRedisStreamConsumer
+//! \brief Класс обработки записей потока Redis-a в группе потребителей
+//!
+//! The reader thread owns its own connection and runs the blocking XREADGROUP, the received entries
+//! are passed in batches to the worker pool. Processed batches are acknowledged by XACK commands sent
+//! in one pipeline, entries left pending longer than the minimum idle time (by any consumer of the group)
+//! are reclaimed by XAUTOCLAIM and processed again.
+//!
+//! On start the pending entries of this consumer (left by the previous run) are processed first.
+//!
+//! Note: The delivery is at-least-once: if the batch handler fails (returns false) the entries stay pending and are reclaimed later.
+//! Note: XAUTOCLAIM requires Redis 6.2.0 and above.
+//!
+class QtRedisStreamConsumer : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(QtRedisStreamConsumer)
+
+public:
+    //!
+    //! \brief Функция обработки порции записей
+    //!
+    //! Called in the thread of the worker pool. Returns true if the entries are processed and must be acknowledged.
+    //!
+    typedef std::function<bool(const QVector<QtRedisStreamEntry> &entries)> BatchHandler;
+
+    //!
+    //! \brief Функция подключения клиента
+    //!
+    //! Called in the reader thread. Returns false and the error message if the client is not connected.
+    //!
+    typedef std::function<bool(QtRedisClient &client, QString &error)> ConnectFunction;
+
+    explicit QtRedisStreamConsumer(const QByteArray &stream,
+                                   const QString &group,
+                                   const QString &consumer);
+    ~QtRedisStreamConsumer();
+
+    QByteArray stream() const;
+    QString group() const;
+    QString consumer() const;
+
+    void setBatchHandler(const BatchHandler &handler);
+
+    void setBatchSize(const int size);
+    int batchSize() const;
+
+    void setBlockTimeout(const int msec);
+    int blockTimeout() const;
+
+    void setWorkerCount(const int count);
+    int workerCount() const;
+
+    void setMaxPendingBatches(const int count);
+    int maxPendingBatches() const;
+
+    void setReclaimInterval(const int msec);
+    int reclaimInterval() const;
+
+    void setMinIdleTime(const int msec);
+    int minIdleTime() const;
+
+    void setCreateGroup(const bool enable);
+    bool isCreateGroup() const;
+
+    bool start(const QString &host,
+               const int port = 6379,
+               const int timeOutMsec = -1);
+    bool start(const ConnectFunction &connectFunction);
+    void stop();
+    bool isRunning() const;
+
+    qlonglong processedCount() const;
+    qlonglong ackedCount() const;
+    qlonglong reclaimedCount() const;
+
+    bool hasLastError() const;
+    QString lastError() const;
+
+protected:
+    const QByteArray  _stream;                      //!< ключ потока
+    const QString     _group;                       //!< группа потребителей
+    const QString     _consumer;                    //!< потребитель
+
+    BatchHandler      _handler;                     //!< функция обработки порции записей
+    ConnectFunction   _connectFunction;             //!< функция подключения клиента
+    int               _batchSize {100};             //!< количество записей в порции (COUNT)
+    int               _blockTimeoutMSec {2000};     //!< время ожидания новых записей мсек (BLOCK)
+    int               _maxPendingBatches {0};       //!< максимальное количество порций в обработке (0 - удвоенное количество обработчиков)
+    int               _reclaimIntervalMSec {30000}; //!< интервал возврата зависших записей мсек (0 - не возвращать)
+    int               _minIdleTimeMSec {60000};     //!< время простоя записи до возврата мсек
+    bool              _isCreateGroup {true};        //!< создавать ли группу (и поток), если она не существует
+
+    mutable QMutex    _mutex;                       //!< мьютекс
+    QWaitCondition    _condition;                   //!< условие завершения обработки порции (запуска читателя)
+    QThread           *_thread {nullptr};           //!< поток чтения записей
+    QThreadPool       *_workers {nullptr};          //!< пул обработчиков
+    bool              _isStopping {false};          //!< остановлен ли потребитель
+    bool              _isStarted {false};           //!< завершен ли запуск читателя
+    int               _pendingBatches {0};          //!< количество порций в обработке
+    QList<QByteArray> _ackIds;                      //!< идентификаторы записей, ожидающих подтверждения
+    qlonglong         _processedCount {0};          //!< количество обработанных записей
+    qlonglong         _ackedCount {0};              //!< количество подтвержденных записей
+    qlonglong         _reclaimedCount {0};          //!< количество возвращенных записей
+    QString           _lastError;                   //!< последняя ошибка
+
+    void readLoop();
+    bool readEntries(QtRedisClient &client, QByteArray &readId);
+    void reclaimEntries(QtRedisClient &client, bool &isReclaimEnabled);
+    void flushAcks(QtRedisClient &client);
+    void dispatchEntries(const QVector<QtRedisStreamEntry> &entries);
+    void processBatch(const QVector<QtRedisStreamEntry> &entries);
+    bool waitForCapacity();
+    void waitForWorkers();
+    bool handleError(QtRedisClient &client, const QString &error);
+    void setLastError(const QString &error);
+
+signals:
+    void errorOccurred(QString error);
+};
+
+#endif // QTREDISSTREAMCONSUMER_H
@@ -0,0 +1,79 @@
+#include <QtTest>
+
+#include "QtRedisClient.h"
+#include "QtRedisStreamConsumer.h"
+
+//!
+//! \file QtRedisStreamConsumerTest.cpp
+//! \class QtRedisStreamConsumerTest
+//! \brief Тесты потребителя потока
+//!
+//! The tests need the Redis server (6.2.0 and above), the address is set by the environment variables
+//! QTREDISCLIENT_TEST_HOST and QTREDISCLIENT_TEST_PORT (127.0.0.1:6379 by default).
+//! Without the server the tests are skipped.
+//!
+class QtRedisStreamConsumerTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QString _host;
+    int     _port {6379};
+    QString _stream;
+
+    bool connectClient(QtRedisClient &client) {
+        return client.redisConnect(_host, _port, 1000);
+    }
+
+private slots:
+    void initTestCase() {
+        _host = QString::fromLocal8Bit(qgetenv("QTREDISCLIENT_TEST_HOST"));
+        if (_host.isEmpty())
+            _host = QString("127.0.0.1");
+        _port = qEnvironmentVariableIntValue("QTREDISCLIENT_TEST_PORT");
+        if (_port == 0)
+            _port = 6379;
+        _stream = QString("QtRedisStreamConsumerTest:%1").arg(QCoreApplication::applicationPid());
+        QtRedisClient client;
+        if (!this->connectClient(client))
+            QSKIP(qPrintable(QString("Redis server is not available: %1").arg(client.lastError())));
+    }
+
+    void cleanup() {
+        QtRedisClient client;
+        if (this->connectClient(client))
+            client.redisDel(QStringList() << _stream);
+    }
+
+    //!
+    //! \brief Подтверждение одной порции записей (одна команда XACK в конвейере)
+    //!
+    void ackOneBatch() {
+        const int entryCount = 10;
+        QtRedisClient client;
+        QVERIFY(this->connectClient(client));
+        client.redisXGroupCreate(_stream, "group", "0", true); // the entries added before the start are delivered
+        QVERIFY2(!client.hasLastError(), qPrintable(client.lastError()));
+        for (int i = 0; i < entryCount; ++i) {
+            const QtRedisReply reply = client.redisXAdd(_stream, {{"index", QString::number(i)}});
+            QVERIFY2(!client.hasLastError(), qPrintable(client.lastError()));
+            QVERIFY(reply.isString());
+        }
+
+        QtRedisStreamConsumer consumer(_stream.toUtf8(), "group", "consumer");
+        consumer.setBlockTimeout(100);
+        consumer.setBatchHandler([](const QVector<QtRedisStreamEntry> &) { return true; });
+        QVERIFY2(consumer.start(_host, _port, 1000), qPrintable(consumer.lastError()));
+        QTRY_COMPARE_WITH_TIMEOUT(consumer.processedCount(), qlonglong(entryCount), 5000);
+        consumer.stop();
+
+        QCOMPARE(consumer.ackedCount(), qlonglong(entryCount));
+        const QtRedisReply pending = client.redisXPending(_stream, "group");
+        QVERIFY2(!client.hasLastError(), qPrintable(client.lastError()));
+        QCOMPARE(pending.arrayValueFirst().intValue(), qlonglong(0));
+    }
+};
+
+QTEST_GUILESS_MAIN(QtRedisStreamConsumerTest)
+
+#include "QtRedisStreamConsumerTest.moc"